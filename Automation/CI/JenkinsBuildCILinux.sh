@@ -11,3 +11,12 @@ mkdir ReleaseBuild
 cd ReleaseBuild
 cmake -DCMAKE_BUILD_TYPE=Release -G "Unix Makefiles" ../Source
 cmake --build .
+
+cd ..
+
+# Do a debug build with AddressSanitizer, so the unit tests run after building fail on any out of bounds or use 
+# after free access
+mkdir AddressSanitizerBuild
+cd AddressSanitizerBuild
+cmake -DCMAKE_BUILD_TYPE=Debug -DADDRESS_SANITIZER=ON -G "Unix Makefiles" ../Source
+cmake --build .
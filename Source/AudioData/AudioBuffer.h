@@ -0,0 +1,113 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioBuffer.h
+//! @brief A multichannel audio buffer held in a single allocation.
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <AudioData/AudioDataView.h>
+#include <Utilities/AlignedAllocator.h>
+#include <vector>
+#include <cstddef>
+
+//! A multichannel audio buffer held in a single allocation.
+//
+//! The buffer holds a fixed number of channels, each with the same number of frames (a frame 
+//! being one sample for each channel).  All samples are stored in one 64 byte aligned block 
+//! with either a planar layout (all samples of channel 0, then all samples of channel 1, etc) 
+//! or an interleaved layout (sample 0 of every channel, then sample 1 of every channel, etc).
+//!
+//! Each channel can be accessed as an AudioDataView regardless of the layout.  Views of an 
+//! interleaved buffer have a stride equal to the channel count.
+
+class AudioBuffer
+{
+	public:
+		//! The ordering of samples in memory.
+		enum class Layout { PLANAR, INTERLEAVED };
+
+		//! Constructs a buffer with no channels.
+		AudioBuffer();
+
+		//! Constructs a buffer of the given channels and frames with all samples set to 0.0.
+		AudioBuffer(std::size_t channels, std::size_t frames, Layout layout=Layout::PLANAR);
+
+		//! Constructs a buffer by copying each of the given channels.
+		//
+		//! An exception is thrown if the channels are not all the same size.
+		AudioBuffer(const std::vector<AudioData>& channels, Layout layout=Layout::PLANAR);
+
+		//! Returns the number of channels in the buffer.
+		std::size_t GetChannels() const;
+
+		//! Returns the number of frames (samples per channel) in the buffer.
+		std::size_t GetFrames() const;
+
+		//! Returns the ordering of samples in memory.
+		Layout GetLayout() const;
+
+		//! Returns a read only pointer to all samples in the buffer, ordered by the layout.
+		const double* GetDataPointer() const;
+
+		//! Returns a pointer to all samples in the buffer, ordered by the layout, for direct write access.
+		double* GetDataPointerWriteAccess();
+
+		//! Returns the sample of the given channel at the given frame.  No bounds checking is performed.
+		double GetSample(std::size_t channel, std::size_t frame) const;
+
+		//! Sets the sample of the given channel at the given frame.  No bounds checking is performed.
+		void SetSample(std::size_t channel, std::size_t frame, double sample);
+
+		//! Returns a read only view of the given channel.
+		//
+		//! The view is invalidated if the buffer is destroyed or reassigned.
+		AudioDataView GetChannelView(std::size_t channel) const;
+
+		//! Copies the given samples into the given channel starting at the given frame.
+		//
+		//! An exception is thrown if the samples would go past the end of the channel.
+		void SetChannelSamples(std::size_t channel, const AudioDataView& samples, std::size_t startFrame=0);
+
+		//! Returns a copy of the given channel.
+		AudioData GetChannelAudioData(std::size_t channel) const;
+
+		//! Returns a copy of every channel, the left channel of stereo audio being index 0.
+		std::vector<AudioData> GetAllChannelsAudioData() const;
+
+		//! Returns a copy of this buffer using the given layout.
+		AudioBuffer ConvertLayout(Layout layout) const;
+
+	private:
+		std::size_t GetSampleIndex(std::size_t channel, std::size_t frame) const;
+		void CheckChannel(std::size_t channel) const;
+
+		std::size_t channels_{0};
+		std::size_t frames_{0};
+		Layout layout_{Layout::PLANAR};
+		std::vector<double, Utilities::AlignedAllocator<double>> data_;
+};
@@ -29,39 +29,66 @@
 
 #pragma once
 
+#include <AudioData/AudioDataView.h>
+#include <Utilities/MemoryPool.h>
 #include <vector>
 #include <cstdint>
 
 //! A class allowing for easy transportation and access of digital audio data. 
 //
 //! This class simply wraps a std::vector allowing various typical audio buffer 
-//! operations.  Audio data consist of an arbitrary number of "samples".  Samples
-//! are 64 bit floating point numbers that range from 1.0 (peak positive sample) 
-//! to -1.0 (peak negative sample).
-
-class AudioData
+//! operations.  The gain, mix and crossfade operations use SSE2/AVX2/NEON kernels 
+//! when the CPU supports them.  Audio data consist of an arbitrary number of "samples".  Samples
+//! are floating point numbers that range from 1.0 (peak positive sample) to -1.0 
+//! (peak negative sample).
+//!
+//! The class is templated on the sample type.  AudioData (64 bit samples) is used 
+//! throughout the library.  AudioDataFloat (32 bit samples) halves the memory 
+//! footprint and bandwidth, which is plenty of precision for 16 bit sources.
+//!
+//! The class is also templated on the allocator of its storage, which defaults to 
+//! std::allocator (see the declaration in AudioDataView.h).  PooledAudioData draws its 
+//! storage from the calling thread's Utilities::MemoryPool, which avoids the heap for 
+//! short lived buffers.  See AudioDataImplementation.h for using other allocators.
+//!
+//! The buffer is used as a FIFO by most of the Signal processors.  Removing samples 
+//! from the front of the buffer only advances a head offset, so front removal and 
+//! appending are both amortized O(1).  The removed samples are reclaimed lazily, 
+//! either once they make up over half of the underlying storage or when GetData() 
+//! or GetDataWriteAccess() are called.  Because of this lazy reclaiming, GetData() 
+//! may modify internal state and concurrent calls on the same object from multiple 
+//! threads must be externally synchronized.
+
+template<typename T, typename Allocator>
+class BasicAudioData
 {
 	public:
+		//! The container holding the samples.
+		using StorageType = std::vector<T, Allocator>;
+
 		//! Constructs an audio buffer with size of zero.
-		AudioData();
+		BasicAudioData();
+
+		//! Constructs an audio buffer with size of zero using the given allocator.
+		explicit BasicAudioData(const Allocator& allocator);
 
 		//! Constructs an audio buffer with the given audio data.
-		AudioData(const std::vector<double>& data);
+		BasicAudioData(const std::vector<T>& data);
 
 		//! Constructs an audio buffer with the given audio data.
-		AudioData(const double* data, std::size_t samples);
+		BasicAudioData(const T* data, std::size_t samples);
 
 		//! Constructs an audio buffer with the given audio data.
-		AudioData(const AudioData&);
+		BasicAudioData(const BasicAudioData&);
 
 		//! Constructs an audio buffer with the given audio data.
-		AudioData(AudioData&&);
+		BasicAudioData(BasicAudioData&&);
 
 		//! Virtual destructor in case of being subclassed.
-		virtual ~AudioData();
+		virtual ~BasicAudioData();
 
 		//! Assignment operator using the copy-and-swap idiom.
-		AudioData& operator=(AudioData);
+		BasicAudioData& operator=(BasicAudioData);
 
 		//! Inserts the given samples of silence (i.e. samples with value of 0.0).
 		void AddSilence(uint64_t sampleCount);
@@ -70,46 +97,73 @@ class AudioData
 		std::size_t GetSize() const;
 
 		//! Returns a read only reference to the audio data.
-		const std::vector<double>& GetData() const;
+		const StorageType& GetData() const;
 
 		//! Returns a reference (not a copy) to the actual encapsulated data buffer for direct write access
-		std::vector<double>& GetDataWriteAccess();
+		StorageType& GetDataWriteAccess();
+
+		//! Returns a read only pointer to the first sample of the buffer.
+		//
+		//! The samples are contiguous and GetSize() samples may be read.  Unlike GetData() this never 
+		//! has to reclaim samples removed from the front of the buffer, so it's the preferred way for 
+		//! processing loops to access the samples.  The pointer is invalidated by any call that adds 
+		//! or removes samples.
+		const T* GetDataPointer() const;
+
+		//! Returns a pointer to the first sample of the buffer for direct write access.
+		//
+		//! See GetDataPointer() for details on the lifetime of the returned pointer.
+		T* GetDataPointerWriteAccess();
+
+		//! Returns a read only view of all samples in the buffer.
+		//
+		//! The view is invalidated by any call that adds or removes samples.
+		BasicAudioDataView<T> View() const;
+
+		//! Returns a read only view of the given number of samples starting at the given position.
+		//
+		//! Unlike Retrieve() no samples are copied.  An exception is thrown if the given range 
+		//! exceeds the buffer.  The view is invalidated by any call that adds or removes samples.
+		BasicAudioDataView<T> View(uint64_t startPosition, uint64_t samples) const;
 
 		//! Pushes the given sample onto the FIFO buffer.
-		void PushSample(double sample);
+		void PushSample(T sample);
 
 		//! Pushes the given samples onto the FIFO buffer.
-		void PushBuffer(double* buffer, std::size_t size);
+		void PushBuffer(T* buffer, std::size_t size);
 
 		//! Pushes the given samples onto the FIFO buffer.
-		void PushBuffer(const std::vector<double>& buffer);
+		void PushBuffer(const std::vector<T>& buffer);
 
 		//! Pushes the given samples onto the FIFO buffer.
 		//
 		//! Note that if the "buffer" argument contains more than the "size" argument samples, only the first 
 		//! "size" samples of the "buffer" will be pushed.
-		void PushBuffer(const std::vector<double>& buffer, std::size_t size);
+		void PushBuffer(const std::vector<T>& buffer, std::size_t size);
 
 		//! Appends the given AudioData samples to the buffer.
-		void Append(const AudioData& audioData);
+		void Append(const BasicAudioData& audioData);
+
+		//! Appends the viewed samples to the buffer.
+		void Append(const BasicAudioDataView<T>& audioData);
 
 		//! Retrieves the given number of samples from the beginning of the FIFO buffer.
 		//
 		//! The retrived samples are returned in an AudioData object.  Note that the retrieved samples are 
 		//! not removed from the object upon which Retrieve is called.
-		AudioData Retrieve(uint64_t samples) const;
+		BasicAudioData Retrieve(uint64_t samples) const;
 
 		//! Retrieves the given number of samples starting at the given start position.
 		//
 		//! The retrived samples are returned in an AudioData object.  Note that the retrieved samples are 
 		//! not removed from the object upon which Retrieve is called.
-		AudioData Retrieve(uint64_t startPosition, uint64_t samples) const;
+		BasicAudioData Retrieve(uint64_t startPosition, uint64_t samples) const;
 
 		//! Retrieves (and removes) the given number of samples
 		//
 		//! The samples retrieved are returned in an AudioData object.  These same samples are removed from 
 		//! the object upon which Retrieve is called.
-		AudioData RetrieveRemove(uint64_t samples);
+		BasicAudioData RetrieveRemove(uint64_t samples);
 
 		//! Truncates the size of the AudioData to the newSize number of samples.
 		//	
@@ -118,17 +172,17 @@ class AudioData
 		void Truncate(std::size_t newSize);
 
 		//! Mixes the given audio data with the object's current audio data.
-		void MixInSamples(const AudioData& audioData);
+		void MixInSamples(const BasicAudioData& audioData);
 
 		//! Mixes the given audio data with the object's current audio data.
-		void MixInSamples(const double* buffer, std::size_t samples);
+		void MixInSamples(const T* buffer, std::size_t samples);
 
 		//! Moves the last given number of samples into targetAudioData.
 		//
 		//! By "last given number of samples" we mean the samples at the very end of the buffer are moved into 
 		//! the targetAudioData.  These samples are then removed from the source buffer upon which this method 
 		//! was called.
-		void MoveLastSamples(std::size_t samples, AudioData& targetAudioData);
+		void MoveLastSamples(std::size_t samples, BasicAudioData& targetAudioData);
 
 		//! Removes the given number of samples from the front of the FIFO buffer.
 		void RemoveFrontSamples(std::size_t samples);
@@ -140,7 +194,9 @@ class AudioData
 		//
 		//! This is a linear crossfade with the level of the internal audio data starting at 100% and 
 		//! ending at 0%, and the level of the given audio starting at a 0% level and ending at 100%.
-		void LinearCrossfade(AudioData& audioData);
+		//! The levels are stepped incrementally, which may differ from dividing by the crossfade 
+		//! length at each sample by a few ULPs.
+		void LinearCrossfade(BasicAudioData& audioData);
 
 		//! Amplifies the audio by the given ratio.
 		//
@@ -152,18 +208,43 @@ class AudioData
 		//
 		//! By example, a beginRatio of 0.75 and endRatio of 1.25 would reduce the audio at the very 
 		//! beginning by 25%, would be unchanged at the midpoint and would be amplified by 25% at the 
-		//! very end.
+		//! very end.  The ratio is stepped incrementally, which may differ from dividing by the buffer 
+		//! length at each sample by a few ULPs.
 		void Amplify(double beginRatio, double endRatio);
 
 	private:
-		std::vector<double> data_;
+		// Moves the live samples to the beginning of data_, reclaiming the storage of samples that 
+		// were removed from the front of the buffer.
+		void CompactFrontSamples() const;
+
+		// Makes sure appending the given number of samples will not reallocate data_ while it still 
+		// holds samples that were removed from the front of the buffer.
+		void PrepareForAppend(std::size_t samples);
+
+		// The samples in data_ before head_ have been removed from the FIFO buffer and are waiting to 
+		// be reclaimed.  These are mutable since GetData() reclaims them lazily.
+		mutable StorageType data_;
+		mutable std::size_t head_{0};
 
 };
 
+//! Audio data with 64 bit floating point samples.
+using AudioData = BasicAudioData<double>;
+
+//! Audio data with 32 bit floating point samples.
+using AudioDataFloat = BasicAudioData<float>;
+
+//! Audio data with 64 bit floating point samples stored in the calling thread's memory pool.
+using PooledAudioData = BasicAudioData<double, Utilities::PoolAllocator<double>>;
+
+//! Audio data with 32 bit floating point samples stored in the calling thread's memory pool.
+using PooledAudioDataFloat = BasicAudioData<float, Utilities::PoolAllocator<float>>;
+
 //! Linearly crossfades param1's audio with param2's audio returning the results.
 //
 //! Param1's audio is at 100% at the start and 0% at the end.  Param2's audio is 
 //! at 0% at the start and 100% at the end.  If param1's audio is length doesn't 
 //! match param2's length we start mixing at sample number zero of both audio 
 //! inputs and crossfade over the shortest duration.
-AudioData LinearCrossfade(const AudioData&, const AudioData&);
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator> LinearCrossfade(const BasicAudioData<T, Allocator>&, const BasicAudioData<T, Allocator>&);
@@ -0,0 +1,385 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioDataImplementation.h
+//! @brief The definitions of the BasicAudioData members.
+//!
+//! AudioData.cpp explicitly instantiates BasicAudioData for double and float samples with 
+//! std::allocator and Utilities::PoolAllocator.  To use BasicAudioData with another allocator, 
+//! include this file in a single translation unit and explicitly instantiate it there, e.g.
+//! "template class BasicAudioData<double, MyAllocator<double>>;".
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <AudioData/Source/AudioDataKernels.h>
+#include <Utilities/Exception.h>
+#include <memory>
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData() { }
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData(const Allocator& allocator) : data_(allocator) { }
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData(const std::vector<T>& data) : data_(data.begin(), data.end()) { }
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData(const T* data, std::size_t samples) : data_(data, data + samples) { }
+
+// Only the live samples are copied, the samples waiting to be reclaimed are left behind
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData(const BasicAudioData<T, Allocator>& audioData) : 
+	data_(audioData.data_.begin() + audioData.head_, audioData.data_.end(), 
+		  std::allocator_traits<Allocator>::select_on_container_copy_construction(audioData.data_.get_allocator())) { }
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::BasicAudioData(BasicAudioData<T, Allocator>&& audioData) : data_(std::move(audioData.data_)), head_(audioData.head_)
+{
+	audioData.data_.clear();
+	audioData.head_ = 0;
+}
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>::~BasicAudioData() { }
+
+// Uses the copy-and-swap idiom
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator>& BasicAudioData<T, Allocator>::operator=(BasicAudioData<T, Allocator> audioData)
+{
+	std::swap(data_, audioData.data_);
+	std::swap(head_, audioData.head_);
+	return *this;
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::AddSilence(uint64_t sampleCount)
+{
+	PrepareForAppend(static_cast<std::size_t>(sampleCount));
+	data_.resize(data_.size() + sampleCount, 0.0);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::PushSample(T sample)
+{
+	PrepareForAppend(1);
+	data_.push_back(sample);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::PushBuffer(T* buffer, std::size_t size)
+{
+	PrepareForAppend(size);
+	data_.insert(data_.end(), buffer, buffer + size);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::PushBuffer(const std::vector<T>& buffer)
+{
+	PrepareForAppend(buffer.size());
+	data_.insert(data_.end(), buffer.begin(), buffer.end());
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::PushBuffer(const std::vector<T>& buffer, std::size_t size)
+{
+	PrepareForAppend(size);
+	data_.insert(data_.end(), buffer.begin(), buffer.begin() + size);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Append(const BasicAudioData<T, Allocator>& audioData)
+{
+	// Inserting a range of the vector into itself isn't allowed, so append a copy instead
+	if(&audioData == this)
+	{
+		Append(BasicAudioData<T, Allocator>{audioData});
+		return;
+	}
+
+	PrepareForAppend(audioData.GetSize());
+	data_.insert(data_.end(), audioData.data_.begin() + audioData.head_, audioData.data_.end());
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Append(const BasicAudioDataView<T>& audioData)
+{
+	// The view may be of this buffer's own samples, which a reallocation would invalidate
+	const T* viewStart{audioData.GetDataPointer()};
+	if(viewStart >= data_.data() && viewStart < (data_.data() + data_.size()))
+	{
+		auto copy{audioData.ToAudioData()};
+		Append(copy.View());
+		return;
+	}
+
+	PrepareForAppend(audioData.GetSize());
+	if(audioData.IsContiguous())
+	{
+		data_.insert(data_.end(), viewStart, viewStart + audioData.GetSize());
+		return;
+	}
+
+	for(std::size_t i{0}; i < audioData.GetSize(); ++i)
+	{
+		data_.push_back(audioData[i]);
+	}
+}
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator> BasicAudioData<T, Allocator>::Retrieve(uint64_t samples) const
+{
+	return Retrieve(0, samples);
+}
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator> BasicAudioData<T, Allocator>::RetrieveRemove(uint64_t samples)
+{
+	BasicAudioData<T, Allocator> audioData{Retrieve(samples)};
+
+	RemoveFrontSamples(samples);
+
+	return audioData;
+}
+
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator> BasicAudioData<T, Allocator>::Retrieve(uint64_t startPosition, uint64_t samples) const
+{
+	if((startPosition + samples) > GetSize())
+	{
+		Utilities::ThrowException("Attempting to retrieve more samples than exist", GetSize(), startPosition, samples);
+	}
+
+	return BasicAudioData<T, Allocator>{GetDataPointer() + startPosition, static_cast<std::size_t>(samples)};
+}
+
+template<typename T, typename Allocator>
+BasicAudioDataView<T> BasicAudioData<T, Allocator>::View() const
+{
+	return BasicAudioDataView<T>{GetDataPointer(), GetSize()};
+}
+
+template<typename T, typename Allocator>
+BasicAudioDataView<T> BasicAudioData<T, Allocator>::View(uint64_t startPosition, uint64_t samples) const
+{
+	if((startPosition + samples) > GetSize())
+	{
+		Utilities::ThrowException("Attempting to view more samples than exist", GetSize(), startPosition, samples);
+	}
+
+	return BasicAudioDataView<T>{GetDataPointer() + startPosition, static_cast<std::size_t>(samples)};
+}
+
+// Moves the last given number of samples into the targetAudioData
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::MoveLastSamples(std::size_t samples, BasicAudioData<T, Allocator>& targetAudioData)
+{
+	if(samples > GetSize())
+	{
+		Utilities::ThrowException("Attempting to move more samples than exist", GetSize(), samples);
+	}
+
+	targetAudioData.PushBuffer(GetDataPointerWriteAccess() + (GetSize() - samples), samples);
+
+	data_.resize(data_.size() - samples);	
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::MixInSamples(const T* buffer, std::size_t samples)
+{
+	auto shorterOfTwo = samples;
+	if(GetSize() < samples)
+	{
+		shorterOfTwo = GetSize();
+	}
+
+	// Mix the buffers
+	AudioDataKernels::Mix(GetDataPointerWriteAccess(), buffer, shorterOfTwo);
+
+	// Add any remaining input samples
+	if(shorterOfTwo < samples)
+	{
+		PrepareForAppend(samples - shorterOfTwo);
+		data_.insert(data_.end(), buffer + shorterOfTwo, buffer + samples);
+	}	
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::MixInSamples(const BasicAudioData<T, Allocator>& audioData)
+{
+	MixInSamples(audioData.GetDataPointer(), audioData.GetSize());
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::RemoveFrontSamples(std::size_t samples)
+{
+	if(samples >= GetSize())
+	{
+		Clear();
+		return;
+	}
+
+	head_ += samples;
+
+	// Reclaim the removed samples once they make up over half of the storage.  The samples 
+	// moved are always fewer than the samples removed since the last reclaim, so removing 
+	// samples from the front remains amortized O(1).
+	if(head_ > (data_.size() / 2))
+	{
+		CompactFrontSamples();
+	}
+}
+
+template<typename T, typename Allocator>
+std::size_t BasicAudioData<T, Allocator>::GetSize() const
+{
+	return data_.size() - head_;
+}
+
+template<typename T, typename Allocator>
+const typename BasicAudioData<T, Allocator>::StorageType& BasicAudioData<T, Allocator>::GetData() const
+{
+	CompactFrontSamples();
+	return data_;
+}
+
+template<typename T, typename Allocator>
+typename BasicAudioData<T, Allocator>::StorageType& BasicAudioData<T, Allocator>::GetDataWriteAccess()
+{
+	CompactFrontSamples();
+	return data_;
+}
+
+template<typename T, typename Allocator>
+const T* BasicAudioData<T, Allocator>::GetDataPointer() const
+{
+	return data_.data() + head_;
+}
+
+template<typename T, typename Allocator>
+T* BasicAudioData<T, Allocator>::GetDataPointerWriteAccess()
+{
+	return data_.data() + head_;
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Clear()
+{
+	data_.clear();
+	head_ = 0;
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::LinearCrossfade(BasicAudioData<T, Allocator>& audioData)
+{
+	T* data{GetDataPointerWriteAccess()};
+	std::size_t size{GetSize()};
+	AudioDataKernels::Crossfade(data, data, audioData.GetDataPointer(), size, AudioDataKernels::CalculateRampStep(0.0, 1.0, size), true);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Amplify(double ratio)
+{
+	AudioDataKernels::Gain(GetDataPointerWriteAccess(), GetSize(), ratio);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Amplify(double beginRatio, double endRatio)
+{
+	std::size_t size{GetSize()};
+	AudioDataKernels::GainRamp(GetDataPointerWriteAccess(), size, beginRatio, AudioDataKernels::CalculateRampStep(beginRatio, endRatio, size));
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::Truncate(std::size_t newSize)
+{
+	if(newSize > GetSize())
+	{
+		return;
+	}
+
+	data_.resize(head_ + newSize);
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::CompactFrontSamples() const
+{
+	if(head_ == 0)
+	{
+		return;
+	}
+
+	data_.erase(data_.begin(), data_.begin() + head_);
+	head_ = 0;
+}
+
+template<typename T, typename Allocator>
+void BasicAudioData<T, Allocator>::PrepareForAppend(std::size_t samples)
+{
+	// A reallocation copies the whole buffer anyway, so drop the removed samples beforehand
+	if(head_ > 0 && (data_.size() + samples) > data_.capacity())
+	{
+		CompactFrontSamples();
+	}
+}
+
+// Possibilities:
+// 1) audioDataLeft and audioDataRight are the same length = simple
+// 2) audioDataLeft is longer than audioDataRight = mix audioDataRight in starting at index 0.  Crossfading 
+//    will end at the audioDataRight.GetSize()
+// 3) audioDataLeft is shorter than audioDataRight = mix audioDataRight in starting at index 0.  Crossfading 
+//    will end at the end of audioDataLeft.GetSize()
+template<typename T, typename Allocator>
+BasicAudioData<T, Allocator> LinearCrossfade(const BasicAudioData<T, Allocator>& audioDataLeft, const BasicAudioData<T, Allocator>& audioDataRight)
+{
+	BasicAudioData<T, Allocator> audioDataToReturn;
+
+	const T* audioDataLeftBuffer{audioDataLeft.GetDataPointer()};
+	const T* audioDataRightBuffer{audioDataRight.GetDataPointer()};
+
+	std::size_t crossfadeLength{audioDataLeft.GetSize()};
+	if(crossfadeLength > audioDataRight.GetSize())
+	{
+		crossfadeLength = audioDataRight.GetSize();
+	}
+
+	audioDataToReturn.AddSilence(crossfadeLength);
+	AudioDataKernels::Crossfade(audioDataToReturn.GetDataPointerWriteAccess(), audioDataLeftBuffer, audioDataRightBuffer, crossfadeLength, 
+								AudioDataKernels::CalculateRampStep(0.0, 1.0, crossfadeLength), false);
+
+	// The following if/else handles scenario 2 and 3
+	if(audioDataToReturn.GetSize() < audioDataLeft.GetSize())
+	{
+		audioDataToReturn.Append(audioDataLeft.Retrieve(audioDataToReturn.GetSize(), audioDataLeft.GetSize() - audioDataToReturn.GetSize()));
+	}
+	else if(audioDataToReturn.GetSize() < audioDataRight.GetSize())
+	{
+		audioDataToReturn.Append(audioDataRight.Retrieve(audioDataToReturn.GetSize(), audioDataRight.GetSize() - audioDataToReturn.GetSize()));
+	}
+
+	return audioDataToReturn;
+}
@@ -0,0 +1,71 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioDataQueue.h
+//! @brief A lock-free queue passing audio from a producer thread to a consumer thread.
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <Utilities/SpscQueue.h>
+
+//! A lock-free queue passing audio from a producer thread to a consumer thread.
+//
+//! The Signal processors use this between their processing (producer) side and their output 
+//! (consumer) side, so a thread reading output never waits for processing to finish.  See 
+//! Utilities::SpscQueue for the threading rules.
+
+template<typename T>
+class BasicAudioDataQueue
+{
+	public:
+		//! Instantiate an empty queue.
+		explicit BasicAudioDataQueue(Utilities::Synchronization synchronization=Utilities::Synchronization::THREAD_SAFE);
+
+		//! Pushes the given samples onto the back of the queue.  Producer only.
+		void Push(const BasicAudioData<T>& audioData);
+
+		//! Pushes the given number of samples from the given buffer onto the back of the queue.  Producer only.
+		void Push(const T* samples, std::size_t size);
+
+		//! Pops up to the given number of samples from the front of the queue.  Consumer only.
+		BasicAudioData<T> Pop(uint64_t samples);
+
+		//! Pops all samples in the queue.  Consumer only.
+		BasicAudioData<T> PopAll();
+
+		//! Returns the number of samples in the queue.
+		std::size_t GetSize() const;
+
+		//! Removes all samples.  Neither side may be using the queue at the same time.
+		void Clear();
+
+	private:
+		Utilities::SpscQueue<T> queue_;
+};
+
+using AudioDataQueue = BasicAudioDataQueue<double>;
+using AudioDataQueueFloat = BasicAudioDataQueue<float>;
@@ -0,0 +1,98 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioDataView.h
+//! @brief A non-owning, read only view of audio samples.
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <memory>
+
+template<typename T, typename Allocator=std::allocator<T>>
+class BasicAudioData;
+
+//! A non-owning, read only view of audio samples.
+//
+//! A view is simply a pointer, a sample count and a stride, allowing code that only 
+//! reads samples to work on part of an AudioData object (or any other buffer of samples) 
+//! without copying them.  The view does not keep the samples alive; it's invalidated 
+//! by anything that adds or removes samples from the underlying buffer.
+//!
+//! The stride is the distance, in samples, between consecutive samples of the view.  
+//! A stride greater than one allows viewing one channel of interleaved audio.
+
+template<typename T>
+class BasicAudioDataView
+{
+	public:
+		//! Constructs an empty view.
+		BasicAudioDataView() { }
+
+		//! Constructs a view of the given samples.
+		BasicAudioDataView(const T* data, std::size_t samples, std::size_t stride=1) : data_{data}, samples_{samples}, stride_{stride} { }
+
+		//! Constructs a view of all samples in the given vector.
+		template<typename Allocator>
+		explicit BasicAudioDataView(const std::vector<T, Allocator>& data) : data_{data.data()}, samples_{data.size()} { }
+
+		//! Returns the number of samples in the view.
+		std::size_t GetSize() const { return samples_; }
+
+		//! Returns the distance, in samples, between consecutive samples of the view.
+		std::size_t GetStride() const { return stride_; }
+
+		//! Returns true if the samples of the view are adjacent in memory.
+		bool IsContiguous() const { return stride_ == 1; }
+
+		//! Returns a pointer to the first sample of the view.
+		//
+		//! Note that consecutive samples are GetStride() samples apart.
+		const T* GetDataPointer() const { return data_; }
+
+		//! Returns the sample at the given index.  No bounds checking is performed.
+		T operator[](std::size_t index) const { return data_[index * stride_]; }
+
+		//! Returns a view of part of this view.
+		//
+		//! An exception is thrown if the given range exceeds the view.
+		BasicAudioDataView View(std::size_t startPosition, std::size_t samples) const;
+
+		//! Copies the samples of the view into a new AudioData object.
+		BasicAudioData<T> ToAudioData() const;
+
+	private:
+		const T* data_{nullptr};
+		std::size_t samples_{0};
+		std::size_t stride_{1};
+};
+
+//! A view of 64 bit floating point samples.
+using AudioDataView = BasicAudioDataView<double>;
+
+//! A view of 32 bit floating point samples.
+using AudioDataViewFloat = BasicAudioDataView<float>;
@@ -0,0 +1,107 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file SharedAudioData.h
+//! @brief Audio data shared between several owners, copied only when written to.
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <AudioData/AudioDataView.h>
+#include <memory>
+
+//! Audio data shared between several owners, copied only when written to (copy-on-write).
+//
+//! Copying a SharedAudioData doesn't copy the samples, it only adds a reference to the same 
+//! immutable buffer.  This makes it cheap to hand the same audio (e.g. a decoded file) to 
+//! several consumers.  The samples are copied the first time one owner asks for write access 
+//! while the buffer is still shared, after which that owner has a buffer of its own.
+//!
+//! Sharing is opt-in: AudioData itself always has value semantics.  The reference counting is 
+//! thread safe, so copies may be handed to other threads and read there at the same time.  A 
+//! shared buffer never has removed front samples waiting to be reclaimed, so reading it through 
+//! Get() never writes to it.  As with any object, a single SharedAudioData must not be used from 
+//! multiple threads without synchronization.
+//!
+//! IsShared(), and so GetWriteAccess(), reads the reference count without synchronizing with the 
+//! other owners.  When the other owners were released on another thread, synchronize with that 
+//! thread (e.g. join it or take a lock it released) before writing, otherwise the samples could 
+//! be written while that thread is still reading them.
+
+template<typename T>
+class BasicSharedAudioData
+{
+	public:
+		//! Constructs an empty buffer.
+		BasicSharedAudioData();
+
+		//! Takes ownership of the given audio data without copying its samples.
+		BasicSharedAudioData(BasicAudioData<T>&& audioData);
+
+		//! Copies the given audio data into a new shared buffer.
+		BasicSharedAudioData(const BasicAudioData<T>& audioData);
+
+		//! Shares the other owner's buffer without copying its samples.
+		BasicSharedAudioData(const BasicSharedAudioData& other);
+
+		//! Shares the other owner's buffer without copying its samples.
+		BasicSharedAudioData& operator=(const BasicSharedAudioData& other);
+
+		BasicSharedAudioData(BasicSharedAudioData&& other) = default;
+		BasicSharedAudioData& operator=(BasicSharedAudioData&& other) = default;
+
+		//! Returns the number of samples.
+		std::size_t GetSize() const;
+
+		//! Returns read only access to the audio data.  This never copies.
+		const BasicAudioData<T>& Get() const;
+
+		//! Returns a read only view of all samples.  This never copies.
+		BasicAudioDataView<T> View() const;
+
+		//! Returns write access to the audio data, first copying it if it's shared with other owners.
+		//
+		//! The reference is invalidated when this object is copied, assigned or destroyed.
+		BasicAudioData<T>& GetWriteAccess();
+
+		//! Returns true if other owners share this buffer.
+		bool IsShared() const;
+
+		//! Returns the audio data, moving it out if this is the only owner and copying it otherwise.
+		//
+		//! This object is left empty.
+		BasicAudioData<T> Release();
+
+	private:
+		// Only written to through GetWriteAccess(), once no other owner shares it
+		std::shared_ptr<BasicAudioData<T>> data_;
+};
+
+//! Shared audio data with 64 bit floating point samples.
+using SharedAudioData = BasicSharedAudioData<double>;
+
+//! Shared audio data with 32 bit floating point samples.
+using SharedAudioDataFloat = BasicSharedAudioData<float>;
@@ -0,0 +1,163 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/AudioBuffer.h>
+#include <Utilities/Exception.h>
+
+AudioBuffer::AudioBuffer() { }
+
+AudioBuffer::AudioBuffer(std::size_t channels, std::size_t frames, Layout layout) : 
+	channels_{channels}, frames_{frames}, layout_{layout}, data_(channels * frames, 0.0) { }
+
+AudioBuffer::AudioBuffer(const std::vector<AudioData>& channels, Layout layout) : layout_{layout}
+{
+	channels_ = channels.size();
+	frames_ = channels_ ? channels[0].GetSize() : 0;
+
+	for(const auto& channel : channels)
+	{
+		if(channel.GetSize() != frames_)
+		{
+			Utilities::ThrowException("AudioBuffer given channels of differing sizes", frames_, channel.GetSize());
+		}
+	}
+
+	data_.resize(channels_ * frames_);
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		SetChannelSamples(channel, channels[channel].View());
+	}
+}
+
+std::size_t AudioBuffer::GetChannels() const
+{
+	return channels_;
+}
+
+std::size_t AudioBuffer::GetFrames() const
+{
+	return frames_;
+}
+
+AudioBuffer::Layout AudioBuffer::GetLayout() const
+{
+	return layout_;
+}
+
+const double* AudioBuffer::GetDataPointer() const
+{
+	return data_.data();
+}
+
+double* AudioBuffer::GetDataPointerWriteAccess()
+{
+	return data_.data();
+}
+
+double AudioBuffer::GetSample(std::size_t channel, std::size_t frame) const
+{
+	return data_[GetSampleIndex(channel, frame)];
+}
+
+void AudioBuffer::SetSample(std::size_t channel, std::size_t frame, double sample)
+{
+	data_[GetSampleIndex(channel, frame)] = sample;
+}
+
+AudioDataView AudioBuffer::GetChannelView(std::size_t channel) const
+{
+	CheckChannel(channel);
+
+	if(layout_ == Layout::INTERLEAVED)
+	{
+		return AudioDataView{data_.data() + channel, frames_, channels_};
+	}
+
+	return AudioDataView{data_.data() + (channel * frames_), frames_};
+}
+
+void AudioBuffer::SetChannelSamples(std::size_t channel, const AudioDataView& samples, std::size_t startFrame)
+{
+	CheckChannel(channel);
+
+	if((startFrame + samples.GetSize()) > frames_)
+	{
+		Utilities::ThrowException("Attempting to set more samples than the AudioBuffer channel holds", frames_, startFrame, samples.GetSize());
+	}
+
+	std::size_t stride{layout_ == Layout::INTERLEAVED ? channels_ : 1};
+	double* target{data_.data() + GetSampleIndex(channel, startFrame)};
+	for(std::size_t i{0}; i < samples.GetSize(); ++i)
+	{
+		target[i * stride] = samples[i];
+	}
+}
+
+AudioData AudioBuffer::GetChannelAudioData(std::size_t channel) const
+{
+	return GetChannelView(channel).ToAudioData();
+}
+
+std::vector<AudioData> AudioBuffer::GetAllChannelsAudioData() const
+{
+	std::vector<AudioData> channels;
+	channels.reserve(channels_);
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		channels.push_back(GetChannelAudioData(channel));
+	}
+
+	return channels;
+}
+
+AudioBuffer AudioBuffer::ConvertLayout(Layout layout) const
+{
+	AudioBuffer converted{channels_, frames_, layout};
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		converted.SetChannelSamples(channel, GetChannelView(channel));
+	}
+
+	return converted;
+}
+
+std::size_t AudioBuffer::GetSampleIndex(std::size_t channel, std::size_t frame) const
+{
+	if(layout_ == Layout::INTERLEAVED)
+	{
+		return (frame * channels_) + channel;
+	}
+
+	return (channel * frames_) + frame;
+}
+
+void AudioBuffer::CheckChannel(std::size_t channel) const
+{
+	if(channel >= channels_)
+	{
+		Utilities::ThrowException("AudioBuffer channel does not exist", channels_, channel);
+	}
+}
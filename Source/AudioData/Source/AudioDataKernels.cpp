@@ -0,0 +1,169 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/Source/AudioDataKernels.h>
+#include <Utilities/Exception.h>
+#include <atomic>
+
+#include <AudioData/Source/AudioDataKernelsVector.h>
+
+namespace
+{
+	// The scalar "lanes" are a single sample wide.  Running the shared kernel loops with these gives 
+	// the reference implementation the vectorized kernels are tested against.
+	struct ScalarDouble
+	{
+		using Vector = double;
+		static const std::size_t LANES{1};
+		static double Load(const double* data) { return *data; }
+		static double Load(const float* data) { return *data; }
+		static void Store(double* data, double value) { *data = value; }
+		static void Store(float* data, double value) { *data = static_cast<float>(value); }
+		static double Set(double value) { return value; }
+		static double Indices() { return 0.0; }
+		static double Add(double a, double b) { return a + b; }
+		static double Sub(double a, double b) { return a - b; }
+		static double Mul(double a, double b) { return a * b; }
+		static double Clamp(double value) { return ClampSample(value); }
+	};
+
+	template<typename T>
+	struct ScalarNative
+	{
+		using Vector = T;
+		static const std::size_t LANES{1};
+		static T Load(const T* data) { return *data; }
+		static void Store(T* data, T value) { *data = value; }
+		static T Add(T a, T b) { return a + b; }
+		static T Clamp(T value) { return ClampSample(value); }
+	};
+
+	// Holds the currently selected instruction set, or -1 if it hasn't been detected yet
+	std::atomic<int> currentInstructionSet{-1};
+
+	template<typename T>
+	const AudioDataKernels::KernelTable<T>* GetKernels(AudioDataKernels::InstructionSet instructionSet)
+	{
+		switch(instructionSet)
+		{
+			case AudioDataKernels::InstructionSet::SSE2:
+				return AudioDataKernels::GetSSE2Kernels<T>();
+			case AudioDataKernels::InstructionSet::AVX2:
+				return AudioDataKernels::GetAVX2Kernels<T>();
+			case AudioDataKernels::InstructionSet::NEON:
+				return AudioDataKernels::GetNEONKernels<T>();
+			default:
+				return AudioDataKernels::GetScalarKernels<T>();
+		}
+	}
+
+	template<typename T>
+	const AudioDataKernels::KernelTable<T>& GetCurrentKernels()
+	{
+		return *GetKernels<T>(AudioDataKernels::GetInstructionSet());
+	}
+}
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetScalarKernels()
+{
+	return &VectorKernels<ScalarDouble, ScalarNative<T>, T>::table_;
+}
+
+AudioDataKernels::InstructionSet AudioDataKernels::GetBestInstructionSet()
+{
+	for(auto instructionSet : {InstructionSet::AVX2, InstructionSet::SSE2, InstructionSet::NEON})
+	{
+		if(IsInstructionSetSupported(instructionSet))
+		{
+			return instructionSet;
+		}
+	}
+
+	return InstructionSet::SCALAR;
+}
+
+bool AudioDataKernels::IsInstructionSetSupported(InstructionSet instructionSet)
+{
+	return GetKernels<double>(instructionSet) != nullptr;
+}
+
+AudioDataKernels::InstructionSet AudioDataKernels::GetInstructionSet()
+{
+	int instructionSet{currentInstructionSet.load(std::memory_order_relaxed)};
+	if(instructionSet < 0)
+	{
+		instructionSet = static_cast<int>(GetBestInstructionSet());
+		currentInstructionSet.store(instructionSet, std::memory_order_relaxed);
+	}
+
+	return static_cast<InstructionSet>(instructionSet);
+}
+
+void AudioDataKernels::SetInstructionSet(InstructionSet instructionSet)
+{
+	if(!IsInstructionSetSupported(instructionSet))
+	{
+		Utilities::ThrowException("Attempting to use an instruction set that isn't supported", static_cast<int>(instructionSet));
+	}
+
+	currentInstructionSet.store(static_cast<int>(instructionSet), std::memory_order_relaxed);
+}
+
+template<typename T>
+void AudioDataKernels::Gain(T* data, std::size_t samples, double ratio)
+{
+	GetCurrentKernels<T>().gain_(data, samples, ratio);
+}
+
+template<typename T>
+void AudioDataKernels::GainRamp(T* data, std::size_t samples, double beginRatio, double ratioStep)
+{
+	GetCurrentKernels<T>().gainRamp_(data, samples, beginRatio, ratioStep);
+}
+
+template<typename T>
+void AudioDataKernels::Mix(T* data, const T* buffer, std::size_t samples)
+{
+	GetCurrentKernels<T>().mix_(data, buffer, samples);
+}
+
+template<typename T>
+void AudioDataKernels::Crossfade(T* output, const T* fadeOut, const T* fadeIn, std::size_t samples, double step, bool clamp)
+{
+	GetCurrentKernels<T>().crossfade_(output, fadeOut, fadeIn, samples, step, clamp);
+}
+
+template const AudioDataKernels::KernelTable<double>* AudioDataKernels::GetScalarKernels();
+template const AudioDataKernels::KernelTable<float>* AudioDataKernels::GetScalarKernels();
+template void AudioDataKernels::Gain(double*, std::size_t, double);
+template void AudioDataKernels::Gain(float*, std::size_t, double);
+template void AudioDataKernels::GainRamp(double*, std::size_t, double, double);
+template void AudioDataKernels::GainRamp(float*, std::size_t, double, double);
+template void AudioDataKernels::Mix(double*, const double*, std::size_t);
+template void AudioDataKernels::Mix(float*, const float*, std::size_t);
+template void AudioDataKernels::Crossfade(double*, const double*, const double*, std::size_t, double, bool);
+template void AudioDataKernels::Crossfade(float*, const float*, const float*, std::size_t, double, bool);
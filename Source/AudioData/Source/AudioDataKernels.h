@@ -0,0 +1,118 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioDataKernels.h
+//! @brief Vectorized sample processing kernels used by AudioData.
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define AUDIODATA_KERNELS_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define AUDIODATA_KERNELS_NEON
+#endif
+
+//! The processing kernels behind AudioData's gain, mix and crossfade operations.
+//
+//! Each kernel has a scalar implementation along with SSE2 and AVX2 (x86-64) and NEON 
+//! (ARM64) implementations.  The best instruction set supported by the CPU is detected at 
+//! runtime the first time a kernel is called.  Clamping is done branchlessly with min/max 
+//! operations, which give the same results as the original compare-and-assign loops 
+//! (including passing NaN samples through unchanged).
+//!
+//! Gain and mixing are bit-exact with the scalar implementation.  Ramps (gain ramps and 
+//! crossfades) compute the ratio for sample i as begin + (i * step) rather than dividing 
+//! by the ramp length for each sample.  This differs from the division by at most a few 
+//! ULPs of the ratio (a relative error below 1e-15 for double samples).
+
+namespace AudioDataKernels
+{
+	enum class InstructionSet
+	{
+		SCALAR,
+		SSE2,
+		AVX2,
+		NEON
+	};
+
+	//! Returns the best instruction set supported by the CPU we're running on.
+	InstructionSet GetBestInstructionSet();
+
+	//! Returns true if the given instruction set was compiled in and is supported by the CPU.
+	bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+	//! Returns the instruction set the kernels are currently using.
+	InstructionSet GetInstructionSet();
+
+	//! Forces the kernels to use the given instruction set.  Mostly useful for testing.
+	//
+	//! An exception is thrown if the instruction set isn't supported.
+	void SetInstructionSet(InstructionSet instructionSet);
+
+	//! Multiplies the samples by ratio, clamping the results to [-1.0, 1.0].
+	template<typename T>
+	void Gain(T* data, std::size_t samples, double ratio);
+
+	//! Multiplies sample i by (beginRatio + i * ratioStep), clamping the results to [-1.0, 1.0].
+	template<typename T>
+	void GainRamp(T* data, std::size_t samples, double beginRatio, double ratioStep);
+
+	//! Adds the buffer samples to the data samples, clamping the results to [-1.0, 1.0].
+	template<typename T>
+	void Mix(T* data, const T* buffer, std::size_t samples);
+
+	//! Crossfades from fadeOut to fadeIn, where the fadeIn level of sample i is i * step.
+	//
+	//! The output may be the same buffer as fadeOut.  When clamp is true the results are 
+	//! clamped to [-1.0, 1.0].
+	template<typename T>
+	void Crossfade(T* output, const T* fadeOut, const T* fadeIn, std::size_t samples, double step, bool clamp);
+
+	//! Returns the per sample step of a ramp across the given number of samples.
+	inline double CalculateRampStep(double begin, double end, std::size_t samples)
+	{
+		return samples > 1 ? (end - begin) / static_cast<double>(samples - 1) : 0.0;
+	}
+
+	//! The table of kernels provided by a single instruction set.
+	template<typename T>
+	struct KernelTable
+	{
+		void (*gain_)(T*, std::size_t, double);
+		void (*gainRamp_)(T*, std::size_t, double, double);
+		void (*mix_)(T*, const T*, std::size_t);
+		void (*crossfade_)(T*, const T*, const T*, std::size_t, double, bool);
+	};
+
+	// Each returns nullptr when the instruction set isn't compiled in for this platform or isn't 
+	// supported by the CPU.
+	template<typename T> const KernelTable<T>* GetScalarKernels();
+	template<typename T> const KernelTable<T>* GetSSE2Kernels();
+	template<typename T> const KernelTable<T>* GetAVX2Kernels();
+	template<typename T> const KernelTable<T>* GetNEONKernels();
+}
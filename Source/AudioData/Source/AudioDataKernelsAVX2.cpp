@@ -0,0 +1,123 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/Source/AudioDataKernels.h>
+
+#if defined(AUDIODATA_KERNELS_X86)
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define AUDIODATA_KERNEL_TARGET
+#else
+	#define AUDIODATA_KERNEL_TARGET __attribute__((target("avx2")))
+#endif
+
+#include <AudioData/Source/AudioDataKernelsVector.h>
+
+// Only the functions in this file marked with AUDIODATA_KERNEL_TARGET are compiled for AVX2, so 
+// the rest of the library still runs on CPUs without it.
+
+namespace
+{
+	struct AVX2Double
+	{
+		using Vector = __m256d;
+		static const std::size_t LANES{4};
+		AUDIODATA_KERNEL_TARGET static Vector Load(const double* data) { return _mm256_loadu_pd(data); }
+		AUDIODATA_KERNEL_TARGET static Vector Load(const float* data) { return _mm256_cvtps_pd(_mm_loadu_ps(data)); }
+		AUDIODATA_KERNEL_TARGET static void Store(double* data, Vector value) { _mm256_storeu_pd(data, value); }
+		AUDIODATA_KERNEL_TARGET static void Store(float* data, Vector value) { _mm_storeu_ps(data, _mm256_cvtpd_ps(value)); }
+		AUDIODATA_KERNEL_TARGET static Vector Set(double value) { return _mm256_set1_pd(value); }
+		AUDIODATA_KERNEL_TARGET static Vector Indices() { return _mm256_set_pd(3.0, 2.0, 1.0, 0.0); }
+		AUDIODATA_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+		AUDIODATA_KERNEL_TARGET static Vector Sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+		AUDIODATA_KERNEL_TARGET static Vector Mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+
+		// The sample is the second operand so a NaN sample is what gets returned
+		AUDIODATA_KERNEL_TARGET static Vector Clamp(Vector value) { return _mm256_min_pd(Set(1.0), _mm256_max_pd(Set(-1.0), value)); }
+	};
+
+	template<typename T> struct AVX2Native;
+
+	template<>
+	struct AVX2Native<double>
+	{
+		using Vector = __m256d;
+		static const std::size_t LANES{4};
+		AUDIODATA_KERNEL_TARGET static Vector Load(const double* data) { return _mm256_loadu_pd(data); }
+		AUDIODATA_KERNEL_TARGET static void Store(double* data, Vector value) { _mm256_storeu_pd(data, value); }
+		AUDIODATA_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+		AUDIODATA_KERNEL_TARGET static Vector Clamp(Vector value) { return AVX2Double::Clamp(value); }
+	};
+
+	template<>
+	struct AVX2Native<float>
+	{
+		using Vector = __m256;
+		static const std::size_t LANES{8};
+		AUDIODATA_KERNEL_TARGET static Vector Load(const float* data) { return _mm256_loadu_ps(data); }
+		AUDIODATA_KERNEL_TARGET static void Store(float* data, Vector value) { _mm256_storeu_ps(data, value); }
+		AUDIODATA_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+		AUDIODATA_KERNEL_TARGET static Vector Clamp(Vector value) { return _mm256_min_ps(_mm256_set1_ps(1.0f), _mm256_max_ps(_mm256_set1_ps(-1.0f), value)); }
+	};
+
+	bool CpuSupportsAVX2()
+	{
+#if defined(_MSC_VER)
+		// AVX2 needs both the CPU support (leaf 7 EBX bit 5) and the OS saving the YMM registers (OSXSAVE 
+		// set and XCR0 bits 1 and 2 set).
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 1);
+		bool osSavesYmmRegisters{(cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6};
+		__cpuidex(cpuInfo, 7, 0);
+		return osSavesYmmRegisters && (cpuInfo[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+}
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetAVX2Kernels()
+{
+	static const bool supported{CpuSupportsAVX2()};
+	return supported ? &VectorKernels<AVX2Double, AVX2Native<T>, T>::table_ : nullptr;
+}
+
+#else
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetAVX2Kernels()
+{
+	return nullptr;
+}
+
+#endif
+
+template const AudioDataKernels::KernelTable<double>* AudioDataKernels::GetAVX2Kernels();
+template const AudioDataKernels::KernelTable<float>* AudioDataKernels::GetAVX2Kernels();
@@ -0,0 +1,99 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/Source/AudioDataKernels.h>
+
+#if defined(AUDIODATA_KERNELS_NEON)
+
+#include <arm_neon.h>
+#include <AudioData/Source/AudioDataKernelsVector.h>
+
+// NEON (Advanced SIMD) is part of the ARM64 baseline so no special compiler attributes are needed 
+// and the CPU never has to be checked for support.
+
+namespace
+{
+	struct NEONDouble
+	{
+		using Vector = float64x2_t;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return vld1q_f64(data); }
+		static Vector Load(const float* data) { return vcvt_f64_f32(vld1_f32(data)); }
+		static void Store(double* data, Vector value) { vst1q_f64(data, value); }
+		static void Store(float* data, Vector value) { vst1_f32(data, vcvt_f32_f64(value)); }
+		static Vector Set(double value) { return vdupq_n_f64(value); }
+		static Vector Indices() { return vcombine_f64(vdup_n_f64(0.0), vdup_n_f64(1.0)); }
+		static Vector Add(Vector a, Vector b) { return vaddq_f64(a, b); }
+		static Vector Sub(Vector a, Vector b) { return vsubq_f64(a, b); }
+		static Vector Mul(Vector a, Vector b) { return vmulq_f64(a, b); }
+
+		// FMIN/FMAX return NaN if either operand is NaN, so NaN samples pass through
+		static Vector Clamp(Vector value) { return vminq_f64(Set(1.0), vmaxq_f64(Set(-1.0), value)); }
+	};
+
+	template<typename T> struct NEONNative;
+
+	template<>
+	struct NEONNative<double>
+	{
+		using Vector = float64x2_t;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return vld1q_f64(data); }
+		static void Store(double* data, Vector value) { vst1q_f64(data, value); }
+		static Vector Add(Vector a, Vector b) { return vaddq_f64(a, b); }
+		static Vector Clamp(Vector value) { return NEONDouble::Clamp(value); }
+	};
+
+	template<>
+	struct NEONNative<float>
+	{
+		using Vector = float32x4_t;
+		static const std::size_t LANES{4};
+		static Vector Load(const float* data) { return vld1q_f32(data); }
+		static void Store(float* data, Vector value) { vst1q_f32(data, value); }
+		static Vector Add(Vector a, Vector b) { return vaddq_f32(a, b); }
+		static Vector Clamp(Vector value) { return vminq_f32(vdupq_n_f32(1.0f), vmaxq_f32(vdupq_n_f32(-1.0f), value)); }
+	};
+}
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetNEONKernels()
+{
+	return &VectorKernels<NEONDouble, NEONNative<T>, T>::table_;
+}
+
+#else
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetNEONKernels()
+{
+	return nullptr;
+}
+
+#endif
+
+template const AudioDataKernels::KernelTable<double>* AudioDataKernels::GetNEONKernels();
+template const AudioDataKernels::KernelTable<float>* AudioDataKernels::GetNEONKernels();
@@ -0,0 +1,99 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/Source/AudioDataKernels.h>
+
+#if defined(AUDIODATA_KERNELS_X86)
+
+#include <emmintrin.h>
+#include <AudioData/Source/AudioDataKernelsVector.h>
+
+// SSE2 is part of the x86-64 baseline so no special compiler attributes are needed and the CPU 
+// never has to be checked for support.
+
+namespace
+{
+	struct SSE2Double
+	{
+		using Vector = __m128d;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return _mm_loadu_pd(data); }
+		static Vector Load(const float* data) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)))); }
+		static void Store(double* data, Vector value) { _mm_storeu_pd(data, value); }
+		static void Store(float* data, Vector value) { _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_castps_si128(_mm_cvtpd_ps(value))); }
+		static Vector Set(double value) { return _mm_set1_pd(value); }
+		static Vector Indices() { return _mm_set_pd(1.0, 0.0); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+		static Vector Sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+		static Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+
+		// The sample is the second operand so a NaN sample is what gets returned
+		static Vector Clamp(Vector value) { return _mm_min_pd(Set(1.0), _mm_max_pd(Set(-1.0), value)); }
+	};
+
+	template<typename T> struct SSE2Native;
+
+	template<>
+	struct SSE2Native<double>
+	{
+		using Vector = __m128d;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return _mm_loadu_pd(data); }
+		static void Store(double* data, Vector value) { _mm_storeu_pd(data, value); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+		static Vector Clamp(Vector value) { return SSE2Double::Clamp(value); }
+	};
+
+	template<>
+	struct SSE2Native<float>
+	{
+		using Vector = __m128;
+		static const std::size_t LANES{4};
+		static Vector Load(const float* data) { return _mm_loadu_ps(data); }
+		static void Store(float* data, Vector value) { _mm_storeu_ps(data, value); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+		static Vector Clamp(Vector value) { return _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_set1_ps(-1.0f), value)); }
+	};
+}
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetSSE2Kernels()
+{
+	return &VectorKernels<SSE2Double, SSE2Native<T>, T>::table_;
+}
+
+#else
+
+template<typename T>
+const AudioDataKernels::KernelTable<T>* AudioDataKernels::GetSSE2Kernels()
+{
+	return nullptr;
+}
+
+#endif
+
+template const AudioDataKernels::KernelTable<double>* AudioDataKernels::GetSSE2Kernels();
+template const AudioDataKernels::KernelTable<float>* AudioDataKernels::GetSSE2Kernels();
@@ -0,0 +1,143 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file AudioDataKernelsVector.h
+//! @brief The kernel loops shared by each instruction set's implementation.
+//
+//! Each instruction set's translation unit defines AUDIODATA_KERNEL_TARGET (the function 
+//! attributes needed to compile for that instruction set), defines its lane traits and 
+//! then includes this file.  Everything here has internal linkage on purpose.  The same 
+//! code is compiled for different instruction sets in different translation units and 
+//! those copies must never be merged by the linker.
+//!
+//! A "double lanes" traits class (D below) loads samples of either type as doubles, which 
+//! is what keeps the vector kernels bit-exact with the scalar ones.  A "native lanes" traits 
+//! class (N below) works on samples in their own type, which is all mixing needs.
+
+#pragma once
+
+#include <AudioData/Source/AudioDataKernels.h>
+
+#ifndef AUDIODATA_KERNEL_TARGET
+	#define AUDIODATA_KERNEL_TARGET
+#endif
+
+namespace
+{
+	// Clamps the sample to [-1.0, 1.0].  Written as selects rather than branches so compilers emit 
+	// min/max instructions.  Like the compares it replaces, a NaN sample is passed through unchanged.
+	template<typename T>
+	AUDIODATA_KERNEL_TARGET inline T ClampSample(T sample)
+	{
+		sample = sample > T{1} ? T{1} : sample;
+		return sample < T{-1} ? T{-1} : sample;
+	}
+
+	template<typename D, typename T>
+	AUDIODATA_KERNEL_TARGET void GainKernel(T* data, std::size_t samples, double ratio)
+	{
+		std::size_t i{0};
+		const auto ratioVector(D::Set(ratio));
+		for(; i + D::LANES <= samples; i += D::LANES)
+		{
+			D::Store(data + i, D::Clamp(D::Mul(D::Load(data + i), ratioVector)));
+		}
+
+		for(; i < samples; ++i)
+		{
+			data[i] = static_cast<T>(ClampSample(data[i] * ratio));
+		}
+	}
+
+	template<typename D, typename T>
+	AUDIODATA_KERNEL_TARGET void GainRampKernel(T* data, std::size_t samples, double beginRatio, double ratioStep)
+	{
+		std::size_t i{0};
+		const auto beginVector(D::Set(beginRatio));
+		const auto stepVector(D::Set(ratioStep));
+		const auto laneCount(D::Set(static_cast<double>(D::LANES)));
+		auto indices(D::Indices());
+		for(; i + D::LANES <= samples; i += D::LANES)
+		{
+			auto ratio(D::Add(beginVector, D::Mul(indices, stepVector)));
+			D::Store(data + i, D::Clamp(D::Mul(D::Load(data + i), ratio)));
+			indices = D::Add(indices, laneCount);
+		}
+
+		for(; i < samples; ++i)
+		{
+			data[i] = static_cast<T>(ClampSample(data[i] * (beginRatio + (static_cast<double>(i) * ratioStep))));
+		}
+	}
+
+	template<typename N, typename T>
+	AUDIODATA_KERNEL_TARGET void MixKernel(T* data, const T* buffer, std::size_t samples)
+	{
+		std::size_t i{0};
+		for(; i + N::LANES <= samples; i += N::LANES)
+		{
+			N::Store(data + i, N::Clamp(N::Add(N::Load(data + i), N::Load(buffer + i))));
+		}
+
+		for(; i < samples; ++i)
+		{
+			data[i] = ClampSample(static_cast<T>(data[i] + buffer[i]));
+		}
+	}
+
+	template<typename D, typename T>
+	AUDIODATA_KERNEL_TARGET void CrossfadeKernel(T* output, const T* fadeOut, const T* fadeIn, std::size_t samples, double step, bool clamp)
+	{
+		std::size_t i{0};
+		const auto one(D::Set(1.0));
+		const auto stepVector(D::Set(step));
+		const auto laneCount(D::Set(static_cast<double>(D::LANES)));
+		auto indices(D::Indices());
+		for(; i + D::LANES <= samples; i += D::LANES)
+		{
+			auto fadeInLevel(D::Mul(indices, stepVector));
+			auto sample(D::Add(D::Mul(D::Load(fadeOut + i), D::Sub(one, fadeInLevel)), D::Mul(D::Load(fadeIn + i), fadeInLevel)));
+			D::Store(output + i, clamp ? D::Clamp(sample) : sample);
+			indices = D::Add(indices, laneCount);
+		}
+
+		for(; i < samples; ++i)
+		{
+			double fadeInLevel{static_cast<double>(i) * step};
+			double sample{(fadeOut[i] * (1.0 - fadeInLevel)) + (fadeIn[i] * fadeInLevel)};
+			output[i] = static_cast<T>(clamp ? ClampSample(sample) : sample);
+		}
+	}
+
+	template<typename D, typename N, typename T>
+	struct VectorKernels
+	{
+		static const AudioDataKernels::KernelTable<T> table_;
+	};
+
+	template<typename D, typename N, typename T>
+	const AudioDataKernels::KernelTable<T> VectorKernels<D, N, T>::table_{&GainKernel<D, T>, &GainRampKernel<D, T>, &MixKernel<N, T>, &CrossfadeKernel<D, T>};
+}
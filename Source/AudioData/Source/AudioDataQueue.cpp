@@ -0,0 +1,76 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/AudioDataQueue.h>
+
+template<typename T>
+BasicAudioDataQueue<T>::BasicAudioDataQueue(Utilities::Synchronization synchronization) : queue_{synchronization} { }
+
+template<typename T>
+void BasicAudioDataQueue<T>::Push(const BasicAudioData<T>& audioData)
+{
+	queue_.Push(audioData.GetDataPointer(), audioData.GetSize());
+}
+
+template<typename T>
+void BasicAudioDataQueue<T>::Push(const T* samples, std::size_t size)
+{
+	queue_.Push(samples, size);
+}
+
+template<typename T>
+BasicAudioData<T> BasicAudioDataQueue<T>::Pop(uint64_t samples)
+{
+	// Only the consumer pops, so at least GetSize() samples are guaranteed to be there
+	std::size_t available{queue_.GetSize()};
+	std::size_t samplesToPop{samples < available ? static_cast<std::size_t>(samples) : available};
+
+	BasicAudioData<T> audioData;
+	audioData.AddSilence(samplesToPop);
+	queue_.Pop(audioData.GetDataPointerWriteAccess(), samplesToPop);
+	return audioData;
+}
+
+template<typename T>
+BasicAudioData<T> BasicAudioDataQueue<T>::PopAll()
+{
+	return Pop(queue_.GetSize());
+}
+
+template<typename T>
+std::size_t BasicAudioDataQueue<T>::GetSize() const
+{
+	return queue_.GetSize();
+}
+
+template<typename T>
+void BasicAudioDataQueue<T>::Clear()
+{
+	queue_.Clear();
+}
+
+template class BasicAudioDataQueue<double>;
+template class BasicAudioDataQueue<float>;
@@ -0,0 +1,62 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/AudioDataView.h>
+#include <AudioData/AudioData.h>
+#include <Utilities/Exception.h>
+
+template<typename T>
+BasicAudioDataView<T> BasicAudioDataView<T>::View(std::size_t startPosition, std::size_t samples) const
+{
+	if((startPosition + samples) > samples_)
+	{
+		Utilities::ThrowException("Attempting to view more samples than exist", samples_, startPosition, samples);
+	}
+
+	return BasicAudioDataView{data_ + (startPosition * stride_), samples, stride_};
+}
+
+template<typename T>
+BasicAudioData<T> BasicAudioDataView<T>::ToAudioData() const
+{
+	if(IsContiguous())
+	{
+		return BasicAudioData<T>{data_, samples_};
+	}
+
+	BasicAudioData<T> audioData;
+	std::vector<T>& samples{audioData.GetDataWriteAccess()};
+	samples.reserve(samples_);
+	for(std::size_t i{0}; i < samples_; ++i)
+	{
+		samples.push_back(data_[i * stride_]);
+	}
+
+	return audioData;
+}
+
+template class BasicAudioDataView<double>;
+template class BasicAudioDataView<float>;
@@ -0,0 +1,119 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <AudioData/SharedAudioData.h>
+
+namespace
+{
+	// Reading an AudioData's samples reclaims any removed front samples first, which writes to it.  Buffers are 
+	// reclaimed before they're shared, while only one owner refers to them, so reading shared buffers from 
+	// several threads is safe.  A buffer that's already shared has nothing to reclaim and isn't written to.
+	template<typename T>
+	void ReclaimRemovedSamples(const std::shared_ptr<BasicAudioData<T>>& audioData)
+	{
+		if(audioData)
+		{
+			static_cast<const BasicAudioData<T>&>(*audioData).GetData();
+		}
+	}
+}
+
+template<typename T>
+BasicSharedAudioData<T>::BasicSharedAudioData() : data_{std::make_shared<BasicAudioData<T>>()} { }
+
+template<typename T>
+BasicSharedAudioData<T>::BasicSharedAudioData(BasicAudioData<T>&& audioData) : 
+	data_{std::make_shared<BasicAudioData<T>>(std::move(audioData))}
+{
+	ReclaimRemovedSamples(data_);
+}
+
+// Samples removed through GetWriteAccess() are reclaimed before the buffer is shared
+template<typename T>
+BasicSharedAudioData<T>::BasicSharedAudioData(const BasicSharedAudioData& other) : data_{other.data_}
+{
+	ReclaimRemovedSamples(data_);
+}
+
+template<typename T>
+BasicSharedAudioData<T>& BasicSharedAudioData<T>::operator=(const BasicSharedAudioData& other)
+{
+	data_ = other.data_;
+	ReclaimRemovedSamples(data_);
+	return *this;
+}
+
+template<typename T>
+BasicSharedAudioData<T>::BasicSharedAudioData(const BasicAudioData<T>& audioData) : 
+	data_{std::make_shared<BasicAudioData<T>>(audioData)} { }
+
+template<typename T>
+std::size_t BasicSharedAudioData<T>::GetSize() const
+{
+	return data_->GetSize();
+}
+
+template<typename T>
+const BasicAudioData<T>& BasicSharedAudioData<T>::Get() const
+{
+	return *data_;
+}
+
+template<typename T>
+BasicAudioDataView<T> BasicSharedAudioData<T>::View() const
+{
+	return data_->View();
+}
+
+template<typename T>
+BasicAudioData<T>& BasicSharedAudioData<T>::GetWriteAccess()
+{
+	// A use count of one means no other owner exists, and since only this object refers to the 
+	// buffer no other owner can appear while we're writing to it.
+	if(IsShared())
+	{
+		data_ = std::make_shared<BasicAudioData<T>>(*data_);
+	}
+
+	return *data_;
+}
+
+template<typename T>
+bool BasicSharedAudioData<T>::IsShared() const
+{
+	return data_.use_count() > 1;
+}
+
+template<typename T>
+BasicAudioData<T> BasicSharedAudioData<T>::Release()
+{
+	BasicAudioData<T> audioData{IsShared() ? BasicAudioData<T>{*data_} : std::move(GetWriteAccess())};
+	data_ = std::make_shared<BasicAudioData<T>>();
+	return audioData;
+}
+
+template class BasicSharedAudioData<double>;
+template class BasicSharedAudioData<float>;
@@ -0,0 +1,144 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <AudioData/AudioBuffer.h>
+#include <Utilities/Exception.h>
+#include <cstdint>
+
+namespace {
+
+std::vector<AudioData> CreateStereoChannels()
+{
+	return std::vector<AudioData>{AudioData{std::vector<double>{0.1, 0.2, 0.3}}, AudioData{std::vector<double>{-0.1, -0.2, -0.3}}};
+}
+
+}
+
+TEST(AudioBufferTest, TestConstruction)
+{
+	AudioBuffer audioBuffer{2, 3};
+	EXPECT_EQ(2, audioBuffer.GetChannels());
+	EXPECT_EQ(3, audioBuffer.GetFrames());
+	EXPECT_EQ(AudioBuffer::Layout::PLANAR, audioBuffer.GetLayout());
+
+	for(std::size_t channel{0}; channel < 2; ++channel)
+	{
+		for(std::size_t frame{0}; frame < 3; ++frame)
+		{
+			EXPECT_EQ(0.0, audioBuffer.GetSample(channel, frame));
+		}
+	}
+
+	// All samples live in a single aligned allocation
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(audioBuffer.GetDataPointer()) % 64);
+}
+
+TEST(AudioBufferTest, TestPlanarLayout)
+{
+	AudioBuffer audioBuffer{CreateStereoChannels(), AudioBuffer::Layout::PLANAR};
+
+	const double* samples{audioBuffer.GetDataPointer()};
+	EXPECT_EQ(0.1, samples[0]);
+	EXPECT_EQ(0.2, samples[1]);
+	EXPECT_EQ(0.3, samples[2]);
+	EXPECT_EQ(-0.1, samples[3]);
+	EXPECT_EQ(-0.2, samples[4]);
+	EXPECT_EQ(-0.3, samples[5]);
+
+	auto rightChannel{audioBuffer.GetChannelView(1)};
+	EXPECT_TRUE(rightChannel.IsContiguous());
+	EXPECT_EQ(3, rightChannel.GetSize());
+	EXPECT_EQ(-0.2, rightChannel[1]);
+}
+
+TEST(AudioBufferTest, TestInterleavedLayout)
+{
+	AudioBuffer audioBuffer{CreateStereoChannels(), AudioBuffer::Layout::INTERLEAVED};
+
+	const double* samples{audioBuffer.GetDataPointer()};
+	EXPECT_EQ(0.1, samples[0]);
+	EXPECT_EQ(-0.1, samples[1]);
+	EXPECT_EQ(0.2, samples[2]);
+	EXPECT_EQ(-0.2, samples[3]);
+	EXPECT_EQ(0.3, samples[4]);
+	EXPECT_EQ(-0.3, samples[5]);
+
+	auto rightChannel{audioBuffer.GetChannelView(1)};
+	EXPECT_EQ(2, rightChannel.GetStride());
+	EXPECT_EQ(3, rightChannel.GetSize());
+	EXPECT_EQ(-0.1, rightChannel[0]);
+	EXPECT_EQ(-0.3, rightChannel[2]);
+
+	auto leftChannel{audioBuffer.GetChannelAudioData(0)};
+	EXPECT_EQ(3, leftChannel.GetSize());
+	EXPECT_EQ(0.1, leftChannel.GetData()[0]);
+	EXPECT_EQ(0.3, leftChannel.GetData()[2]);
+}
+
+TEST(AudioBufferTest, TestConvertLayout)
+{
+	AudioBuffer planar{CreateStereoChannels(), AudioBuffer::Layout::PLANAR};
+	auto interleaved{planar.ConvertLayout(AudioBuffer::Layout::INTERLEAVED)};
+
+	EXPECT_EQ(AudioBuffer::Layout::INTERLEAVED, interleaved.GetLayout());
+	for(std::size_t channel{0}; channel < 2; ++channel)
+	{
+		for(std::size_t frame{0}; frame < 3; ++frame)
+		{
+			EXPECT_EQ(planar.GetSample(channel, frame), interleaved.GetSample(channel, frame));
+		}
+	}
+
+	auto channels{interleaved.GetAllChannelsAudioData()};
+	EXPECT_EQ(2, channels.size());
+	EXPECT_EQ(-0.2, channels[1].GetData()[1]);
+}
+
+TEST(AudioBufferTest, TestSetChannelSamples)
+{
+	AudioBuffer audioBuffer{2, 4, AudioBuffer::Layout::INTERLEAVED};
+	AudioData audioData{std::vector<double>{0.5, 0.6}};
+
+	audioBuffer.SetChannelSamples(1, audioData.View(), 2);
+	EXPECT_EQ(0.0, audioBuffer.GetSample(1, 1));
+	EXPECT_EQ(0.5, audioBuffer.GetSample(1, 2));
+	EXPECT_EQ(0.6, audioBuffer.GetSample(1, 3));
+	EXPECT_EQ(0.0, audioBuffer.GetSample(0, 3));
+
+	audioBuffer.SetSample(0, 0, 0.9);
+	EXPECT_EQ(0.9, audioBuffer.GetDataPointer()[0]);
+}
+
+TEST(AudioBufferTest, TestErrors)
+{
+	AudioBuffer audioBuffer{2, 4};
+	AudioData audioData{std::vector<double>{0.5, 0.6}};
+
+	EXPECT_THROW(audioBuffer.GetChannelView(2), Utilities::Exception);
+	EXPECT_THROW(audioBuffer.SetChannelSamples(0, audioData.View(), 3), Utilities::Exception);
+	EXPECT_THROW(AudioBuffer(std::vector<AudioData>{AudioData{}, audioData}), Utilities::Exception);
+}
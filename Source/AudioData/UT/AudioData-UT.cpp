@@ -472,6 +472,158 @@ TEST_F(AudioDataTest, TestLinearCrossfadeHelperScenario3)
 	EXPECT_EQ(0.75, data[5]);
 }
 
+TEST_F(AudioDataTest, TestRemoveFrontSamplesThenPush)
+{
+	audioData.RemoveFrontSamples(1);
+	EXPECT_EQ(3, audioData.GetSize());
+
+	audioData.PushSample(0.9);
+	EXPECT_EQ(4, audioData.GetSize());
+
+	const double* data{audioData.GetDataPointer()};
+	EXPECT_EQ(0.6, data[0]);
+	EXPECT_EQ(0.7, data[1]);
+	EXPECT_EQ(0.8, data[2]);
+	EXPECT_EQ(0.9, data[3]);
+
+	auto retrieved{audioData.Retrieve(1, 2)};
+	EXPECT_EQ(0.7, retrieved.GetData()[0]);
+	EXPECT_EQ(0.8, retrieved.GetData()[1]);
+}
+
+TEST_F(AudioDataTest, TestFifoUsage)
+{
+	AudioData fifo;
+	double nextPushValue{0.0};
+	double nextPopValue{0.0};
+
+	// Push more than is removed so the buffer has to grow while samples are pending reclaim
+	for(std::size_t i{0}; i < 1000; ++i)
+	{
+		for(std::size_t j{0}; j < 7; ++j)
+		{
+			fifo.PushSample(nextPushValue);
+			nextPushValue += 1.0;
+		}
+
+		EXPECT_EQ(nextPopValue, fifo.GetDataPointer()[0]);
+		fifo.RemoveFrontSamples(5);
+		nextPopValue += 5.0;
+	}
+
+	EXPECT_EQ(2000, fifo.GetSize());
+
+	const std::vector<double>& data{fifo.GetData()};
+	EXPECT_EQ(2000, data.size());
+	for(std::size_t i{0}; i < data.size(); ++i)
+	{
+		EXPECT_EQ(nextPopValue + static_cast<double>(i), data[i]);
+	}
+}
+
+TEST_F(AudioDataTest, TestCopyAfterRemoveFrontSamples)
+{
+	audioData.RemoveFrontSamples(2);
+
+	AudioData copy{audioData};
+	EXPECT_EQ(2, copy.GetSize());
+	EXPECT_EQ(0.7, copy.GetDataPointer()[0]);
+	EXPECT_EQ(0.8, copy.GetDataPointer()[1]);
+
+	AudioData moved{std::move(audioData)};
+	EXPECT_EQ(0, audioData.GetSize());
+	EXPECT_EQ(2, moved.GetSize());
+	EXPECT_EQ(0.7, moved.GetData()[0]);
+	EXPECT_EQ(0.8, moved.GetData()[1]);
+
+	moved.Append(moved);
+	EXPECT_EQ(4, moved.GetSize());
+	EXPECT_EQ(0.7, moved.GetData()[2]);
+	EXPECT_EQ(0.8, moved.GetData()[3]);
+}
+
+TEST_F(AudioDataTest, TestView)
+{
+	auto view{audioData.View(1, 2)};
+	EXPECT_EQ(2, view.GetSize());
+	EXPECT_TRUE(view.IsContiguous());
+	EXPECT_EQ(0.6, view[0]);
+	EXPECT_EQ(0.7, view[1]);
+
+	// A view refers to the samples rather than copying them
+	audioData.GetDataPointerWriteAccess()[1] = 0.1;
+	EXPECT_EQ(0.1, view[0]);
+
+	auto subView{view.View(1, 1)};
+	EXPECT_EQ(1, subView.GetSize());
+	EXPECT_EQ(0.7, subView[0]);
+
+	auto copy{view.ToAudioData()};
+	EXPECT_EQ(2, copy.GetSize());
+	EXPECT_EQ(0.1, copy.GetData()[0]);
+	EXPECT_EQ(0.7, copy.GetData()[1]);
+}
+
+TEST_F(AudioDataTest, TestViewWithStride)
+{
+	// View every other sample, as would be done for one channel of interleaved stereo audio
+	AudioDataView view{audioData.GetDataPointer() + 1, 2, 2};
+	EXPECT_FALSE(view.IsContiguous());
+	EXPECT_EQ(0.6, view[0]);
+	EXPECT_EQ(0.8, view[1]);
+
+	auto copy{view.ToAudioData()};
+	EXPECT_EQ(2, copy.GetSize());
+	EXPECT_EQ(0.6, copy.GetData()[0]);
+	EXPECT_EQ(0.8, copy.GetData()[1]);
+}
+
+TEST_F(AudioDataTest, TestViewError)
+{
+	EXPECT_THROW(audioData.View(2, 3), Utilities::Exception);
+	EXPECT_THROW(audioData.View().View(4, 1), Utilities::Exception);
+}
+
+TEST(AudioDataFloatTest, TestFloatSamples)
+{
+	AudioDataFloat audioData{std::vector<float>{0.5f, 0.6f, 0.7f, 0.8f}};
+	audioData.Amplify(2.0);
+	EXPECT_EQ(4, audioData.GetSize());
+	EXPECT_FLOAT_EQ(1.0f, audioData.GetData()[0]);
+	EXPECT_FLOAT_EQ(1.0f, audioData.GetData()[3]);
+
+	audioData.RemoveFrontSamples(2);
+	auto view{audioData.View()};
+	EXPECT_EQ(2, view.GetSize());
+	EXPECT_FLOAT_EQ(1.0f, view[0]);
+
+	AudioDataFloat silence;
+	silence.AddSilence(2);
+	audioData.MixInSamples(silence);
+	EXPECT_FLOAT_EQ(1.0f, audioData.GetData()[1]);
+}
+
+TEST(PooledAudioDataTest, TestPooledSamples)
+{
+	PooledAudioData audioData{std::vector<double>{0.5, 0.6, 0.7, 0.8}};
+	EXPECT_EQ(Utilities::MemoryPool::GetThreadPool(), audioData.GetData().get_allocator().GetPool());
+
+	audioData.RemoveFrontSamples(1);
+	PooledAudioData copy{audioData};
+	EXPECT_EQ(3, copy.GetSize());
+	EXPECT_EQ(0.6, copy.GetData()[0]);
+
+	copy.Append(audioData.View());
+	EXPECT_EQ(6, copy.GetSize());
+	EXPECT_EQ(0.8, copy.GetData()[5]);
+
+	PooledAudioData assigned;
+	assigned = copy;
+	auto crossfaded{LinearCrossfade(assigned, copy)};
+	EXPECT_EQ(6, crossfaded.GetSize());
+	EXPECT_EQ(0.6, crossfaded.GetData()[0]);
+}
+
 int main(int argc, char* argv[])
 {
 	testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,170 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <AudioData/Source/AudioDataKernels.h>
+#include <Utilities/Exception.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using AudioDataKernels::InstructionSet;
+
+	// Restores the instruction set that was in use when the test started
+	class AudioDataKernelsTest : public ::testing::Test
+	{
+		protected:
+			void TearDown() override
+			{
+				AudioDataKernels::SetInstructionSet(originalInstructionSet_);
+			}
+
+			std::vector<InstructionSet> GetSupportedInstructionSets()
+			{
+				std::vector<InstructionSet> instructionSets;
+				for(auto instructionSet : {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::NEON})
+				{
+					if(AudioDataKernels::IsInstructionSetSupported(instructionSet))
+					{
+						instructionSets.push_back(instructionSet);
+					}
+				}
+
+				return instructionSets;
+			}
+
+			// Samples slightly beyond [-1.0, 1.0] so the clamping gets exercised.  The odd length 
+			// makes sure the scalar tail of the vector kernels is covered.
+			template<typename T>
+			std::vector<T> CreateSamples(std::size_t samples, unsigned int seed)
+			{
+				std::mt19937 generator{seed};
+				std::uniform_real_distribution<double> distribution{-1.2, 1.2};
+				std::vector<T> data;
+				for(std::size_t i{0}; i < samples; ++i)
+				{
+					data.push_back(static_cast<T>(distribution(generator)));
+				}
+
+				return data;
+			}
+
+			template<typename T>
+			void CheckKernelsMatchScalar()
+			{
+				const std::size_t samples{1031};
+				const auto first{CreateSamples<T>(samples, 1)};
+				const auto second{CreateSamples<T>(samples, 2)};
+
+				auto runKernels{[&](InstructionSet instructionSet)
+				{
+					AudioDataKernels::SetInstructionSet(instructionSet);
+					std::vector<std::vector<T>> results(5, first);
+					AudioDataKernels::Gain(results[0].data(), samples, 1.37);
+					AudioDataKernels::GainRamp(results[1].data(), samples, 0.25, AudioDataKernels::CalculateRampStep(0.25, 1.75, samples));
+					AudioDataKernels::Mix(results[2].data(), second.data(), samples);
+					AudioDataKernels::Crossfade(results[3].data(), first.data(), second.data(), samples, AudioDataKernels::CalculateRampStep(0.0, 1.0, samples), true);
+					AudioDataKernels::Crossfade(results[4].data(), first.data(), second.data(), samples, AudioDataKernels::CalculateRampStep(0.0, 1.0, samples), false);
+					return results;
+				}};
+
+				const auto expected{runKernels(InstructionSet::SCALAR)};
+				for(auto instructionSet : GetSupportedInstructionSets())
+				{
+					auto results{runKernels(instructionSet)};
+					for(std::size_t kernel{0}; kernel < expected.size(); ++kernel)
+					{
+						for(std::size_t i{0}; i < samples; ++i)
+						{
+							ASSERT_EQ(expected[kernel][i], results[kernel][i]) << "Instruction set " << static_cast<int>(instructionSet) 
+																			   << " kernel " << kernel << " sample " << i;
+						}
+					}
+				}
+			}
+
+			InstructionSet originalInstructionSet_{AudioDataKernels::GetInstructionSet()};
+	};
+}
+
+TEST_F(AudioDataKernelsTest, TestBestInstructionSetIsSupported)
+{
+	EXPECT_TRUE(AudioDataKernels::IsInstructionSetSupported(InstructionSet::SCALAR));
+	EXPECT_TRUE(AudioDataKernels::IsInstructionSetSupported(AudioDataKernels::GetBestInstructionSet()));
+}
+
+TEST_F(AudioDataKernelsTest, TestVectorKernelsMatchScalar)
+{
+	CheckKernelsMatchScalar<double>();
+	CheckKernelsMatchScalar<float>();
+}
+
+TEST_F(AudioDataKernelsTest, TestRampWithinToleranceOfDivision)
+{
+	const std::size_t samples{4097};
+	std::vector<double> data(samples, 0.5);
+	AudioDataKernels::GainRamp(data.data(), samples, 0.75, AudioDataKernels::CalculateRampStep(0.75, 1.25, samples));
+
+	for(std::size_t i{0}; i < samples; ++i)
+	{
+		double ratio{0.75 + ((1.25 - 0.75) * (static_cast<double>(i) / static_cast<double>(samples - 1)))};
+		EXPECT_NEAR(0.5 * ratio, data[i], 1e-15);
+	}
+
+	EXPECT_EQ(0.375, data.front());
+	EXPECT_EQ(0.625, data.back());
+}
+
+TEST_F(AudioDataKernelsTest, TestClampPassesNaNThrough)
+{
+	for(auto instructionSet : GetSupportedInstructionSets())
+	{
+		AudioDataKernels::SetInstructionSet(instructionSet);
+		std::vector<double> data(8, 0.5);
+		data[1] = std::numeric_limits<double>::quiet_NaN();
+		data[2] = 3.0;
+		data[3] = -3.0;
+		AudioDataKernels::Gain(data.data(), data.size(), 1.0);
+		EXPECT_EQ(0.5, data[0]);
+		EXPECT_TRUE(std::isnan(data[1]));
+		EXPECT_EQ(1.0, data[2]);
+		EXPECT_EQ(-1.0, data[3]);
+	}
+}
+
+TEST_F(AudioDataKernelsTest, TestUnsupportedInstructionSet)
+{
+	for(auto instructionSet : {InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::NEON})
+	{
+		if(!AudioDataKernels::IsInstructionSetSupported(instructionSet))
+		{
+			EXPECT_THROW(AudioDataKernels::SetInstructionSet(instructionSet), Utilities::Exception);
+		}
+	}
+}
@@ -0,0 +1,133 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <AudioData/SharedAudioData.h>
+#include <thread>
+#include <vector>
+
+TEST(SharedAudioDataTest, TestCopiesShareSamples)
+{
+	AudioData audioData{std::vector<double>{0.1, 0.2, 0.3}};
+	const double* samples{audioData.GetDataPointer()};
+
+	// Taking ownership moves the samples rather than copying them
+	SharedAudioData first{std::move(audioData)};
+	EXPECT_EQ(samples, first.Get().GetDataPointer());
+	EXPECT_FALSE(first.IsShared());
+
+	SharedAudioData second{first};
+	SharedAudioData third;
+	third = first;
+	EXPECT_TRUE(first.IsShared());
+	EXPECT_EQ(samples, second.Get().GetDataPointer());
+	EXPECT_EQ(samples, third.View().GetDataPointer());
+	EXPECT_EQ(3, third.GetSize());
+}
+
+TEST(SharedAudioDataTest, TestCopyOnWrite)
+{
+	SharedAudioData first{AudioData{std::vector<double>{0.1, 0.2, 0.3}}};
+	SharedAudioData second{first};
+
+	second.GetWriteAccess().Amplify(2.0);
+	EXPECT_FALSE(first.IsShared());
+	EXPECT_FALSE(second.IsShared());
+	EXPECT_EQ(0.1, first.Get().GetData()[0]);
+	EXPECT_EQ(0.2, second.Get().GetData()[0]);
+
+	// Once it's the only owner, writing no longer copies
+	const double* samples{second.Get().GetDataPointer()};
+	second.GetWriteAccess().Amplify(0.5);
+	EXPECT_EQ(0.1, second.Get().GetData()[0]);
+	EXPECT_EQ(samples, second.Get().GetDataPointer());
+}
+
+TEST(SharedAudioDataTest, TestRelease)
+{
+	SharedAudioData first{AudioData{std::vector<double>{0.1, 0.2, 0.3}}};
+	SharedAudioData second{first};
+
+	// Shared, so the samples are copied and the other owner keeps its samples
+	auto copy{first.Release()};
+	EXPECT_EQ(3, copy.GetSize());
+	EXPECT_EQ(0, first.GetSize());
+	EXPECT_EQ(3, second.GetSize());
+
+	// Not shared, so the samples are moved out
+	const double* samples{second.Get().GetDataPointer()};
+	auto moved{second.Release()};
+	EXPECT_EQ(samples, moved.GetDataPointer());
+	EXPECT_EQ(0, second.GetSize());
+}
+
+// Reading reclaims removed front samples, so a shared buffer must never have any or the readers would race
+TEST(SharedAudioDataTest, TestCopiesReadOnOtherThreads)
+{
+	std::vector<double> samples(10000);
+	for(std::size_t i{0}; i < samples.size(); ++i)
+	{
+		samples[i] = static_cast<double>(i) / static_cast<double>(samples.size());
+	}
+
+	AudioData audioData{samples};
+	audioData.RemoveFrontSamples(1000);
+	SharedAudioData first{std::move(audioData)};
+	EXPECT_EQ(first.Get().GetDataPointer(), first.Get().GetData().data());
+
+	// Samples removed while there's a single owner are reclaimed when it's copied
+	SharedAudioData second;
+	second.GetWriteAccess().Append(AudioData{samples});
+	second.GetWriteAccess().RemoveFrontSamples(1000);
+	SharedAudioData third{second};
+	EXPECT_EQ(third.Get().GetDataPointer(), third.Get().GetData().data());
+
+	const std::vector<double> expected(samples.begin() + 1000, samples.end());
+	std::vector<SharedAudioData> copies{first, first, second, third};
+	std::vector<int> matched(copies.size(), 0);  // Not vector<bool>, whose elements share bytes
+	std::vector<std::thread> readers;
+	for(std::size_t reader{0}; reader < copies.size(); ++reader)
+	{
+		readers.emplace_back([&, reader]()
+		{
+			matched[reader] = 1;
+			for(std::size_t i{0}; i < 100; ++i)
+			{
+				matched[reader] = matched[reader] && (copies[reader].Get().GetData() == expected);
+			}
+		});
+	}
+
+	for(auto& thread : readers)
+	{
+		thread.join();
+	}
+
+	for(std::size_t reader{0}; reader < copies.size(); ++reader)
+	{
+		EXPECT_TRUE(matched[reader]) << reader;
+	}
+}
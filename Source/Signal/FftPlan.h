@@ -0,0 +1,153 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FftPlan.h
+//! @brief Precomputed tables for the Fast Fourier Transform of a given size.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Signal {
+
+namespace Fourier {
+
+//! Holds everything an FFT of a given size needs that doesn't depend on the signal.
+
+//! Creating a plan computes the permutations and twiddle factors once, so the transform itself is 
+//! nothing but butterflies.  Plans are immutable once created and are shared process-wide through 
+//! GetPlan(), so any number of threads can use the same plan at once.  GetPlan() only keeps weak 
+//! references: a plan is freed when the last holder releases it, so hold on to the plan rather than 
+//! getting it again for each transform.  The Fourier functions keep each thread's last few plans for this.
+//!
+//! Any size can be transformed in O(N log N) time.  The algorithm depends on the size:
+//! - Powers of two use vectorized radix-4 passes (see FftKernels.h), with a single radix-2 stage 
+//!   first when the size is an odd power of two.
+//! - Sizes whose only prime factors are 2, 3, 5 and 7 use a mixed-radix Stockham FFT.
+//! - Any other size (e.g. a prime) uses Bluestein's algorithm, which turns the transform into a 
+//!   convolution done with power of two FFTs.
+//!
+//! Audio is real, so besides the complex transform a plan offers real-to-complex and complex-to-real 
+//! transforms.  For even sizes these pack the N real samples into N/2 complex values, run a complex 
+//! transform of half the size and untangle the result, working directly on the N/2+1 bins a 
+//! FrequencyDomain holds.
+
+class FftPlan
+{
+	public:
+		//! Returns the plan for the given size, creating it if no one holds one.  The size must be at least one.
+		static std::shared_ptr<const FftPlan> GetPlan(std::size_t size);
+
+		//! Creates a plan for the given size.  Prefer GetPlan() which reuses existing plans.
+		explicit FftPlan(std::size_t size);
+
+		//! Returns the number of points the plan transforms.
+		std::size_t GetSize() const;
+
+		//! Performs the forward transform in place on GetSize() real and imaginary values.
+		void Forward(double* real, double* imaginary) const;
+
+		//! Performs the inverse transform, including the 1/N scaling, in place on GetSize() real and imaginary values.
+		void Inverse(double* real, double* imaginary) const;
+
+		//! Transforms GetSize() real samples into the GetSize()/2+1 bins of the non-negative frequencies.
+		void ForwardReal(const double* input, double* real, double* imaginary) const;
+
+		//! Transforms GetSize()/2+1 bins back into GetSize() real samples, including the 1/N scaling.
+		//
+		//! The imaginary parts of the first bin, and of the last bin for even sizes, are ignored as 
+		//! they would be for any real signal.
+		void InverseReal(const double* real, const double* imaginary, double* output) const;
+
+	private:
+		enum class Algorithm
+		{
+			POWER_OF_TWO,
+			MIXED_RADIX,
+			BLUESTEIN
+		};
+
+		// One stage of the mixed-radix FFT, splitting a transform of the given length into radix 
+		// transforms of length/radix
+		struct Stage
+		{
+			std::size_t radix_;
+			std::size_t length_;
+
+			// The radix-th roots of unity
+			std::vector<double> rootReal_;
+			std::vector<double> rootImaginary_;
+
+			// W(length)^(j*k) for j in [0, length/radix) and k in [1, radix), stored j major
+			std::vector<double> twiddleReal_;
+			std::vector<double> twiddleImaginary_;
+		};
+
+		void PreparePowerOfTwo();
+		void PrepareMixedRadix(const std::vector<std::size_t>& radices);
+		void PrepareBluestein();
+
+		void ForwardPowerOfTwo(double* real, double* imaginary) const;
+		void ForwardMixedRadix(double* real, double* imaginary) const;
+		void ForwardBluestein(double* real, double* imaginary) const;
+
+		static std::vector<std::size_t> GetRadices(std::size_t size);
+		static std::vector<std::pair<uint32_t, uint32_t>> CalculateBitReversalSwaps(std::size_t size);
+
+		std::size_t size_;
+		Algorithm algorithm_{Algorithm::POWER_OF_TWO};
+
+		// The twiddle factors e^(-2*pi*i*k/N) for k in [0, N/2), used to untangle the real transforms
+		std::vector<double> twiddleReal_;
+		std::vector<double> twiddleImaginary_;
+
+		// The plan the real transforms of an even size pack their samples into
+		std::shared_ptr<const FftPlan> halfPlan_;
+
+		// Powers of two: the index pairs swapped by the bit reversal sorting, and the twiddles of 
+		// the radix-4 pass with a quarter of 2^n laid out as FftKernels::Radix4Pass() expects them
+		std::vector<std::pair<uint32_t, uint32_t>> swaps_;
+		std::vector<std::vector<double>> passTwiddles_;
+
+		// Mixed radix: the stages, in the order they're performed
+		std::vector<Stage> stages_;
+
+		// Bluestein: the chirp e^(-i*pi*k^2/N), the power of two plan the convolution is done with and 
+		// the transform of the conjugate chirp the signal is convolved with
+		std::vector<double> chirpReal_;
+		std::vector<double> chirpImaginary_;
+		std::shared_ptr<const FftPlan> convolutionPlan_;
+		std::vector<double> filterReal_;
+		std::vector<double> filterImaginary_;
+};
+
+}
+
+}
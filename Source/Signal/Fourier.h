@@ -36,26 +36,70 @@
 namespace Signal  {
 
 
+//! The transforms are templated on the sample type of the time domain signal and are available for 
+//! both double and float samples.  The transforms themselves, and the frequency domain, are always 
+//! calculated in double.
+//!
+//! The FFTs handle any length in O(N log N) time (see FftPlan.h).  The DFTs are the straightforward 
+//! O(N^2) sums and are kept as the reference the FFTs are tested against.
+
 namespace Fourier
 {
 	//! Returns true if the given number is a power of two; false otherwise.
 	bool IsPowerOfTwo(std::size_t number);
 
 	//! Applies the Discrete Fourier Transform to the given audio data.
-	Signal::FrequencyDomain ApplyDFT(const AudioData& timeDomainSignal);
+	template<typename T>
+	Signal::FrequencyDomain ApplyDFT(const BasicAudioData<T>& timeDomainSignal);
+
+	//! Applies the Discrete Fourier Transform to the samples of the given view.
+	template<typename T>
+	Signal::FrequencyDomain ApplyDFT(const BasicAudioDataView<T>& timeDomainSignal);
 
 	//! Applies the Inverse Discrete Fourier Transform to the given frequency data.
-	AudioData ApplyInverseDFT(const Signal::FrequencyDomain& frequencyDomainData);
+	template<typename T=double>
+	BasicAudioData<T> ApplyInverseDFT(const Signal::FrequencyDomain& frequencyDomainData);
 
 	//! Applies the Fast Fourier Transform to the given audio data.
 	//
-	//! Note that the length of the given audio must be a power of two.
-	Signal::FrequencyDomain ApplyFFT(const AudioData& timeDomainSignal);
+	//! The audio may be of any length.  Lengths that are a power of two, or whose only prime 
+	//! factors are 2, 3, 5 and 7, are the fastest.
+	template<typename T>
+	Signal::FrequencyDomain ApplyFFT(const BasicAudioData<T>& timeDomainSignal);
+
+	//! Applies the Fast Fourier Transform to the samples of the given view.
+	//
+	//! The view may be of any length, see above.
+	template<typename T>
+	Signal::FrequencyDomain ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal);
 
 	//! Applies the Inverse Fast Fourier Transform to the given audio data.
 	//
-	//! Note that the length of the given frequency domain data must be a power of two.
-	AudioData ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData);
+	//! The output has (bins - 1) * 2 samples, like the inverse DFT.
+	template<typename T=double>
+	BasicAudioData<T> ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData);
+
+	// The following write into storage given by the caller rather than returning new objects.  Scratch 
+	// space is kept per thread, so once a thread has transformed a given size, transforming it again 
+	// allocates no memory.
+
+	//! Applies the Fast Fourier Transform to the samples of the given view, replacing the bins of the given frequency domain.
+	//
+	//! The frequency domain's storage is reused, so a frequency domain kept across calls isn't reallocated.
+	template<typename T>
+	void ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal, Signal::FrequencyDomain& frequencyDomain);
+
+	//! Applies the Fast Fourier Transform to the samples of the given view, writing the size/2+1 bins to the given arrays.
+	template<typename T>
+	void ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal, double* real, double* imaginary);
+
+	//! Applies the Inverse Fast Fourier Transform to the given frequency data, writing (bins - 1) * 2 samples.
+	template<typename T>
+	void ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData, T* samples);
+
+	//! Applies the Inverse Fast Fourier Transform to the given bins, writing (bins - 1) * 2 samples.
+	template<typename T>
+	void ApplyInverseFFT(const double* real, const double* imaginary, std::size_t bins, T* samples);
 }
 
 }
@@ -67,6 +67,14 @@ class FrequencyDomain
 		//! Add the given frequency bin data.
 		void PushFrequencyBin(Signal::FrequencyBin FrequencyBin);
 
+		//! Replaces all bins with the given real and imaginary values.
+		//
+		//! Storage is reused, so assigning no more bins than were held before doesn't allocate.
+		void Assign(const double* real, const double* imaginary, std::size_t bins);
+
+		//! Removes all bins, keeping the storage for reuse.
+		void Clear();
+
 		//! Get the number of frequency bins in this frequency domain data.
 		std::size_t GetSize() const;
 
@@ -104,6 +112,7 @@ class FrequencyDomain
 
 		Quadrant GetQuadrant(double reX, double imX);
 		double GetWrappedPhase(double reX, double imX);
+		void ClearCachedData();
 
 		std::vector<FrequencyBin> data_;
 
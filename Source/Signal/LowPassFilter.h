@@ -30,19 +30,52 @@
 #pragma once
 
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioDataQueue.h>
+#include <Utilities/SpscQueue.h>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace Signal {
 
+namespace Fourier {
+class FftPlan;
+}
+
+struct LowPassFilterSpectrum;
+
 //! An implementation of a low pass filter.
 // 
 //! This is an implementation of equation 16-4 (Windowed Sinc Filter) from the 
 //! book "The Scientist and Engineer's Guide to Digital Signal Processing" 2nd 
 //! edition by Steven W. Smith.
-
-class LowPassFilter
+//!
+//! The filter is templated on the sample type.  The filter kernel is calculated 
+//! in double and stored in the sample type so that convolution runs at the 
+//! precision (and memory footprint) of the audio being filtered.  Filters with the 
+//! same cutoff ratio and length share one kernel (see FilterKernelCache.h).
+//!
+//! One thread may submit audio while another retrieves output.  Processed output is passed 
+//! through a lock-free queue, so GetAudioData() and OutputSamplesAvailable() never wait on 
+//! processing.  Reset() and FlushAudioData() must not be called while another thread is 
+//! retrieving output.  With Synchronization::SINGLE_THREADED all locking is skipped.
+//!
+//! Short filters are convolved directly, computing several outputs at once with SIMD 
+//! instructions.  Long filters are convolved block by block in the frequency domain 
+//! (overlap-save), which costs a few FFTs per block instead of filterLength multiplies per 
+//! sample.  Either way the output is the same, give or take rounding.
+
+template<typename T>
+class BasicLowPassFilter
 {
 	public:
+		//! How the input is convolved with the filter kernel.
+		enum class ConvolutionMethod
+		{
+			AUTOMATIC,	//!< Direct for short filters, FFT for long ones
+			DIRECT,		//!< Direct-form convolution
+			FFT			//!< Overlap-save convolution in the frequency domain
+		};
 
 		//! Instatiate the LowPassFilter.
 		//
@@ -51,42 +84,76 @@ class LowPassFilter
 		//! signal sample rate.  For example, if you're input is a 44100Hz signal and 
 		//! you want to filter out everything above 32000Hz you would use a ratio of 
 		//! 0.3628.
-		LowPassFilter(double cutoffRatio, std::size_t filterLength=100);
+		//!
+		//! The convolution method is normally left to the filter, which switches to FFT convolution 
+		//! once the filter is at least FFT_CONVOLUTION_MINIMUM_LENGTH long.
+		BasicLowPassFilter(double cutoffRatio, std::size_t filterLength=100, 
+						   Utilities::Synchronization synchronization=Utilities::Synchronization::THREAD_SAFE,
+						   ConvolutionMethod convolutionMethod=ConvolutionMethod::AUTOMATIC);
 
 		//! Clears internal buffers and counters to restart processing fresh.
 		void Reset();
 
 		//! Submit audio data for the filter to process.
-		void SubmitAudioData(const AudioData& audioData);
+		void SubmitAudioData(const BasicAudioData<T>& audioData);
 
 		//! Method to retrieve output after processed by the low pass filter.
-		AudioData GetAudioData(uint64_t samples);
+		BasicAudioData<T> GetAudioData(uint64_t samples);
 
 		//! Returns the number of output samples currently available.
 		std::size_t OutputSamplesAvailable();
 
 		//! At the end of processing, this can be called to get any and all remaining output samples.
-		AudioData FlushAudioData();
+		BasicAudioData<T> FlushAudioData();
 
 		//! Returns the minimum input samples needed for processing. This is the same as the filter length.
 		std::size_t MinimumSamplesNeededForProcessing();
 
+		//! Returns the filter kernel, for code that convolves with it directly.
+		const std::vector<T>& GetFilterKernel() const;
+
+		//! Returns the convolution method in use, DIRECT or FFT.
+		ConvolutionMethod GetConvolutionMethod() const;
+
+		//! The filter length from which ConvolutionMethod::AUTOMATIC uses FFT convolution.
+		static const std::size_t FFT_CONVOLUTION_MINIMUM_LENGTH{256};
 
 	private:
 		void CalculateFilterKernel();
+		void PrepareFftConvolution();
 		void Process();
+		void ConvolveDirect(const T* input, std::size_t samples);
+		void ConvolveFft(const T* input, std::size_t samples);
+		std::unique_lock<std::mutex> LockProcessing();
 
 		double cutoffRatio_;
 		std::size_t filterLength_;
-		std::vector<double> filterKernel_;
+		std::shared_ptr<const std::vector<T>> filterKernel_;
+		ConvolutionMethod convolutionMethod_;
+
+		// Overlap-save state: each block of fftSize input samples gives blockOutputSize_ output samples
+		std::shared_ptr<const Fourier::FftPlan> fftPlan_;
+		std::size_t blockOutputSize_{0};
+		std::shared_ptr<const LowPassFilterSpectrum> kernelSpectrum_;
+		std::vector<double> block_;
+		std::vector<double> blockReal_;
+		std::vector<double> blockImaginary_;
 
-		AudioData audioInput_;
-		AudioData audioOutput_;
+		BasicAudioData<T> audioInput_;
 
+		// Output is gathered here while processing and then published to the output queue
+		BasicAudioData<T> audioOutput_;
+		BasicAudioDataQueue<T> outputQueue_;
+
+		// Guards the processing state, the output queue needs no lock
+		Utilities::Synchronization synchronization_;
 		std::mutex mutex_;
 
 		const double minCutoffRatioRange_{0.0001};
 		const double maxCutoffRatioRange_{0.5000};
 };
 
+using LowPassFilter = BasicLowPassFilter<double>;
+using LowPassFilterFloat = BasicLowPassFilter<float>;
+
 }
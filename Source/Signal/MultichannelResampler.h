@@ -0,0 +1,263 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file MultichannelResampler.h
+//! @brief Implementation of an audio resampler for several channels at once.
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <AudioData/AudioDataQueue.h>
+#include <Utilities/SpscQueue.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Signal {
+
+template<typename T>
+class BasicWindowedSincTable;
+
+//! Resampler quality levels, trading the length of the filters for speed.
+
+//! Each level sets the number of input samples on each side of the windowed sinc filter, how finely the 
+//! windowed sinc values are tabulated and the length and window of the low pass filter applied before 
+//! downsampling.  From DRAFT to MASTERING the levels attenuate the stopband further at a higher cost.  The 
+//! attenuations given are of a tone at 5/6 of the input's Nyquist frequency when downsampling 2:1.
+//!
+//! LEGACY is the resampler's original filtering, the default so existing output doesn't change.  Its low pass 
+//! filter is the LowPassFilter kernel, which puts the center value on two taps and so only attenuates the 
+//! stopband about 16dB.  NORMAL costs the same with a blackman windowed low pass filter.
+enum class ResamplerQuality
+{
+	LEGACY,      //!< The original filtering, NORMAL's lengths with a hamming windowed low pass filter.  About 16dB.
+	DRAFT,       //!< 8 samples per side, 64 table values per zero crossing, a 32 tap low pass filter.  About 84dB.  For previews.
+	NORMAL,      //!< 19 samples per side, 224 table values per zero crossing, a 100 tap low pass filter.  About 114dB.
+	HIGH,        //!< 32 samples per side, 512 table values per zero crossing, a 256 tap low pass filter.  About 138dB.
+	MASTERING    //!< 48 samples per side, 1024 table values per zero crossing, a 512 tap low pass filter.  About 156dB.
+};
+
+//! Implementation of a digital audio resampler for any number of channels using a windowed sinc filter.
+
+//! All channels share the position of the windowed sinc filter, so the filter's values for each output 
+//! frame (one sample of every channel) are found once and applied to every channel.  Each channel's output 
+//! is the same as resampling that channel on its own with a Resampler, which uses this class for its one 
+//! channel.  The resampler is templated on the sample type; the windowed sinc values and the per output 
+//! sample accumulation are always double.
+//!
+//! One thread may submit audio while another retrieves output.  Processed output is passed 
+//! through lock-free queues, so GetAudioData() and OutputSamplesAvailable() never wait on 
+//! processing.  Reset() and FlushAudioData() must not be called while another thread is 
+//! retrieving output.  With Synchronization::SINGLE_THREADED all locking is skipped.
+//!
+//! When the resample ratio is a fraction with a numerator (once reduced) of at most 
+//! maximumPolyphasePhases_, such as 160/147 for 44100Hz to 48000Hz, the windowed sinc values 
+//! for every position the filter can take are calculated up front.  Each output sample is then 
+//! a dot product of the input with one of these coefficient banks.  Other ratios look up and 
+//! interpolate the windowed sinc values for each output frame.  The banks and the low pass 
+//! filter kernel are shared by every resampler using the same ones (see FilterKernelCache.h).
+//!
+//! When downsampling, the input is low pass filtered straight into the buffers the windowed 
+//! sinc filter reads, with no separate filter to copy it through.
+//!
+//! The resample ratio can be changed while processing with SetResampleRatio(), for example 
+//! to compensate for drift between two clocks.  The sinc filter's position and the input 
+//! history carry on from where they were, so the output has no discontinuities.
+
+template<typename T>
+class BasicMultichannelResampler
+{
+	public:
+		//! Instatiate the resampler for the given number of channels.
+		//
+		//! Example: An input sample rate of 44100Hz and a resample ratio of 0.5
+		//! will result in an output sample rate of 22050Hz.
+		BasicMultichannelResampler(std::size_t inputSampleRate, double resampleRatio, std::size_t channels, 
+								   Utilities::Synchronization synchronization=Utilities::Synchronization::THREAD_SAFE,
+								   ResamplerQuality quality=ResamplerQuality::LEGACY);
+
+		virtual ~BasicMultichannelResampler();
+
+		//! Clears internal buffers and etc to allow for restarting processing fresh.
+		void Reset();
+
+		//! Submit audio data to be processed by the resampler, one AudioData object per channel.
+		//
+		//! An exception is thrown if the number of channels is wrong or they aren't all the same size.
+		void SubmitAudioData(const std::vector<BasicAudioData<T>>& audioData);
+
+		//! Submit views of the audio data to be processed by the resampler, one view per channel.
+		//
+		//! The channel views of an interleaved AudioBuffer can be submitted without copying them first.  
+		//! An exception is thrown if the number of channels is wrong or they aren't all the same size.
+		void SubmitAudioData(const std::vector<BasicAudioDataView<T>>& audioData);
+
+		//! Retrieve output audio the resampler has processed, requesting a certain number of samples per channel.
+		std::vector<BasicAudioData<T>> GetAudioData(uint64_t samples);
+
+		//! Returns the number of output samples currently available for every channel.
+		std::size_t OutputSamplesAvailable();
+
+		//! At the end of processing, this can be called to get any and all remaining output samples.
+		std::vector<BasicAudioData<T>> FlushAudioData();
+
+		//! Returns the number of channels the resampler was instantiated with.
+		std::size_t GetChannels() const;
+
+		//! Returns the quality level the resampler was instantiated with.
+		ResamplerQuality GetQuality() const;
+
+		//! Changes the resample ratio without losing the resampler's state.
+		//
+		//! The new ratio applies from the next output sample, or with rampOutputSamples it's reached gradually over 
+		//! that many output samples: the input samples stepped per output sample change by the same amount each 
+		//! output sample.  Setting a ratio, or a ramp, for each submitted block follows a drift estimate or an 
+		//! automation curve.
+		//!
+		//! The low pass filter follows the ratio: during a ramp it's the filter for the lower of the two ratios, 
+		//! after it the filter for the new ratio.  A resampler that wasn't downsampling starts low pass filtering 
+		//! when the ratio first drops below 1.0, and carries on with a filter passing everything if it goes back 
+		//! up.  While the ratio ramps the windowed sinc values are interpolated, once it settles on a ratio with 
+		//! polyphase banks they're used again.  An exception is thrown if the output sample rate would be out of 
+		//! range.
+		void SetResampleRatio(double resampleRatio, std::size_t rampOutputSamples=0);
+
+		//! Returns the current resample ratio, part way along the ramp if the ratio is still changing.
+		double GetResampleRatio();
+
+	private:			
+		void ValidateChannels(const std::vector<BasicAudioDataView<T>>& audioData) const;
+		void ValidateSampleRates();
+		void ValidateResampleRatio(double resampleRatio);
+		void CalculateLowPassFilterKernel();
+		void CalculateXSincCenterAdjustmentPerInputSample();
+		void StepResampleRatioRamp();
+		void CompleteResampleRatioChange();
+		void UpdateLowPassFilter(double resampleRatio);
+		void StartLowPassFiltering();
+		std::size_t GetLowPassFilterReach() const;
+		std::size_t GetHistorySize() const;
+		void RestartInput();
+		void CalculatePolyphaseBanks();
+		void HandleNoSampleRateChange(const std::vector<BasicAudioDataView<T>>& audioData);
+		void Process(const std::vector<BasicAudioDataView<T>>& audioData);
+		void AppendLowPassFilterInput(const std::vector<BasicAudioDataView<T>>& audioData);
+		void LowPassFilterInput(std::size_t begin, std::size_t end);
+		void ReserveOutputSamples(std::size_t samples);
+		const double* CalculateWindowedSincCoefficients();
+		const double* GetPolyphaseCoefficients() const;
+		double ApplyWindowedSincFilter(const double* coefficients, const T* inputBuffer) const;
+		double ApplyPolyphaseFilter(const double* coefficients, const T* inputBuffer) const;
+		void CheckForSincPositionWrapping();
+		void DiscardInputNoLongerNeeded();
+		std::unique_lock<std::mutex> LockProcessing();
+
+		std::size_t inputSampleRate_;
+		double resampleRatio_;
+		std::size_t channels_;
+
+		// These history buffers hold each channel's input data waiting to be processed.  After processing only the 
+		// samples the sinc filter still needs (about 2 * samplesPerSide_) are kept, moved to the front of the buffer, 
+		// so the cost of each submission doesn't depend on how much input came before it.
+		std::vector<std::vector<T>> inputData_;
+
+		// Output is written to these blocks while processing and then published to the output queues.  The blocks 
+		// only ever grow, so they're allocated once for the largest submission.
+		std::vector<std::vector<T>> outputData_;
+
+		// These queues hold each channel's output data ready for the user to request
+		std::vector<std::unique_ptr<BasicAudioDataQueue<T>>> outputQueues_;
+
+		// Guards the processing state, the output queues need no lock
+		Utilities::Synchronization synchronization_;
+		std::mutex mutex_;
+
+		// We limit sample rate conversion to 1,000Hz-to-192,000Hz
+		const std::size_t minimumSampleRate_{1000};
+		const std::size_t maximumSampleRate_{192000};
+
+		// See the document ResamplingUsingWindowedSincFilter.odg in SabbaticalNotes for more info on these constants.
+		// The windowed sinc values come from sincTable_, which has sincSamplesPerXInteger_ values per input sample.
+		ResamplerQuality quality_;
+		std::shared_ptr<const Signal::BasicWindowedSincTable<double>> sincTable_;
+		const double sincSamplesPerXInteger_;
+		const std::size_t samplesPerSide_;
+		const std::size_t lowPassFilterLength_;
+		const std::size_t minimumSamplesNeededForProcessing_{(2 * samplesPerSide_) + 1}; // "+1" for the center index 
+		                                                                                 // of the windowed sinc filter
+		double xSincCenterAdjustmentPerInputSample_{0.0};
+		double currentXSincPosition_{0.0};
+		std::size_t inputSampleIndex_{samplesPerSide_ + 1 + (lowPassFilterLength_ / 2)};
+
+		// While the ratio ramps to resampleRatio_ xSincCenterAdjustmentPerInputSample_ changes by 
+		// xSincCenterAdjustmentStep_ for each output sample, reaching targetXSincCenterAdjustment_ after 
+		// rampOutputSamplesRemaining_ more.
+		double targetXSincCenterAdjustment_{0.0};
+		double xSincCenterAdjustmentStep_{0.0};
+		std::size_t rampOutputSamplesRemaining_{0};
+
+		// A ratio of 1.0 copies the input to the output until the ratio is changed.  Only the last samplesPerSide_ 
+		// input samples are kept, so the sinc filter can take over from the next input sample.
+		bool passingThrough_;
+
+		// True once the input is low pass filtered, from the start when downsampling or from the first change of the 
+		// ratio to downsampling.  It carries on, passing everything, if the ratio goes back up.
+		bool lowPassFiltering_;
+
+		// The x positions and windowed sinc values for the current output frame when there are no polyphase banks, 
+		// for the input samples from inputSampleIndex_ - samplesPerSide_ on.  The positions never reach past the 
+		// sinc table, which covers a few more than samplesPerSide_ zero crossings.
+		std::vector<double> sincPositions_;
+		std::vector<double> sincCoefficients_;
+
+		// For ratios with a numerator of polyphasePhases_ the sinc position is always polyphaseOffset_ plus a whole 
+		// number of phases, each sincSamplesPerXInteger_ / polyphasePhases_.  There's a bank of sinc values for the input 
+		// samples from inputSampleIndex_ - samplesPerSide_ on for each phase the position can take: [0, polyphasePhases_] 
+		// when upsampling, or zero and [polyphasePhases_, 2 * polyphasePhases_] when downsampling.  With no banks 
+		// polyphasePhases_ is zero.  The offset is zero unless a ratio change left the position between phases.
+		const std::size_t maximumPolyphasePhases_{4096};
+		std::size_t polyphasePhases_{0};
+		double polyphaseOffset_{0.0};
+		std::shared_ptr<const std::vector<double>> polyphaseBanks_;
+
+		// When downsampling, input waits here to be low pass filtered.  inputData_[c][i] is the filtered value of the 
+		// samples from unfilteredInputData_[c][i - lowPassFilterOffset_] on, calculated once that input has arrived.  
+		// Both buffers start with the same silence, which is already "filtered".  The offset is zero when the 
+		// resampler is instantiated to downsample, as it's always been, and centers the filter on each sample when 
+		// low pass filtering starts later, so the input already processed stays in place.
+		std::vector<std::vector<T>> unfilteredInputData_;
+		std::shared_ptr<const std::vector<T>> lowPassFilterKernel_;
+		std::size_t lowPassFilterOffset_{0};
+		std::size_t filteredInputSize_{inputSampleIndex_};
+
+		// The start of each channel's input buffer while processing
+		std::vector<const T*> inputBuffers_;
+};
+
+using MultichannelResampler = BasicMultichannelResampler<double>;
+using MultichannelResamplerFloat = BasicMultichannelResampler<float>;
+
+}
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <AudioData/AudioDataView.h>
 #include <vector>
 
 namespace Signal {
@@ -45,10 +46,16 @@ std::vector<double> GenerateSineWave(double sampleRate, std::size_t lengthInSamp
 //! Given a time domain signal, and the frequency bin, this will ascertain what the frequency of the signal is.
 double GetPeakFrequencyByQuinn(std::size_t peakBin, const std::vector<double>& timeDomainSignal, double inputSignalSampleRate);
 
+//! Given a view of a time domain signal, and the frequency bin, this will ascertain what the frequency of the signal is.
+double GetPeakFrequencyByQuinn(std::size_t peakBin, const AudioDataView& timeDomainSignal, double inputSignalSampleRate);
+
 //! Given a frequency domain information of a signal, this will ascertain what the frequency of the signal is.
 double GetPeakFrequencyByQuinn(std::size_t peakBin, std::size_t fourierSize, const std::vector<double>& real, const std::vector<double>& imaginary, double inputSignalSampleRate);
 
 //! Attempts to use correlation to pinpoint the frequency of the signal for the given frequency bin.
 double GetPeakFrequencyByCorrelation(std::size_t peakBin, const std::vector<double>& timeDomainSignal, double inputSignalSampleRate);
 
+//! Attempts to use correlation to pinpoint the frequency of the signal viewed for the given frequency bin.
+double GetPeakFrequencyByCorrelation(std::size_t peakBin, const AudioDataView& timeDomainSignal, double inputSignalSampleRate);
+
 }
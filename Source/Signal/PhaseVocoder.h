@@ -35,18 +35,27 @@
 #define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
 #include <math.h>
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioDataQueue.h>
+#include <Signal/FrequencyDomain.h>
+#include <Utilities/SpscQueue.h>
 
 namespace Signal {
 
-class FrequencyDomain;
 class PeakProfile;
 
 //! Implementation of a phase vocoder.
 
 //! A phase vocoder allows for stretching/compressing audio with respect to time.  Wikipedia has a pretty good explanation 
-//! of how a phase vocoder works.
-
-class PhaseVocoder
+//! of how a phase vocoder works.  The phase vocoder is templated on the sample type; the frequency 
+//! domain processing (phases, magnitudes and peak frequencies) is always done in double.
+//!
+//! One thread may submit audio while another retrieves output.  Processed output is passed 
+//! through a lock-free queue, so GetAudioData() and OutputSamplesAvailable() never wait on 
+//! processing.  Reset() and FlushAudioData() must not be called while another thread is 
+//! retrieving output.  With Synchronization::SINGLE_THREADED all locking is skipped.
+
+template<typename T>
+class BasicPhaseVocoder
 {
 	public:
 		//! Instatiate the phase vocoder.
@@ -55,23 +64,25 @@ class PhaseVocoder
 		//! 1) The sample rate of the audio it will process (e.g. 44100) 
 		//! 2) The total length in samples of the input we'll be stretching
 		//! 3) The stretch factor which is a ratio of the input (e.g. 1.0 = no change, 0.8 = 20% speedup, 1.2 = 20% slowdown)
-		PhaseVocoder(std::size_t sampleRate, std::size_t inputLength, double stretchFactor);
-		virtual ~PhaseVocoder();
+		//! 4) Whether submitting and retrieving may happen on different threads
+		BasicPhaseVocoder(std::size_t sampleRate, std::size_t inputLength, double stretchFactor, 
+						  Utilities::Synchronization synchronization=Utilities::Synchronization::THREAD_SAFE);
+		virtual ~BasicPhaseVocoder();
 
 		//! Clears internal buffers and etc to allow for restarting processing fresh.
 		void Reset();
 
 		//! Submit audio data to be processed by the phase vocoder.
-		void SubmitAudioData(const AudioData& audioData);
+		void SubmitAudioData(const BasicAudioData<T>& audioData);
 
 		//! Retrieve output audio the Phase Vocoder has processed, requesting a certain number of samples.
-		AudioData GetAudioData(uint64_t samples);
+		BasicAudioData<T> GetAudioData(uint64_t samples);
 
 		//! Returns the number of output samples currently available.
 		std::size_t OutputSamplesAvailable();
 
 		//! At the end of processing, this can be called to get any and all remaining output samples.
-		AudioData FlushAudioData();
+		BasicAudioData<T> FlushAudioData();
 
 		//! Returns the stretch factor given at construction.
 		double GetStretchFactor();
@@ -83,22 +94,25 @@ class PhaseVocoder
 
 		void DoPrecalculations();
 
-		void HandleNoStretchInput(const AudioData& audioData);
-		AudioData HandleShortInputCompress();
+		void HandleNoStretchInput(const BasicAudioData<T>& audioData);
+		BasicAudioData<T> HandleShortInputCompress();
 
 		void ProcessBuffer();
 
 		void HandleFirstWindow(Signal::FrequencyDomain& frequencyDomain);
 		void CreateSynthesizedOutputWindow(Signal::FrequencyDomain& frequencyDomain, std::size_t advancement);
 
-		std::map<std::size_t, double> GetPeakFrequencies(const AudioData& timeDomainSignal, Signal::PeakProfile& peakProfile);
+		std::map<std::size_t, double> GetPeakFrequencies(const BasicAudioDataView<T>& timeDomainSignal, Signal::PeakProfile& peakProfile);
 
 		double CalculateNewPhaseWrapped(std::size_t currentBin, double currentWrappedPhase, double peakFrequency, std::size_t advancement);
 
 		double ConvertUnwrappedPhaseToWrappedPhase(double unwrappedPhase);
 
-		void OverlapAndAddForOutput(AudioData& newSythesizedWindow);
-		AudioData MixAtBestCorrelation(const AudioData& transientBuffer, const AudioData& stretchBuffer);
+		void OverlapAndAddForOutput(BasicAudioData<T> newSythesizedWindow);
+		BasicAudioData<T> MixAtBestCorrelation(const BasicAudioData<T>& transientBuffer, const BasicAudioData<T>& stretchBuffer);
+
+		void PublishOutput();
+		std::unique_lock<std::mutex> LockProcessing();
 
 		bool noStretch_{false};
 		bool shortInputCompress_{false};
@@ -120,21 +134,31 @@ class PhaseVocoder
 		std::size_t totalOutputSamplesCreated_{0};
 
 		// This buffer holds input data waiting to be processed
-		AudioData inputData_;
+		BasicAudioData<T> inputData_;
 
 		// Remember that we create the output through a 4x overlap-and-add process.  This requires 
 		// us to have the three previous synthesized buffers in addition to the latest one.
-		std::list<AudioData> windowsInUse_;
+		std::list<BasicAudioData<T>> windowsInUse_;
+
+		// Output is gathered in this buffer while processing and then published to the output queue
+		BasicAudioData<T> outputData_;
 
-		// This buffer holds output data ready for the user to request
-		AudioData outputData_;
+		// This queue holds output data ready for the user to request
+		BasicAudioDataQueue<T> outputQueue_;
 
 		// Holds any transient audio that needs to be mixed into the output
-		AudioData transientSamples_;  
+		BasicAudioData<T> transientSamples_;  
+
+		// The frequency domains used for each window, kept so their storage is reused from window to window
+		Signal::FrequencyDomain analysisFrequencyDomain_;
+		Signal::FrequencyDomain peakFrequencyDomain_;
+		Signal::FrequencyDomain synthesisFrequencyDomain_;
 
 		std::vector<double> previousWrappedPhases_;
 		std::vector<double> previousExtrapolatedUnwrappedPhases_;
 
+		// Guards the processing state, the output queue needs no lock
+		Utilities::Synchronization synchronization_;
 		std::mutex mutex_;
 
 		static const uint32_t FFT_SIZE{4096};
@@ -148,4 +172,7 @@ class PhaseVocoder
 		static constexpr double SYNTHEIZED_OVERLAP_AMP_FACTOR{0.8024};
 };
 
+using PhaseVocoder = BasicPhaseVocoder<double>;
+using PhaseVocoderFloat = BasicPhaseVocoder<float>;
+
 }
\ No newline at end of file
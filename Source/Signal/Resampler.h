@@ -29,79 +29,64 @@
 
 #pragma once
 
-#include <AudioData/AudioData.h>
-#include <mutex>
-#include <memory>
+#include <Signal/MultichannelResampler.h>
 
 namespace Signal {
 
-class LowPassFilter;
-
 //! Implementation of a digital audio resampler using a windowed sinc filter.
 
 //! A resampler allows for adjusting the sample rate of digital audio without unreasonably 
-//! degrading the audio quality.
-
-class Resampler
+//! degrading the audio quality.  The resampler is templated on the sample type; the windowed 
+//! sinc values and the per output sample accumulation are always double.
+//!
+//! This resamples a single channel.  Use a MultichannelResampler to resample all channels of 
+//! audio at once, which finds the windowed sinc values for each output frame just once.  See 
+//! MultichannelResampler.h for the details of the resampling and thread safety, which are the 
+//! same for both.
+
+template<typename T>
+class BasicResampler
 {
 	public:
 		//! Instatiate the resampler.
 		//
 		//! Example: An input sample rate of 44100Hz and a resample ratio of 0.5
 		//! will result in an output sample rate of 22050Hz.
-		Resampler(std::size_t inputSampleRate, double resampleRatio);
+		BasicResampler(std::size_t inputSampleRate, double resampleRatio, 
+					   Utilities::Synchronization synchronization=Utilities::Synchronization::THREAD_SAFE,
+					   ResamplerQuality quality=ResamplerQuality::LEGACY);
 
-		virtual ~Resampler();
+		virtual ~BasicResampler();
 
 		//! Clears internal buffers and etc to allow for restarting processing fresh.
 		void Reset();
 
 		//! Submit audio data to be processed by the resampler.
-		void SubmitAudioData(const AudioData& audioData);
+		void SubmitAudioData(const BasicAudioData<T>& audioData);
 
 		//! Retrieve output audio the resampler has processed, requesting a certain number of samples.
-		AudioData GetAudioData(uint64_t samples);
+		BasicAudioData<T> GetAudioData(uint64_t samples);
 
 		//! Returns the number of output samples currently available.
 		std::size_t OutputSamplesAvailable();
 
 		//! At the end of processing, this can be called to get any and all remaining output samples.
-		AudioData FlushAudioData();
+		BasicAudioData<T> FlushAudioData();
+
+		//! Returns the quality level the resampler was instantiated with.
+		ResamplerQuality GetQuality() const;
+
+		//! Changes the resample ratio without losing the resampler's state, see MultichannelResampler::SetResampleRatio().
+		void SetResampleRatio(double resampleRatio, std::size_t rampOutputSamples=0);
+
+		//! Returns the current resample ratio, part way along the ramp if the ratio is still changing.
+		double GetResampleRatio();
 
 	private:			
-		void ValidateSampleRates();
-		void InstantiateLowPassFilter();
-		void CalculateXSincCenterAdjustmentPerInputSample();
-		void HandleNoSampleRateChange(const AudioData& audioData);
-		void Process(const AudioData& audioData);
-		AudioData LowPassFilterInput(const AudioData& audioData);
-		void CheckForSincPositionWrapping();
-		void DiscardInputNoLongerNeeded();
-
-		std::size_t inputSampleRate_;
-		double resampleRatio_;
-
-		// This buffer holds input data waiting to be processed
-		AudioData inputData_;
-
-		// This buffer holds output data ready for the user to request
-		AudioData outputData_;
-
-		std::mutex mutex_;
-
-		// We limit sample rate conversion to 1,000Hz-to-192,000Hz
-		const std::size_t minimumSampleRate_{1000};
-		const std::size_t maximumSampleRate_{192000};
-
-		// See the document ResamplingUsingWindowedSincFilter.odg in SabbaticalNotes for more info on these constants.
-		const std::size_t samplesPerSide_{19};                                             
-		const std::size_t minimumSamplesNeededForProcessing_{(2 * samplesPerSide_) + 1}; // "+1" for the center index 
-		                                                                                 // of the windowed sinc filter
-		double xSincCenterAdjustmentPerInputSample_{0.0};
-		double currentXSincPosition_{0.0};
-		std::size_t inputSampleIndex_{samplesPerSide_};
-
-		std::unique_ptr<Signal::LowPassFilter> lowPassFilter_;
+		BasicMultichannelResampler<T> resampler_;
 };
 
+using Resampler = BasicResampler<double>;
+using ResamplerFloat = BasicResampler<float>;
+
 }
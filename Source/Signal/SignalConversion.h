@@ -30,6 +30,7 @@
 #pragma once
 
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioBuffer.h>
 #include <vector>
 #include <cstdint>
 
@@ -53,9 +54,15 @@ std::vector<double> ConvertSigned16ToFloat64(const std::vector<int16_t>& signal,
 //! Converts audio data to 16 bit signed integer samples.
 std::vector<int16_t> ConvertAudioDataToSigned16(const AudioData& audioData);
 
+//! Converts the viewed audio samples to 16 bit signed integer samples.
+std::vector<int16_t> ConvertAudioDataToSigned16(const AudioDataView& audioData);
+
 //! Converts separate audio data streams to a single, 16 bit signed integer samples interleaved (stereo).
 std::vector<int16_t> ConvertAudioDataToInterleavedSigned16(const AudioData& leftChannel, const AudioData& rightChannel);
 
+//! Converts separate views of audio samples to a single, 16 bit signed integer samples interleaved (stereo).
+std::vector<int16_t> ConvertAudioDataToInterleavedSigned16(const AudioDataView& leftChannel, const AudioDataView& rightChannel);
+
 //! Converts 16 bit signed integer samples to an AudioData object.
 AudioData ConvertSigned16ToAudioData(const std::vector<int16_t>& signal);
 
@@ -64,4 +71,13 @@ AudioData ConvertSigned16ToAudioData(const std::vector<int16_t>& signal);
 //! The left channel is index 0.  The right channel is index 1.
 std::vector<AudioData> ConvertInterleavedSigned16ToAudioData(const std::vector<int16_t>& interleavedSigned16);
 
+//! Converts interleaved 16 bit signed integer samples of the given number of channels to an AudioBuffer.
+//
+//! With the interleaved layout the conversion is a single pass over contiguous memory.
+AudioBuffer ConvertInterleavedSigned16ToAudioBuffer(const std::vector<int16_t>& interleavedSigned16, std::size_t channels, 
+                                                    AudioBuffer::Layout layout=AudioBuffer::Layout::INTERLEAVED);
+
+//! Converts all channels of the given AudioBuffer to interleaved 16 bit signed integer samples.
+std::vector<int16_t> ConvertAudioBufferToInterleavedSigned16(const AudioBuffer& audioBuffer);
+
 }
@@ -0,0 +1,115 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FftKernels.h>
+#include <Utilities/Exception.h>
+#include <atomic>
+
+#include <Signal/Source/FftKernelsVector.h>
+
+namespace
+{
+	// Holds the currently selected instruction set, or -1 if it hasn't been detected yet
+	std::atomic<int> currentInstructionSet{-1};
+
+	const Signal::FftKernels::KernelTable* GetKernels(Signal::FftKernels::InstructionSet instructionSet)
+	{
+		switch(instructionSet)
+		{
+			case Signal::FftKernels::InstructionSet::SSE2:
+				return Signal::FftKernels::GetSSE2Kernels();
+			case Signal::FftKernels::InstructionSet::AVX2:
+				return Signal::FftKernels::GetAVX2Kernels();
+			default:
+				return Signal::FftKernels::GetScalarKernels();
+		}
+	}
+}
+
+const Signal::FftKernels::KernelTable* Signal::FftKernels::GetScalarKernels()
+{
+	return &VectorKernels<ScalarLanes>::table_;
+}
+
+Signal::FftKernels::InstructionSet Signal::FftKernels::GetBestInstructionSet()
+{
+	for(auto instructionSet : {InstructionSet::AVX2, InstructionSet::SSE2})
+	{
+		if(IsInstructionSetSupported(instructionSet))
+		{
+			return instructionSet;
+		}
+	}
+
+	return InstructionSet::SCALAR;
+}
+
+bool Signal::FftKernels::IsInstructionSetSupported(InstructionSet instructionSet)
+{
+	return GetKernels(instructionSet) != nullptr;
+}
+
+Signal::FftKernels::InstructionSet Signal::FftKernels::GetInstructionSet()
+{
+	int instructionSet{currentInstructionSet.load(std::memory_order_relaxed)};
+	if(instructionSet < 0)
+	{
+		instructionSet = static_cast<int>(GetBestInstructionSet());
+		currentInstructionSet.store(instructionSet, std::memory_order_relaxed);
+	}
+
+	return static_cast<InstructionSet>(instructionSet);
+}
+
+void Signal::FftKernels::SetInstructionSet(InstructionSet instructionSet)
+{
+	if(!IsInstructionSetSupported(instructionSet))
+	{
+		Utilities::ThrowException("Attempting to use an instruction set that isn't supported", static_cast<int>(instructionSet));
+	}
+
+	currentInstructionSet.store(static_cast<int>(instructionSet), std::memory_order_relaxed);
+}
+
+void Signal::FftKernels::Radix2Pass(double* real, double* imaginary, std::size_t size)
+{
+	for(std::size_t i{0}; i < size; i += 2)
+	{
+		double tr{real[i + 1]};
+		double ti{imaginary[i + 1]};
+
+		real[i + 1] = real[i] - tr;
+		imaginary[i + 1] = imaginary[i] - ti;
+
+		real[i] = real[i] + tr;
+		imaginary[i] = imaginary[i] + ti;
+	}
+}
+
+void Signal::FftKernels::Radix4Pass(double* real, double* imaginary, std::size_t size, std::size_t quarter, const double* twiddles)
+{
+	GetKernels(GetInstructionSet())->radix4Pass_(real, imaginary, size, quarter, twiddles);
+}
@@ -0,0 +1,94 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FftKernels.h
+//! @brief Vectorized butterfly kernels used by FftPlan.
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define FFT_KERNELS_X86
+#endif
+
+//! The butterfly passes behind FftPlan's transforms.
+//
+//! The FFT is done as radix-4 passes, each one the same arithmetic as two radix-2 stages, which 
+//! halves the number of sweeps over the data.  Within a pass consecutive butterflies use 
+//! consecutive twiddle factors, so the butterflies are vectorized across the lanes of SSE2 or AVX2 
+//! registers.  The best instruction set supported by the CPU is detected at runtime the first 
+//! time a kernel is called.  No fused multiply-adds are used, so every instruction set gives 
+//! results bit-exact with the scalar implementation.
+
+namespace Signal {
+
+namespace FftKernels
+{
+	enum class InstructionSet
+	{
+		SCALAR,
+		SSE2,
+		AVX2
+	};
+
+	//! Returns the best instruction set supported by the CPU we're running on.
+	InstructionSet GetBestInstructionSet();
+
+	//! Returns true if the given instruction set was compiled in and is supported by the CPU.
+	bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+	//! Returns the instruction set the kernels are currently using.
+	InstructionSet GetInstructionSet();
+
+	//! Forces the kernels to use the given instruction set.  Mostly useful for testing.
+	//
+	//! An exception is thrown if the instruction set isn't supported.
+	void SetInstructionSet(InstructionSet instructionSet);
+
+	//! Performs the first radix-2 stage (butterflies of adjacent values, all with a twiddle of one).
+	void Radix2Pass(double* real, double* imaginary, std::size_t size);
+
+	//! Performs a radix-4 pass combining the stages spanning 2*quarter and 4*quarter values.
+	//
+	//! The twiddles hold 4*quarter values: the real and imaginary parts of W(2*quarter)^j 
+	//! followed by the real and imaginary parts of W(4*quarter)^j, for j in [0, quarter).
+	void Radix4Pass(double* real, double* imaginary, std::size_t size, std::size_t quarter, const double* twiddles);
+
+	//! The table of kernels provided by a single instruction set.
+	struct KernelTable
+	{
+		void (*radix4Pass_)(double*, double*, std::size_t, std::size_t, const double*);
+	};
+
+	// Each returns nullptr when the instruction set isn't compiled in for this platform or isn't 
+	// supported by the CPU.
+	const KernelTable* GetScalarKernels();
+	const KernelTable* GetSSE2Kernels();
+	const KernelTable* GetAVX2Kernels();
+}
+
+}
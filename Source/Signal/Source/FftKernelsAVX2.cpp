@@ -0,0 +1,88 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FftKernels.h>
+
+#if defined(FFT_KERNELS_X86)
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define FFT_KERNEL_TARGET
+#else
+	#define FFT_KERNEL_TARGET __attribute__((target("avx2")))
+#endif
+
+#include <Signal/Source/FftKernelsVector.h>
+
+// Only the functions in this file marked with FFT_KERNEL_TARGET are compiled for AVX2, so the rest 
+// of the library still runs on CPUs without it.  FMA isn't enabled, which keeps the results 
+// bit-exact with the other instruction sets.
+
+namespace
+{
+	struct AVX2Lanes
+	{
+		using Vector = __m256d;
+		static const std::size_t LANES{4};
+		FFT_KERNEL_TARGET static Vector Load(const double* data) { return _mm256_loadu_pd(data); }
+		FFT_KERNEL_TARGET static void Store(double* data, Vector value) { _mm256_storeu_pd(data, value); }
+		FFT_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+		FFT_KERNEL_TARGET static Vector Sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+		FFT_KERNEL_TARGET static Vector Mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+	};
+
+	bool CpuSupportsAVX2()
+	{
+#if defined(_MSC_VER)
+		// AVX2 needs both the CPU support (leaf 7 EBX bit 5) and the OS saving the YMM registers (OSXSAVE 
+		// set and XCR0 bits 1 and 2 set).
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 1);
+		bool osSavesYmmRegisters{(cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6};
+		__cpuidex(cpuInfo, 7, 0);
+		return osSavesYmmRegisters && (cpuInfo[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+}
+
+const Signal::FftKernels::KernelTable* Signal::FftKernels::GetAVX2Kernels()
+{
+	static const bool supported{CpuSupportsAVX2()};
+	return supported ? &VectorKernels<AVX2Lanes>::table_ : nullptr;
+}
+
+#else
+
+const Signal::FftKernels::KernelTable* Signal::FftKernels::GetAVX2Kernels()
+{
+	return nullptr;
+}
+
+#endif
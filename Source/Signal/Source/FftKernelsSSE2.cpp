@@ -0,0 +1,63 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FftKernels.h>
+
+#if defined(FFT_KERNELS_X86)
+
+#include <emmintrin.h>
+#include <Signal/Source/FftKernelsVector.h>
+
+// SSE2 is part of the x86-64 baseline so no special compiler attributes are needed and the CPU 
+// never has to be checked for support.
+
+namespace
+{
+	struct SSE2Lanes
+	{
+		using Vector = __m128d;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return _mm_loadu_pd(data); }
+		static void Store(double* data, Vector value) { _mm_storeu_pd(data, value); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+		static Vector Sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+		static Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+	};
+}
+
+const Signal::FftKernels::KernelTable* Signal::FftKernels::GetSSE2Kernels()
+{
+	return &VectorKernels<SSE2Lanes>::table_;
+}
+
+#else
+
+const Signal::FftKernels::KernelTable* Signal::FftKernels::GetSSE2Kernels()
+{
+	return nullptr;
+}
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FftKernelsVector.h
+//! @brief The butterfly loops shared by each instruction set's implementation.
+//
+//! Each instruction set's translation unit defines FFT_KERNEL_TARGET (the function attributes 
+//! needed to compile for that instruction set), defines its lane traits and then includes this 
+//! file.  Everything here has internal linkage on purpose.  The same code is compiled for 
+//! different instruction sets in different translation units and those copies must never be 
+//! merged by the linker.
+
+#pragma once
+
+#include <Signal/Source/FftKernels.h>
+
+#ifndef FFT_KERNEL_TARGET
+	#define FFT_KERNEL_TARGET
+#endif
+
+namespace
+{
+	// The two radix-2 stages of a pass, for the four values j, j+q, j+2q and j+3q of a block:
+	// 	first stage (twiddle w1 = W(2q)^j):  a' = a + w1*b, b' = a - w1*b, c' = c + w1*d, d' = c - w1*d
+	// 	second stage (twiddle w2 = W(4q)^j): a'' = a' + w2*c', c'' = a' - w2*c'
+	// 	                                     b'' = b' - i*w2*d', d'' = b' + i*w2*d'
+	// since W(4q)^(j+q) = -i*W(4q)^j.  The complex multiplies are written exactly as in the radix-2 FFT.
+	template<typename V>
+	FFT_KERNEL_TARGET inline void Radix4Butterfly(double* real, double* imaginary, std::size_t block, std::size_t j, 
+												  std::size_t quarter, const double* twiddles)
+	{
+		double* r0{real + block + j};
+		double* r1{r0 + quarter};
+		double* r2{r1 + quarter};
+		double* r3{r2 + quarter};
+		double* i0{imaginary + block + j};
+		double* i1{i0 + quarter};
+		double* i2{i1 + quarter};
+		double* i3{i2 + quarter};
+
+		auto w1r(V::Load(twiddles + j));
+		auto w1i(V::Load(twiddles + quarter + j));
+		auto w2r(V::Load(twiddles + 2 * quarter + j));
+		auto w2i(V::Load(twiddles + 3 * quarter + j));
+
+		auto ar(V::Load(r0));
+		auto ai(V::Load(i0));
+		auto br(V::Load(r1));
+		auto bi(V::Load(i1));
+		auto cr(V::Load(r2));
+		auto ci(V::Load(i2));
+		auto dr(V::Load(r3));
+		auto di(V::Load(i3));
+
+		// First stage
+		auto tr(V::Sub(V::Mul(br, w1r), V::Mul(bi, w1i)));
+		auto ti(V::Add(V::Mul(br, w1i), V::Mul(bi, w1r)));
+		br = V::Sub(ar, tr);
+		bi = V::Sub(ai, ti);
+		ar = V::Add(ar, tr);
+		ai = V::Add(ai, ti);
+
+		tr = V::Sub(V::Mul(dr, w1r), V::Mul(di, w1i));
+		ti = V::Add(V::Mul(dr, w1i), V::Mul(di, w1r));
+		dr = V::Sub(cr, tr);
+		di = V::Sub(ci, ti);
+		cr = V::Add(cr, tr);
+		ci = V::Add(ci, ti);
+
+		// Second stage
+		tr = V::Sub(V::Mul(cr, w2r), V::Mul(ci, w2i));
+		ti = V::Add(V::Mul(cr, w2i), V::Mul(ci, w2r));
+		V::Store(r2, V::Sub(ar, tr));
+		V::Store(i2, V::Sub(ai, ti));
+		V::Store(r0, V::Add(ar, tr));
+		V::Store(i0, V::Add(ai, ti));
+
+		// Multiplying by -i turns (tr, ti) into (ti, -tr)
+		tr = V::Sub(V::Mul(dr, w2r), V::Mul(di, w2i));
+		ti = V::Add(V::Mul(dr, w2i), V::Mul(di, w2r));
+		V::Store(r3, V::Sub(br, ti));
+		V::Store(i3, V::Add(bi, tr));
+		V::Store(r1, V::Add(br, ti));
+		V::Store(i1, V::Sub(bi, tr));
+	}
+
+	// The scalar lanes used for the butterflies that don't fill a whole vector
+	struct ScalarLanes
+	{
+		using Vector = double;
+		static const std::size_t LANES{1};
+		static double Load(const double* data) { return *data; }
+		static void Store(double* data, double value) { *data = value; }
+		static double Add(double a, double b) { return a + b; }
+		static double Sub(double a, double b) { return a - b; }
+		static double Mul(double a, double b) { return a * b; }
+	};
+
+	template<typename V>
+	FFT_KERNEL_TARGET void Radix4PassKernel(double* real, double* imaginary, std::size_t size, std::size_t quarter, 
+											const double* twiddles)
+	{
+		for(std::size_t block{0}; block < size; block += 4 * quarter)
+		{
+			std::size_t j{0};
+			for(; j + V::LANES <= quarter; j += V::LANES)
+			{
+				Radix4Butterfly<V>(real, imaginary, block, j, quarter, twiddles);
+			}
+
+			for(; j < quarter; ++j)
+			{
+				Radix4Butterfly<ScalarLanes>(real, imaginary, block, j, quarter, twiddles);
+			}
+		}
+	}
+
+	template<typename V>
+	struct VectorKernels
+	{
+		static const Signal::FftKernels::KernelTable table_;
+	};
+
+	template<typename V>
+	const Signal::FftKernels::KernelTable VectorKernels<V>::table_{&Radix4PassKernel<V>};
+}
@@ -0,0 +1,538 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/FftPlan.h>
+#include <Signal/Fourier.h>
+#include <Signal/Source/FftKernels.h>
+#include <Signal/Source/WeakCache.h>
+#include <Utilities/Exception.h>
+#include <Utilities/MemoryPool.h>
+#define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
+#include <math.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+// Creating a plan may need other plans (the half size plan or the Bluestein convolution plan), which the 
+// plan holds on to, so they live as long as it does.
+std::shared_ptr<const Signal::Fourier::FftPlan> Signal::Fourier::FftPlan::GetPlan(std::size_t size)
+{
+	static std::mutex mutex;
+	static std::map<std::size_t, std::weak_ptr<const FftPlan>> plans;
+
+	return GetCachedValue(plans, mutex, size, [&]()
+	{
+		return std::make_shared<const FftPlan>(size);
+	});
+}
+
+Signal::Fourier::FftPlan::FftPlan(std::size_t size) :
+	size_{size}
+{
+	if(size_ == 0)
+	{
+		Utilities::ThrowException("FftPlan: The FFT size must be at least one");
+	}
+
+	// Each twiddle factor is calculated directly rather than by recurrence so no error accumulates across a stage
+	twiddleReal_.reserve(size_ / 2);
+	twiddleImaginary_.reserve(size_ / 2);
+	for(std::size_t k{0}; k < size_ / 2; ++k)
+	{
+		double angle{2.0 * M_PI * static_cast<double>(k) / static_cast<double>(size_)};
+		twiddleReal_.push_back(cos(angle));
+		twiddleImaginary_.push_back(-1.0 * sin(angle));
+	}
+
+	if(Signal::Fourier::IsPowerOfTwo(size_))
+	{
+		PreparePowerOfTwo();
+	}
+	else
+	{
+		auto radices{GetRadices(size_)};
+		if(radices.empty())
+		{
+			PrepareBluestein();
+		}
+		else
+		{
+			PrepareMixedRadix(radices);
+		}
+	}
+
+	if(size_ % 2 == 0)
+	{
+		halfPlan_ = GetPlan(size_ / 2);
+	}
+}
+
+std::size_t Signal::Fourier::FftPlan::GetSize() const
+{
+	return size_;
+}
+
+void Signal::Fourier::FftPlan::Forward(double* real, double* imaginary) const
+{
+	switch(algorithm_)
+	{
+		case Algorithm::POWER_OF_TWO:
+			ForwardPowerOfTwo(real, imaginary);
+			break;
+		case Algorithm::MIXED_RADIX:
+			ForwardMixedRadix(real, imaginary);
+			break;
+		case Algorithm::BLUESTEIN:
+			ForwardBluestein(real, imaginary);
+			break;
+	}
+}
+
+// The inverse is program 12-5 of "The Scientist and Engineer's Guide to Digital Signal Processing", the final sign 
+// change of the imaginary values gives the conjugate back so the output is the true inverse.
+void Signal::Fourier::FftPlan::Inverse(double* real, double* imaginary) const
+{
+	for(std::size_t i{0}; i < size_; ++i)
+	{
+		imaginary[i] *= -1;
+	}
+
+	Forward(real, imaginary);
+
+	double N{static_cast<double>(size_)};
+	for(std::size_t i{0}; i < size_; ++i)
+	{
+		real[i] = real[i] / N;
+		imaginary[i] = -1.0 * imaginary[i] / N;
+	}
+}
+
+// For even sizes the real input is packed as z[n] = x[2n] + i*x[2n+1] and transformed with a complex FFT of half 
+// the size.  The transforms of the even and odd samples are then untangled from Z using the symmetry of real signals:
+// 	Even[k] = (Z[k] + conj(Z[M-k])) / 2
+// 	Odd[k] = (Z[k] - conj(Z[M-k])) / 2i
+// 	X[k] = Even[k] + W^k * Odd[k]
+// Bins k and M-k are untangled together so the output arrays can double as the half size transform's buffers.
+// Odd sizes can't be packed, so they get a complex transform of the full size.
+void Signal::Fourier::FftPlan::ForwardReal(const double* input, double* real, double* imaginary) const
+{
+	if(size_ % 2)
+	{
+		Utilities::PoolVector<double> fullReal(input, input + size_);
+		Utilities::PoolVector<double> fullImaginary(size_, 0.0);
+		Forward(fullReal.data(), fullImaginary.data());
+
+		std::copy(fullReal.begin(), fullReal.begin() + size_ / 2 + 1, real);
+		std::copy(fullImaginary.begin(), fullImaginary.begin() + size_ / 2 + 1, imaginary);
+		return;
+	}
+
+	std::size_t M{size_ / 2};
+	for(std::size_t n{0}; n < M; ++n)
+	{
+		real[n] = input[2 * n];
+		imaginary[n] = input[2 * n + 1];
+	}
+
+	halfPlan_->Forward(real, imaginary);
+
+	double zeroReal{real[0]};
+	double zeroImaginary{imaginary[0]};
+	real[0] = zeroReal + zeroImaginary;
+	imaginary[0] = 0.0;
+	real[M] = zeroReal - zeroImaginary;
+	imaginary[M] = 0.0;
+
+	for(std::size_t k{1}; k <= M / 2; ++k)
+	{
+		std::size_t mirror{M - k};
+
+		double evenReal{(real[k] + real[mirror]) / 2.0};
+		double evenImaginary{(imaginary[k] - imaginary[mirror]) / 2.0};
+		double oddReal{(imaginary[k] + imaginary[mirror]) / 2.0};
+		double oddImaginary{(real[mirror] - real[k]) / 2.0};
+
+		// The twiddle for M-k is -conj(W^k), and Even and Odd at M-k are the conjugates of those at k
+		double twiddledReal{twiddleReal_[k] * oddReal - twiddleImaginary_[k] * oddImaginary};
+		double twiddledImaginary{twiddleReal_[k] * oddImaginary + twiddleImaginary_[k] * oddReal};
+
+		real[k] = evenReal + twiddledReal;
+		imaginary[k] = evenImaginary + twiddledImaginary;
+		real[mirror] = evenReal - twiddledReal;
+		imaginary[mirror] = twiddledImaginary - evenImaginary;
+	}
+}
+
+// The reverse of ForwardReal(): for even sizes Z[k] = Even[k] + i*Odd[k] is rebuilt from the bins using
+// 	Even[k] = (X[k] + conj(X[M-k])) / 2
+// 	Odd[k] = (X[k] - conj(X[M-k])) * conj(W^k) / 2
+// and the half size inverse transform of Z gives the even samples in its real part and the odd ones in its imaginary 
+// part.  Odd sizes rebuild the negative frequencies from the positive ones and do a complex inverse of the full size.
+void Signal::Fourier::FftPlan::InverseReal(const double* real, const double* imaginary, double* output) const
+{
+	if(size_ % 2)
+	{
+		Utilities::PoolVector<double> fullReal(size_);
+		Utilities::PoolVector<double> fullImaginary(size_);
+		fullReal[0] = real[0];
+		fullImaginary[0] = 0.0;
+		for(std::size_t k{1}; k <= size_ / 2; ++k)
+		{
+			fullReal[k] = real[k];
+			fullImaginary[k] = imaginary[k];
+			fullReal[size_ - k] = real[k];
+			fullImaginary[size_ - k] = -1.0 * imaginary[k];
+		}
+
+		Inverse(fullReal.data(), fullImaginary.data());
+		std::copy(fullReal.begin(), fullReal.end(), output);
+		return;
+	}
+
+	std::size_t M{size_ / 2};
+	Utilities::PoolVector<double> zReal(M);
+	Utilities::PoolVector<double> zImaginary(M);
+
+	zReal[0] = (real[0] + real[M]) / 2.0;
+	zImaginary[0] = (real[0] - real[M]) / 2.0;
+
+	for(std::size_t k{1}; k <= M / 2; ++k)
+	{
+		std::size_t mirror{M - k};
+
+		double evenReal{(real[k] + real[mirror]) / 2.0};
+		double evenImaginary{(imaginary[k] - imaginary[mirror]) / 2.0};
+		double differenceReal{(real[k] - real[mirror]) / 2.0};
+		double differenceImaginary{(imaginary[k] + imaginary[mirror]) / 2.0};
+
+		// Multiply by conj(W^k)
+		double oddReal{differenceReal * twiddleReal_[k] + differenceImaginary * twiddleImaginary_[k]};
+		double oddImaginary{differenceImaginary * twiddleReal_[k] - differenceReal * twiddleImaginary_[k]};
+
+		// Z[k] = Even[k] + i*Odd[k], and at M-k both Even and Odd are conjugated
+		zReal[k] = evenReal - oddImaginary;
+		zImaginary[k] = evenImaginary + oddReal;
+		zReal[mirror] = evenReal + oddImaginary;
+		zImaginary[mirror] = oddReal - evenImaginary;
+	}
+
+	halfPlan_->Inverse(zReal.data(), zImaginary.data());
+
+	for(std::size_t n{0}; n < M; ++n)
+	{
+		output[2 * n] = zReal[n];
+		output[2 * n + 1] = zImaginary[n];
+	}
+}
+
+void Signal::Fourier::FftPlan::PreparePowerOfTwo()
+{
+	algorithm_ = Algorithm::POWER_OF_TWO;
+	swaps_ = CalculateBitReversalSwaps(size_);
+
+	// W(2q)^j is W(N)^(j*N/2q) and W(4q)^j is W(N)^(j*N/4q)
+	for(std::size_t quarter{1}; quarter * 4 <= size_; quarter *= 2)
+	{
+		std::vector<double> twiddles(4 * quarter);
+		for(std::size_t j{0}; j < quarter; ++j)
+		{
+			twiddles[j] = twiddleReal_[j * size_ / (2 * quarter)];
+			twiddles[quarter + j] = twiddleImaginary_[j * size_ / (2 * quarter)];
+			twiddles[2 * quarter + j] = twiddleReal_[j * size_ / (4 * quarter)];
+			twiddles[3 * quarter + j] = twiddleImaginary_[j * size_ / (4 * quarter)];
+		}
+
+		passTwiddles_.push_back(std::move(twiddles));
+	}
+}
+
+void Signal::Fourier::FftPlan::PrepareMixedRadix(const std::vector<std::size_t>& radices)
+{
+	algorithm_ = Algorithm::MIXED_RADIX;
+
+	std::size_t length{size_};
+	for(auto radix : radices)
+	{
+		Stage stage;
+		stage.radix_ = radix;
+		stage.length_ = length;
+
+		for(std::size_t t{0}; t < radix; ++t)
+		{
+			double angle{2.0 * M_PI * static_cast<double>(t) / static_cast<double>(radix)};
+			stage.rootReal_.push_back(cos(angle));
+			stage.rootImaginary_.push_back(-1.0 * sin(angle));
+		}
+
+		// Reducing the exponent modulo the length keeps the angles small and so accurate
+		for(std::size_t j{0}; j < length / radix; ++j)
+		{
+			for(std::size_t k{1}; k < radix; ++k)
+			{
+				double angle{2.0 * M_PI * static_cast<double>((j * k) % length) / static_cast<double>(length)};
+				stage.twiddleReal_.push_back(cos(angle));
+				stage.twiddleImaginary_.push_back(-1.0 * sin(angle));
+			}
+		}
+
+		stages_.push_back(std::move(stage));
+		length /= radix;
+	}
+}
+
+void Signal::Fourier::FftPlan::PrepareBluestein()
+{
+	algorithm_ = Algorithm::BLUESTEIN;
+
+	// The linear convolution of N values with 2N-1 filter taps must fit in the circular one
+	std::size_t convolutionSize{1};
+	while(convolutionSize < 2 * size_ - 1)
+	{
+		convolutionSize *= 2;
+	}
+
+	convolutionPlan_ = GetPlan(convolutionSize);
+
+	// k^2 is reduced modulo 2N, the period of the chirp, so the angle stays accurate for large k
+	for(std::size_t k{0}; k < size_; ++k)
+	{
+		double angle{M_PI * static_cast<double>((k * k) % (2 * size_)) / static_cast<double>(size_)};
+		chirpReal_.push_back(cos(angle));
+		chirpImaginary_.push_back(-1.0 * sin(angle));
+	}
+
+	// The filter is the conjugate chirp for lags -(N-1) to N-1, wrapped around the circular buffer
+	filterReal_.assign(convolutionSize, 0.0);
+	filterImaginary_.assign(convolutionSize, 0.0);
+	for(std::size_t k{0}; k < size_; ++k)
+	{
+		filterReal_[k] = chirpReal_[k];
+		filterImaginary_[k] = -1.0 * chirpImaginary_[k];
+		if(k > 0)
+		{
+			filterReal_[convolutionSize - k] = filterReal_[k];
+			filterImaginary_[convolutionSize - k] = filterImaginary_[k];
+		}
+	}
+
+	convolutionPlan_->Forward(filterReal_.data(), filterImaginary_.data());
+}
+
+// This is the decimation in time FFT of program 12-4 of "The Scientist and Engineer's Guide to Digital Signal 
+// Processing", with the bit reversal and twiddle factors coming from the plan's tables and its radix-2 stages 
+// done in pairs.
+void Signal::Fourier::FftPlan::ForwardPowerOfTwo(double* real, double* imaginary) const
+{
+	for(const auto& swap : swaps_)
+	{
+		std::swap(real[swap.first], real[swap.second]);
+		std::swap(imaginary[swap.first], imaginary[swap.second]);
+	}
+
+	std::size_t stages{0};
+	while((static_cast<std::size_t>(1) << stages) < size_)
+	{
+		++stages;
+	}
+
+	std::size_t quarter{1};
+	std::size_t passIndex{0};
+	if(stages % 2)
+	{
+		FftKernels::Radix2Pass(real, imaginary, size_);
+		quarter = 2;
+		passIndex = 1;
+	}
+
+	for(; quarter * 4 <= size_; quarter *= 4, passIndex += 2)
+	{
+		FftKernels::Radix4Pass(real, imaginary, size_, quarter, passTwiddles_[passIndex].data());
+	}
+}
+
+// A Stockham autosort FFT, which needs no bit reversal as each stage reorders its output.  A stage of radix p 
+// splits each transform of length n (whose values are "stride" apart) into p transforms of length m = n/p:
+// 	z_k[j] = W(n)^(j*k) * sum over r of x[j + r*m] * W(p)^(r*k)
+// and the transform of z_k gives the outputs k, k + p, k + 2p, ... of the length n transform.
+void Signal::Fourier::FftPlan::ForwardMixedRadix(double* real, double* imaginary) const
+{
+	Utilities::PoolVector<double> scratchReal(size_);
+	Utilities::PoolVector<double> scratchImaginary(size_);
+
+	double* inputReal{real};
+	double* inputImaginary{imaginary};
+	double* outputReal{scratchReal.data()};
+	double* outputImaginary{scratchImaginary.data()};
+
+	const std::size_t MAXIMUM_RADIX{7};
+	double valuesReal[MAXIMUM_RADIX];
+	double valuesImaginary[MAXIMUM_RADIX];
+
+	std::size_t stride{1};
+	for(const auto& stage : stages_)
+	{
+		std::size_t radix{stage.radix_};
+		std::size_t m{stage.length_ / radix};
+
+		for(std::size_t j{0}; j < m; ++j)
+		{
+			const double* twiddleReal{stage.twiddleReal_.data() + j * (radix - 1)};
+			const double* twiddleImaginary{stage.twiddleImaginary_.data() + j * (radix - 1)};
+
+			for(std::size_t q{0}; q < stride; ++q)
+			{
+				for(std::size_t r{0}; r < radix; ++r)
+				{
+					valuesReal[r] = inputReal[q + stride * (j + r * m)];
+					valuesImaginary[r] = inputImaginary[q + stride * (j + r * m)];
+				}
+
+				for(std::size_t k{0}; k < radix; ++k)
+				{
+					double sumReal{0.0};
+					double sumImaginary{0.0};
+					std::size_t rootIndex{0};
+					for(std::size_t r{0}; r < radix; ++r)
+					{
+						double rootReal{stage.rootReal_[rootIndex]};
+						double rootImaginary{stage.rootImaginary_[rootIndex]};
+						sumReal += valuesReal[r] * rootReal - valuesImaginary[r] * rootImaginary;
+						sumImaginary += valuesReal[r] * rootImaginary + valuesImaginary[r] * rootReal;
+
+						rootIndex += k;
+						if(rootIndex >= radix)
+						{
+							rootIndex -= radix;
+						}
+					}
+
+					if(k > 0)
+					{
+						double tr{sumReal * twiddleReal[k - 1] - sumImaginary * twiddleImaginary[k - 1]};
+						sumImaginary = sumReal * twiddleImaginary[k - 1] + sumImaginary * twiddleReal[k - 1];
+						sumReal = tr;
+					}
+
+					outputReal[q + stride * (radix * j + k)] = sumReal;
+					outputImaginary[q + stride * (radix * j + k)] = sumImaginary;
+				}
+			}
+		}
+
+		std::swap(inputReal, outputReal);
+		std::swap(inputImaginary, outputImaginary);
+		stride *= radix;
+	}
+
+	if(inputReal != real)
+	{
+		std::copy(inputReal, inputReal + size_, real);
+		std::copy(inputImaginary, inputImaginary + size_, imaginary);
+	}
+}
+
+// Bluestein's algorithm uses nk = (n^2 + k^2 - (k-n)^2) / 2 to write the DFT as
+// 	X[k] = c[k] * sum over n of (x[n] * c[n]) * conj(c[k-n])
+// where c is the chirp e^(-i*pi*k^2/N).  The sum is a convolution, which is done with power of two FFTs.
+void Signal::Fourier::FftPlan::ForwardBluestein(double* real, double* imaginary) const
+{
+	std::size_t convolutionSize{convolutionPlan_->GetSize()};
+	Utilities::PoolVector<double> convolutionReal(convolutionSize, 0.0);
+	Utilities::PoolVector<double> convolutionImaginary(convolutionSize, 0.0);
+
+	for(std::size_t n{0}; n < size_; ++n)
+	{
+		convolutionReal[n] = real[n] * chirpReal_[n] - imaginary[n] * chirpImaginary_[n];
+		convolutionImaginary[n] = real[n] * chirpImaginary_[n] + imaginary[n] * chirpReal_[n];
+	}
+
+	convolutionPlan_->Forward(convolutionReal.data(), convolutionImaginary.data());
+
+	for(std::size_t k{0}; k < convolutionSize; ++k)
+	{
+		double tr{convolutionReal[k] * filterReal_[k] - convolutionImaginary[k] * filterImaginary_[k]};
+		convolutionImaginary[k] = convolutionReal[k] * filterImaginary_[k] + convolutionImaginary[k] * filterReal_[k];
+		convolutionReal[k] = tr;
+	}
+
+	convolutionPlan_->Inverse(convolutionReal.data(), convolutionImaginary.data());
+
+	for(std::size_t k{0}; k < size_; ++k)
+	{
+		real[k] = convolutionReal[k] * chirpReal_[k] - convolutionImaginary[k] * chirpImaginary_[k];
+		imaginary[k] = convolutionReal[k] * chirpImaginary_[k] + convolutionImaginary[k] * chirpReal_[k];
+	}
+}
+
+// Returns the radices of a mixed-radix FFT of the given size, or nothing if the size has a prime factor above 7.  
+// Radix 4 is preferred over two radix 2 stages since it needs fewer passes over the data.
+std::vector<std::size_t> Signal::Fourier::FftPlan::GetRadices(std::size_t size)
+{
+	std::vector<std::size_t> radices;
+	for(std::size_t radix : {4, 2, 3, 5, 7})
+	{
+		while(size % radix == 0)
+		{
+			radices.push_back(radix);
+			size /= radix;
+		}
+	}
+
+	if(size != 1)
+	{
+		radices.clear();
+	}
+
+	return radices;
+}
+
+std::vector<std::pair<uint32_t, uint32_t>> Signal::Fourier::FftPlan::CalculateBitReversalSwaps(std::size_t size)
+{
+	std::vector<std::pair<uint32_t, uint32_t>> swaps;
+
+	// The bit reversal is the same permutation the book's sorting loop produces, just worked out once
+	std::size_t bits{0};
+	while((static_cast<std::size_t>(1) << bits) < size)
+	{
+		++bits;
+	}
+
+	for(std::size_t i{1}; i + 1 < size; ++i)
+	{
+		std::size_t reversed{0};
+		for(std::size_t bit{0}; bit < bits; ++bit)
+		{
+			reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+		}
+
+		if(i < reversed)
+		{
+			swaps.emplace_back(static_cast<uint32_t>(i), static_cast<uint32_t>(reversed));
+		}
+	}
+
+	return swaps;
+}
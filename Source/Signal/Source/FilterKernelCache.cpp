@@ -0,0 +1,162 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FilterKernelCache.h>
+#include <Signal/Source/WeakCache.h>
+#include <Signal/FftPlan.h>
+#define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
+#include <math.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+
+namespace
+{
+	// This is straight out of "The Scientist and Engineer's Guide to Digital Signal Processing" chapter 16 table 16-1.  
+	// The center test wraps around for the tap before the center, so the center value is on two taps.  That limits 
+	// the stopband attenuation to about 16dB however long the filter is, but it's the kernel LowPassFilter and the 
+	// resampler's legacy quality have always used.
+	std::vector<double> CalculateHammingLowPassFilterKernel(double cutoffRatio, std::size_t filterLength)
+	{
+		std::size_t halfFilterLength{filterLength / 2};
+		double twoPI{2.0 * M_PI};
+		std::vector<double> filterKernel;
+		for(std::size_t i = 0; i < filterLength; ++i) {
+
+			if((i - halfFilterLength) / 2 == 0)
+			{
+				filterKernel.push_back(twoPI * cutoffRatio);
+			}
+			else
+			{
+				double position{static_cast<double>(i) - halfFilterLength};
+				filterKernel.push_back(sin(twoPI * cutoffRatio * position) / position);
+			}
+				
+			// Apply windowing
+			filterKernel[i] = filterKernel[i] * (0.54 - 0.46 * cos(2 * M_PI * (float)i / filterLength));
+		}
+		
+		// Normalize the low-pass filter kernal for unity gain at DC
+		double filterKernelSum{std::accumulate(filterKernel.begin(), filterKernel.end(), 0.0)};
+		std::for_each(filterKernel.begin(), filterKernel.end(), [&](double& currentIndexValue) { currentIndexValue /= filterKernelSum; });
+
+		return filterKernel;
+	}
+
+	// The same windowed sinc with a single center tap and a blackman window for more stopband attenuation
+	std::vector<double> CalculateBlackmanLowPassFilterKernel(double cutoffRatio, std::size_t filterLength)
+	{
+		const double pi{3.14159265358979323846};
+		std::size_t halfFilterLength{filterLength / 2};
+		std::vector<double> filterKernel(filterLength);
+		for(std::size_t i{0}; i < filterLength; ++i)
+		{
+			double position{static_cast<double>(i) - static_cast<double>(halfFilterLength)};
+			double sincValue{(i == halfFilterLength) ? 2.0 * pi * cutoffRatio : std::sin(2.0 * pi * cutoffRatio * position) / position};
+			double windowPosition{static_cast<double>(i) / static_cast<double>(filterLength)};
+			filterKernel[i] = sincValue * (0.42 - 0.5 * std::cos(2.0 * pi * windowPosition) + 0.08 * std::cos(4.0 * pi * windowPosition));
+		}
+
+		// Normalize for unity gain at DC
+		double filterKernelSum{std::accumulate(filterKernel.begin(), filterKernel.end(), 0.0)};
+		for(double& value : filterKernel)
+		{
+			value /= filterKernelSum;
+		}
+
+		return filterKernel;
+	}
+}
+
+template<typename T>
+std::shared_ptr<const std::vector<T>> Signal::GetLowPassFilterKernel(double cutoffRatio, std::size_t filterLength, SincWindow window)
+{
+	static std::mutex mutex;
+	static std::map<std::tuple<double, std::size_t, SincWindow>, std::weak_ptr<const std::vector<T>>> kernels;
+
+	return GetCachedValue(kernels, mutex, std::make_tuple(cutoffRatio, filterLength, window), [&]()
+	{
+		std::vector<double> filterKernel{(window == SincWindow::HAMMING) ? CalculateHammingLowPassFilterKernel(cutoffRatio, filterLength) : 
+																			 CalculateBlackmanLowPassFilterKernel(cutoffRatio, filterLength)};
+		return std::make_shared<const std::vector<T>>(filterKernel.begin(), filterKernel.end());
+	});
+}
+
+std::shared_ptr<const Signal::LowPassFilterSpectrum> Signal::GetLowPassFilterSpectrum(double cutoffRatio, std::size_t filterLength, 
+																					   SincWindow window, std::size_t fftSize)
+{
+	static std::mutex mutex;
+	static std::map<std::tuple<double, std::size_t, SincWindow, std::size_t>, std::weak_ptr<const LowPassFilterSpectrum>> spectra;
+
+	return GetCachedValue(spectra, mutex, std::make_tuple(cutoffRatio, filterLength, window, fftSize), [&]()
+	{
+		auto filterKernel{GetLowPassFilterKernel<double>(cutoffRatio, filterLength, window)};
+		std::vector<double> paddedFilterKernel(fftSize, 0.0);
+		std::reverse_copy(filterKernel->begin(), filterKernel->end(), paddedFilterKernel.begin());
+
+		auto spectrum{std::make_shared<LowPassFilterSpectrum>()};
+		spectrum->real.resize(fftSize / 2 + 1);
+		spectrum->imaginary.resize(fftSize / 2 + 1);
+		Fourier::FftPlan::GetPlan(fftSize)->ForwardReal(paddedFilterKernel.data(), spectrum->real.data(), spectrum->imaginary.data());
+
+		return std::shared_ptr<const LowPassFilterSpectrum>{spectrum};
+	});
+}
+
+std::shared_ptr<const std::vector<double>> Signal::GetPolyphaseBanks(const WindowedSincTable& sincTable, std::size_t phases, bool downsampling, 
+																	 std::size_t samplesPerSide, double phaseOffset)
+{
+	static std::mutex mutex;
+	static std::map<std::tuple<double, double, SincWindow, std::size_t, bool, std::size_t, double>, std::weak_ptr<const std::vector<double>>> polyphaseBanks;
+
+	double sincSamplesPerXInteger{sincTable.GetSamplesPerXInteger()};
+	auto key{std::make_tuple(sincSamplesPerXInteger, sincTable.GetMaxXPosition(), sincTable.GetWindow(), phases, downsampling, samplesPerSide, 
+							 phaseOffset)};
+	return GetCachedValue(polyphaseBanks, mutex, key, [&]()
+	{
+		std::size_t bankSize{2 * samplesPerSide + 1};
+		std::size_t banks{phases + 2};
+		auto coefficients{std::make_shared<std::vector<double>>(banks * bankSize)};
+		for(std::size_t bank{0}; bank < banks; ++bank)
+		{
+			std::size_t phase{(downsampling && bank > 0) ? bank + phases - 1 : bank};
+			double xSincPosition{(static_cast<double>(phase) * sincSamplesPerXInteger / static_cast<double>(phases)) + phaseOffset};
+			for(std::size_t i{0}; i < bankSize; ++i)
+			{
+				double offset{static_cast<double>(i) - static_cast<double>(samplesPerSide)};
+				(*coefficients)[bank * bankSize + i] = sincTable.GetValue(xSincPosition + offset * sincSamplesPerXInteger);
+			}
+		}
+
+		return std::shared_ptr<const std::vector<double>>{coefficients};
+	});
+}
+
+template std::shared_ptr<const std::vector<double>> Signal::GetLowPassFilterKernel<double>(double, std::size_t, Signal::SincWindow);
+template std::shared_ptr<const std::vector<float>> Signal::GetLowPassFilterKernel<float>(double, std::size_t, Signal::SincWindow);
@@ -0,0 +1,75 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FilterKernelCache.h
+//! @brief Filter kernels and coefficient banks shared by every filter and resampler using the same ones.
+
+#pragma once
+
+#include <Signal/Source/WindowedSincValues.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+//! Immutable filter kernels and coefficient banks, calculated on first use and then shared process-wide.
+//
+//! Every LowPassFilter and resampler with the same ratio, length and window uses the same coefficients, so many 
+//! streams at a handful of ratios calculate and store each set once.  The cache only holds weak references: a set 
+//! of coefficients is freed when the last filter or resampler using it is destroyed, and calculated again if it's 
+//! needed after that.  Any number of threads can use these at once.
+
+namespace Signal {
+
+	//! Returns the windowed sinc low pass filter kernel for the cutoff ratio (a fraction of the sample rate) and length.
+	//
+	//! The HAMMING kernel is the one LowPassFilter has always used.  The BLACKMAN kernel has a single center tap and 
+	//! attenuates the stopband much further, the resampler uses it at every quality level but legacy.  The kernel is 
+	//! calculated in double and stored as the sample type.
+	template<typename T>
+	std::shared_ptr<const std::vector<T>> GetLowPassFilterKernel(double cutoffRatio, std::size_t filterLength, SincWindow window);
+
+	//! The frequency response of a low pass filter kernel, reversed since filtering correlates the input with the 
+	//! kernel, for FFT convolution.  Each holds fftSize / 2 + 1 bins.
+	struct LowPassFilterSpectrum
+	{
+		std::vector<double> real;
+		std::vector<double> imaginary;
+	};
+
+	//! Returns the spectrum of the GetLowPassFilterKernel() kernel with the same parameters, zero padded to fftSize.
+	std::shared_ptr<const LowPassFilterSpectrum> GetLowPassFilterSpectrum(double cutoffRatio, std::size_t filterLength, SincWindow window, 
+																		  std::size_t fftSize);
+
+	//! Returns the resampler's polyphase coefficient banks for a ratio with the given numerator (once reduced).
+	//
+	//! There are phases + 2 banks of 2 * samplesPerSide + 1 windowed sinc values from sincTable, one after another.  
+	//! Bank b holds the values for the sinc filter at position b * (samples per x integer) / phases when upsampling.  
+	//! When downsampling the position lies between phases and 2 * phases, so bank b > 0 is for phase b + phases - 1.  
+	//! Every position is moved on by phaseOffset, for a sinc filter left between phases by a change of ratio.
+	std::shared_ptr<const std::vector<double>> GetPolyphaseBanks(const WindowedSincTable& sincTable, std::size_t phases, bool downsampling, 
+																 std::size_t samplesPerSide, double phaseOffset = 0.0);
+
+}
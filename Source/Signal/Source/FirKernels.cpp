@@ -0,0 +1,108 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FirKernels.h>
+#include <Utilities/Exception.h>
+#include <atomic>
+
+#include <Signal/Source/FirKernelsVector.h>
+
+namespace
+{
+	// Holds the currently selected instruction set, or -1 if it hasn't been detected yet
+	std::atomic<int> currentInstructionSet{-1};
+
+	template<typename T>
+	const Signal::FirKernels::KernelTable<T>* GetKernels(Signal::FirKernels::InstructionSet instructionSet)
+	{
+		switch(instructionSet)
+		{
+			case Signal::FirKernels::InstructionSet::SSE2:
+				return Signal::FirKernels::GetSSE2Kernels<T>();
+			case Signal::FirKernels::InstructionSet::AVX2:
+				return Signal::FirKernels::GetAVX2Kernels<T>();
+			default:
+				return Signal::FirKernels::GetScalarKernels<T>();
+		}
+	}
+}
+
+template<typename T>
+const Signal::FirKernels::KernelTable<T>* Signal::FirKernels::GetScalarKernels()
+{
+	return &VectorKernels<ScalarLanes, T>::table_;
+}
+
+Signal::FirKernels::InstructionSet Signal::FirKernels::GetBestInstructionSet()
+{
+	for(auto instructionSet : {InstructionSet::AVX2, InstructionSet::SSE2})
+	{
+		if(IsInstructionSetSupported(instructionSet))
+		{
+			return instructionSet;
+		}
+	}
+
+	return InstructionSet::SCALAR;
+}
+
+bool Signal::FirKernels::IsInstructionSetSupported(InstructionSet instructionSet)
+{
+	return GetKernels<double>(instructionSet) != nullptr;
+}
+
+Signal::FirKernels::InstructionSet Signal::FirKernels::GetInstructionSet()
+{
+	int instructionSet{currentInstructionSet.load(std::memory_order_relaxed)};
+	if(instructionSet < 0)
+	{
+		instructionSet = static_cast<int>(GetBestInstructionSet());
+		currentInstructionSet.store(instructionSet, std::memory_order_relaxed);
+	}
+
+	return static_cast<InstructionSet>(instructionSet);
+}
+
+void Signal::FirKernels::SetInstructionSet(InstructionSet instructionSet)
+{
+	if(!IsInstructionSetSupported(instructionSet))
+	{
+		Utilities::ThrowException("Attempting to use an instruction set that isn't supported", static_cast<int>(instructionSet));
+	}
+
+	currentInstructionSet.store(static_cast<int>(instructionSet), std::memory_order_relaxed);
+}
+
+template<typename T>
+void Signal::FirKernels::Filter(const T* input, const T* kernel, std::size_t kernelLength, T* output, std::size_t samples)
+{
+	GetKernels<T>(GetInstructionSet())->filter_(input, kernel, kernelLength, output, samples);
+}
+
+template const Signal::FirKernels::KernelTable<double>* Signal::FirKernels::GetScalarKernels();
+template const Signal::FirKernels::KernelTable<float>* Signal::FirKernels::GetScalarKernels();
+template void Signal::FirKernels::Filter(const double*, const double*, std::size_t, double*, std::size_t);
+template void Signal::FirKernels::Filter(const float*, const float*, std::size_t, float*, std::size_t);
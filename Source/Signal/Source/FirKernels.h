@@ -0,0 +1,93 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FirKernels.h
+//! @brief Vectorized FIR filtering kernels used by LowPassFilter.
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define FIR_KERNELS_X86
+#endif
+
+//! The direct-form convolution behind LowPassFilter.
+//
+//! Rather than vectorizing each output's sum over the taps, which would change the order the 
+//! products are added in, consecutive outputs are computed in the lanes of SSE2 or AVX2 registers.  
+//! Each lane adds its products in tap order exactly as the scalar loop does, and no fused 
+//! multiply-adds are used, so every instruction set gives results bit-exact with the scalar 
+//! implementation.  Several registers of outputs are accumulated at once to hide the latency of 
+//! the additions.  The best instruction set supported by the CPU is detected at runtime the first 
+//! time a kernel is called.
+
+namespace Signal {
+
+namespace FirKernels
+{
+	enum class InstructionSet
+	{
+		SCALAR,
+		SSE2,
+		AVX2
+	};
+
+	//! Returns the best instruction set supported by the CPU we're running on.
+	InstructionSet GetBestInstructionSet();
+
+	//! Returns true if the given instruction set was compiled in and is supported by the CPU.
+	bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+	//! Returns the instruction set the kernels are currently using.
+	InstructionSet GetInstructionSet();
+
+	//! Forces the kernels to use the given instruction set.  Mostly useful for testing.
+	//
+	//! An exception is thrown if the instruction set isn't supported.
+	void SetInstructionSet(InstructionSet instructionSet);
+
+	//! Sets output[i] to the sum of input[i + j] * kernel[j] over the taps, clamped to [-1.0, 1.0].
+	//
+	//! The input must hold samples + kernelLength - 1 samples.
+	template<typename T>
+	void Filter(const T* input, const T* kernel, std::size_t kernelLength, T* output, std::size_t samples);
+
+	//! The table of kernels provided by a single instruction set.
+	template<typename T>
+	struct KernelTable
+	{
+		void (*filter_)(const T*, const T*, std::size_t, T*, std::size_t);
+	};
+
+	// Each returns nullptr when the instruction set isn't compiled in for this platform or isn't 
+	// supported by the CPU.
+	template<typename T> const KernelTable<T>* GetScalarKernels();
+	template<typename T> const KernelTable<T>* GetSSE2Kernels();
+	template<typename T> const KernelTable<T>* GetAVX2Kernels();
+}
+
+}
@@ -0,0 +1,112 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FirKernels.h>
+
+#if defined(FIR_KERNELS_X86)
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define FIR_KERNEL_TARGET
+#else
+	#define FIR_KERNEL_TARGET __attribute__((target("avx2")))
+#endif
+
+#include <Signal/Source/FirKernelsVector.h>
+
+// Only the functions in this file marked with FIR_KERNEL_TARGET are compiled for AVX2, so the rest 
+// of the library still runs on CPUs without it.  FMA isn't enabled, which keeps the results 
+// bit-exact with the other instruction sets.
+
+namespace
+{
+	template<typename T> struct AVX2Lanes;
+
+	template<>
+	struct AVX2Lanes<double>
+	{
+		using Vector = __m256d;
+		static const std::size_t LANES{4};
+		FIR_KERNEL_TARGET static Vector Load(const double* data) { return _mm256_loadu_pd(data); }
+		FIR_KERNEL_TARGET static void Store(double* data, Vector value) { _mm256_storeu_pd(data, value); }
+		FIR_KERNEL_TARGET static Vector Set(double value) { return _mm256_set1_pd(value); }
+		FIR_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+		FIR_KERNEL_TARGET static Vector Mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+
+		// The sample is the second operand so a NaN sample is what gets returned
+		FIR_KERNEL_TARGET static Vector Clamp(Vector value) { return _mm256_min_pd(Set(1.0), _mm256_max_pd(Set(-1.0), value)); }
+	};
+
+	template<>
+	struct AVX2Lanes<float>
+	{
+		using Vector = __m256;
+		static const std::size_t LANES{8};
+		FIR_KERNEL_TARGET static Vector Load(const float* data) { return _mm256_loadu_ps(data); }
+		FIR_KERNEL_TARGET static void Store(float* data, Vector value) { _mm256_storeu_ps(data, value); }
+		FIR_KERNEL_TARGET static Vector Set(float value) { return _mm256_set1_ps(value); }
+		FIR_KERNEL_TARGET static Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+		FIR_KERNEL_TARGET static Vector Mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+		FIR_KERNEL_TARGET static Vector Clamp(Vector value) { return _mm256_min_ps(Set(1.0f), _mm256_max_ps(Set(-1.0f), value)); }
+	};
+
+	bool CpuSupportsAVX2()
+	{
+#if defined(_MSC_VER)
+		// AVX2 needs both the CPU support (leaf 7 EBX bit 5) and the OS saving the YMM registers (OSXSAVE 
+		// set and XCR0 bits 1 and 2 set).
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 1);
+		bool osSavesYmmRegisters{(cpuInfo[2] & (1 << 27)) != 0 && (cpuInfo[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6};
+		__cpuidex(cpuInfo, 7, 0);
+		return osSavesYmmRegisters && (cpuInfo[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+}
+
+template<typename T>
+const Signal::FirKernels::KernelTable<T>* Signal::FirKernels::GetAVX2Kernels()
+{
+	static const bool supported{CpuSupportsAVX2()};
+	return supported ? &VectorKernels<AVX2Lanes, T>::table_ : nullptr;
+}
+
+#else
+
+template<typename T>
+const Signal::FirKernels::KernelTable<T>* Signal::FirKernels::GetAVX2Kernels()
+{
+	return nullptr;
+}
+
+#endif
+
+template const Signal::FirKernels::KernelTable<double>* Signal::FirKernels::GetAVX2Kernels();
+template const Signal::FirKernels::KernelTable<float>* Signal::FirKernels::GetAVX2Kernels();
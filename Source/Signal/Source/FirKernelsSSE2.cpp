@@ -0,0 +1,87 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Source/FirKernels.h>
+
+#if defined(FIR_KERNELS_X86)
+
+#include <emmintrin.h>
+#include <Signal/Source/FirKernelsVector.h>
+
+// SSE2 is part of the x86-64 baseline so no special compiler attributes are needed and the CPU 
+// never has to be checked for support.
+
+namespace
+{
+	template<typename T> struct SSE2Lanes;
+
+	template<>
+	struct SSE2Lanes<double>
+	{
+		using Vector = __m128d;
+		static const std::size_t LANES{2};
+		static Vector Load(const double* data) { return _mm_loadu_pd(data); }
+		static void Store(double* data, Vector value) { _mm_storeu_pd(data, value); }
+		static Vector Set(double value) { return _mm_set1_pd(value); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+		static Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+
+		// The sample is the second operand so a NaN sample is what gets returned
+		static Vector Clamp(Vector value) { return _mm_min_pd(Set(1.0), _mm_max_pd(Set(-1.0), value)); }
+	};
+
+	template<>
+	struct SSE2Lanes<float>
+	{
+		using Vector = __m128;
+		static const std::size_t LANES{4};
+		static Vector Load(const float* data) { return _mm_loadu_ps(data); }
+		static void Store(float* data, Vector value) { _mm_storeu_ps(data, value); }
+		static Vector Set(float value) { return _mm_set1_ps(value); }
+		static Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+		static Vector Mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+		static Vector Clamp(Vector value) { return _mm_min_ps(Set(1.0f), _mm_max_ps(Set(-1.0f), value)); }
+	};
+}
+
+template<typename T>
+const Signal::FirKernels::KernelTable<T>* Signal::FirKernels::GetSSE2Kernels()
+{
+	return &VectorKernels<SSE2Lanes, T>::table_;
+}
+
+#else
+
+template<typename T>
+const Signal::FirKernels::KernelTable<T>* Signal::FirKernels::GetSSE2Kernels()
+{
+	return nullptr;
+}
+
+#endif
+
+template const Signal::FirKernels::KernelTable<double>* Signal::FirKernels::GetSSE2Kernels();
+template const Signal::FirKernels::KernelTable<float>* Signal::FirKernels::GetSSE2Kernels();
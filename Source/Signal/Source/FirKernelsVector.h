@@ -0,0 +1,123 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file FirKernelsVector.h
+//! @brief The filtering loops shared by each instruction set's implementation.
+//
+//! Each instruction set's translation unit defines FIR_KERNEL_TARGET (the function attributes 
+//! needed to compile for that instruction set), defines its lane traits and then includes this 
+//! file.  Everything here has internal linkage on purpose.  The same code is compiled for 
+//! different instruction sets in different translation units and those copies must never be 
+//! merged by the linker.
+
+#pragma once
+
+#include <Signal/Source/FirKernels.h>
+
+#ifndef FIR_KERNEL_TARGET
+	#define FIR_KERNEL_TARGET
+#endif
+
+namespace
+{
+	// Clamps the sample to [-1.0, 1.0].  Written as selects rather than branches so compilers emit 
+	// min/max instructions.  Like the compares it replaces, a NaN sample is passed through unchanged.
+	template<typename T>
+	FIR_KERNEL_TARGET inline T ClampSample(T sample)
+	{
+		sample = sample > T{1} ? T{1} : sample;
+		return sample < T{-1} ? T{-1} : sample;
+	}
+
+	// The scalar lanes, used for the outputs that don't fill a whole vector
+	template<typename T>
+	struct ScalarLanes
+	{
+		using Vector = T;
+		static const std::size_t LANES{1};
+		static T Load(const T* data) { return *data; }
+		static void Store(T* data, T value) { *data = value; }
+		static T Set(T value) { return value; }
+		static T Add(T a, T b) { return a + b; }
+		static T Mul(T a, T b) { return a * b; }
+		static T Clamp(T value) { return ClampSample(value); }
+	};
+
+	// Computes BLOCKS vectors of consecutive outputs starting at output i
+	template<typename V, std::size_t BLOCKS, typename T>
+	FIR_KERNEL_TARGET inline void FilterBlocks(const T* input, const T* kernel, std::size_t kernelLength, T* output, std::size_t i)
+	{
+		typename V::Vector accumulators[BLOCKS];
+		for(std::size_t block{0}; block < BLOCKS; ++block)
+		{
+			accumulators[block] = V::Set(T{0});
+		}
+
+		for(std::size_t j{0}; j < kernelLength; ++j)
+		{
+			auto tap(V::Set(kernel[j]));
+			for(std::size_t block{0}; block < BLOCKS; ++block)
+			{
+				accumulators[block] = V::Add(accumulators[block], V::Mul(V::Load(input + i + block * V::LANES + j), tap));
+			}
+		}
+
+		for(std::size_t block{0}; block < BLOCKS; ++block)
+		{
+			V::Store(output + i + block * V::LANES, V::Clamp(accumulators[block]));
+		}
+	}
+
+	template<typename V, typename T>
+	FIR_KERNEL_TARGET void FilterKernel(const T* input, const T* kernel, std::size_t kernelLength, T* output, std::size_t samples)
+	{
+		const std::size_t BLOCKS{4};
+		std::size_t i{0};
+		for(; i + BLOCKS * V::LANES <= samples; i += BLOCKS * V::LANES)
+		{
+			FilterBlocks<V, BLOCKS>(input, kernel, kernelLength, output, i);
+		}
+
+		for(; i + V::LANES <= samples; i += V::LANES)
+		{
+			FilterBlocks<V, 1>(input, kernel, kernelLength, output, i);
+		}
+
+		for(; i < samples; ++i)
+		{
+			FilterBlocks<ScalarLanes<T>, 1>(input, kernel, kernelLength, output, i);
+		}
+	}
+
+	template<template<typename> class V, typename T>
+	struct VectorKernels
+	{
+		static const Signal::FirKernels::KernelTable<T> table_;
+	};
+
+	template<template<typename> class V, typename T>
+	const Signal::FirKernels::KernelTable<T> VectorKernels<V, T>::table_{&FilterKernel<V<T>, T>};
+}
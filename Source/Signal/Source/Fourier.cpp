@@ -25,13 +25,114 @@
  */
 
 #include <Signal/Fourier.h>
+#include <Signal/FftPlan.h>
 #include <Utilities/Exception.h>
+#include <Utilities/MemoryPool.h>
 #define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
 #include <math.h>
 #include <iostream>
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	// Scratch space for each thread, grown as needed and then kept so repeated transforms of the same 
+	// size don't allocate.  The transforms never call each other, so a single set per thread is enough.
+	struct Scratch
+	{
+		std::vector<double> input_;
+		std::vector<double> output_;
+		std::vector<double> real_;
+		std::vector<double> imaginary_;
+		std::vector<std::shared_ptr<const Signal::Fourier::FftPlan>> plans_;
+	};
+
+	Scratch& GetScratch()
+	{
+		thread_local Scratch scratch;
+		return scratch;
+	}
+
+	// Each thread keeps the last few plans it used, most recent first, so transforms of these sizes don't take 
+	// GetPlan()'s lock each time and the plans aren't freed between them.  A handful covers code alternating 
+	// between a few sizes, such as an analysis size and a block size.
+	const std::size_t maximumPlansPerThread{8};
+
+	const Signal::Fourier::FftPlan& GetPlan(std::size_t size)
+	{
+		auto& plans{GetScratch().plans_};
+		auto plan{std::find_if(plans.begin(), plans.end(), [size](const std::shared_ptr<const Signal::Fourier::FftPlan>& plan) { return plan->GetSize() == size; })};
+		if(plan == plans.end())
+		{
+			if(plans.size() == maximumPlansPerThread)
+			{
+				plans.pop_back();
+			}
+
+			plans.insert(plans.begin(), Signal::Fourier::FftPlan::GetPlan(size));
+		}
+		else
+		{
+			std::rotate(plans.begin(), plan, plan + 1);
+		}
+
+		return *plans.front();
+	}
+
+	double* Grow(std::vector<double>& buffer, std::size_t size)
+	{
+		if(buffer.size() < size)
+		{
+			buffer.resize(size);
+		}
+
+		return buffer.data();
+	}
+
+	// Contiguous double samples are used where they are, anything else is copied to the scratch buffer
+	template<typename T>
+	const double* GetDoubleSamples(const BasicAudioDataView<T>& view, std::vector<double>& scratch)
+	{
+		double* samples{Grow(scratch, view.GetSize())};
+		for(std::size_t i{0}; i < view.GetSize(); ++i)
+		{
+			samples[i] = view[i];
+		}
+
+		return samples;
+	}
+
+	const double* GetDoubleSamples(const BasicAudioDataView<double>& view, std::vector<double>& scratch)
+	{
+		if(view.GetStride() == 1 || view.GetSize() < 2)
+		{
+			return view.GetDataPointer();
+		}
+
+		return GetDoubleSamples<double>(view, scratch);
+	}
+
+	// Has the transform write straight into double samples, or into the scratch buffer to be converted
+	template<typename T, typename Transform>
+	void WriteSamples(std::size_t size, T* samples, Transform transform)
+	{
+		double* output{Grow(GetScratch().output_, size)};
+		transform(output);
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			samples[i] = static_cast<T>(output[i]);
+		}
+	}
+
+	template<typename Transform>
+	void WriteSamples(std::size_t /*size*/, double* samples, Transform transform)
+	{
+		transform(samples);
+	}
+}
 
 bool Signal::Fourier::IsPowerOfTwo(std::size_t number)
 {
@@ -48,7 +149,14 @@ bool Signal::Fourier::IsPowerOfTwo(std::size_t number)
 	return false;
 }
 
-Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const AudioData& timeDomainSignal)
+template<typename T>
+Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioData<T>& timeDomainSignal)
+{
+	return Signal::Fourier::ApplyDFT(timeDomainSignal.View());
+}
+
+template<typename T>
+Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioDataView<T>& timeDomainSignal)
 {
 	/////////////////////////////////////////////////////////////////
 	// Calculate the DFT using the Analysis Equation (Eq 8-4 from "The Scientist and Engineer's Guide to Digital Signal Processing")
@@ -67,21 +175,20 @@ Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const AudioData& timeDomainSig
 		rectangularValues.push_back(frequencyDomainBinValues);
 	}
 
-	auto timeDomain{timeDomainSignal.GetData()};
-
 	for (std::size_t i = 0; i < N; ++i)  // Remember, i runs from 0 to N-1
 	{
 		for (std::size_t k = 0; k <= K; ++k)  // Remember, k runs from 0 to N/2
 		{
-			rectangularValues[k].reX_ += timeDomain[i] * cos(2.0 * M_PI * (double)k * (double)i / (double)N);
-			rectangularValues[k].imX_ += -1.0 * timeDomain[i] * sin(2.0 * M_PI * (double)k * (double)i / (double)N);
+			rectangularValues[k].reX_ += timeDomainSignal[i] * cos(2.0 * M_PI * (double)k * (double)i / (double)N);
+			rectangularValues[k].imX_ += -1.0 * timeDomainSignal[i] * sin(2.0 * M_PI * (double)k * (double)i / (double)N);
 		}
 	}
 
 	return Signal::FrequencyDomain{rectangularValues};
 }
 
-AudioData Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain& frequencyDomainData)
+template<typename T>
+BasicAudioData<T> Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain& frequencyDomainData)
 {
 	std::size_t N{(frequencyDomainData.GetSize() - 1) * 2}; //FOURIER_SIZE;
 	std::size_t K{N / 2};
@@ -105,7 +212,7 @@ AudioData Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain& freque
 	///////////////////////////////////////////////////////////////
 	// Perform the iDFT (See equation 8-2 "The Scientist and Engineer's Guide to Digital Signal Processing")
 
-	AudioData audioData;
+	BasicAudioData<T> audioData;
 
 	for(uint64_t i = 0; i < N; ++i)
 	{
@@ -122,178 +229,95 @@ AudioData Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain& freque
 	return audioData;
 }
 
-// The following is the FFT from program 12-4 of "The Scientist and Engineer's Guide to Digital Signal Processing"
-// See Figure 12-1 in "The Scientist and Engineer's Guide to Digital Signal Processing" to understand the input/output.
-// NOTE: IT HAS GOTO'S IN IT - I WOULD NEVER USE GOTO'S. NOT MY CODE, I JUST COPIED IT VERBATIM AS AN FFT IS NOT 
-// TRIVIAL TO CREATE.
-void ScientistsAndEngineersFFT(std::vector<double>& real, std::vector<double>& imaginary)
+template<typename T>
+Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioData<T>& timeDomainSignal)
 {
-
-	// Preconditions for the FFT:
-	assert(real.size() == imaginary.size());
-	assert(Signal::Fourier::IsPowerOfTwo(real.size()));
-	assert(Signal::Fourier::IsPowerOfTwo(imaginary.size()));
-
-	if(real.size() == imaginary.size())
-	{
-		Utilities::Exception("ScientistsAndEngineersFFT: Given real and imaginary container sizes do not match");
-	}
-
-	if(!Signal::Fourier::IsPowerOfTwo(real.size()) || !Signal::Fourier::IsPowerOfTwo(imaginary.size()))
-	{
-		Utilities::Exception("ScientistsAndEngineersFFT: Real and/or imaginary signal container size is not a power of two");
-	}
-
-	// And now, the FFT (Standard disclaimer: I wanted to make this algorithm identical to what is in the book, this 
-	// is why you'll see a few goto statements.  I wouldn't normally use gotos.)
-
-	std::size_t N{real.size()};
-
-	double tr = 0;  // Needed for declaration of tr
-	double ti = 0;  // Needed for declaration of ti
-	uint64_t k = 0;  // Needed for declaration of k
-
-	auto nm1 = N - 1;
-	auto nd2 = N / 2;
-
-	uint64_t m = static_cast<uint64_t>((log((double)N) / log(2.0)));
-
-	uint64_t j = static_cast<uint64_t>(nd2);
-
-	// The Bit Reversal Sorting happens first  
-	for(uint64_t i = 1; i <= N - 2; ++i)
-	{	
-		if(i >= j) goto GOTO1190;
-
-		tr = real[j];
-		ti = imaginary[j];
-		real[j] = real[i];
-		imaginary[j] = imaginary[i];
-		real[i] = tr;
-		imaginary[i] = ti;
-
-GOTO1190:
-		k = static_cast<uint64_t>(nd2);
-
-GOTO1200:
-		if(k > j) goto GOTO1240;
-
-		j = j - k;
-		k = k / 2;
-		goto GOTO1200;
-
-GOTO1240:
-		j = j + k;
-	}
-
-
-	for(uint64_t l = 1; l <= m; ++l)  // Loop for each "stage"
-	{
-		uint64_t le = static_cast<uint64_t>(pow(2.0, (double)l));
-		double le2 = ((double)le / 2.0);
-
-		double ur = 1.0;
-		double ui = 0.0;
-
-		double sr = cos(M_PI / le2);
-		double si = -1.0 * sin(M_PI / le2);
-
-		for(uint64_t j = 1; j <= le2; ++j)  // Loop for each "sub DFT"
-		{
-			uint64_t jm1 = j - 1;
-			for(uint64_t i = jm1; i <= nm1; i += le)  // Loop for each "butterfly"
-			{
-				uint64_t ip = i + static_cast<uint64_t>(le2);
-
-				tr = real[ip] * ur - imaginary[ip] * ui;
-				ti = real[ip] * ui + imaginary[ip] * ur;
-
-				real[ip] = real[i] - tr;
-				imaginary[ip] = imaginary[i] - ti;
-
-				real[i] = real[i] + tr;
-				imaginary[i] = imaginary[i] + ti;
-			}
-
-			tr = ur;
-			ur = tr * sr - ui * si;
-			ui = tr * si + ui * sr;
-		}
-	}
-}
-
-// The following is the FFT from program 12-5 of "The Scientist and Engineer's Guide to Digital Signal Processing"
-void ScientistsAndEngineersInverseFFT(std::vector<double>& real, std::vector<double>& imaginary)
-{
-	// Preconditions for the FFT:
-	assert(real.size() == imaginary.size());
-	assert(Signal::Fourier::IsPowerOfTwo(real.size()));
-	assert(Signal::Fourier::IsPowerOfTwo(imaginary.size()));
-
-	std::for_each(imaginary.begin(), imaginary.end(), [](double& value) { value *= -1; });
-
-	ScientistsAndEngineersFFT(real, imaginary);
-
-	assert(real.size() == imaginary.size());
-
-	double N{static_cast<double>(real.size())};
-	std::for_each(real.begin(), real.end(), [=](double& value) { value = value / N; });
-	std::for_each(imaginary.begin(), imaginary.end(), [=](double& value) { value = value / N; });
+	return Signal::Fourier::ApplyFFT(timeDomainSignal.View());
 }
 
-Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const AudioData& timeDomainSignal)
+template<typename T>
+Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal)
 {
-	std::vector<double> real;
-	std::vector<double> imaginary;
-
-	for(auto sample : timeDomainSignal.GetData())
-	{
-		real.push_back(sample);
-	}
-
-	imaginary.resize(real.size(), 0.0);
-
-	ScientistsAndEngineersFFT(real, imaginary);
-
 	Signal::FrequencyDomain frequencyDomain;
-	for(auto index{0}; index <= (real.size() / 2); ++index) 
-	{
-		frequencyDomain.PushFrequencyBin(Signal::FrequencyBin{real[index], imaginary[index]});
-	}
-
+	Signal::Fourier::ApplyFFT(timeDomainSignal, frequencyDomain);
 	return frequencyDomain;
 }
 
-AudioData Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData)
+template<typename T>
+void Signal::Fourier::ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal, Signal::FrequencyDomain& frequencyDomain)
 {
-	std::vector<double> real;
-	std::vector<double> imaginary;
+	std::size_t binCount{timeDomainSignal.GetSize() / 2 + 1};
+	auto& scratch{GetScratch()};
+	double* real{Grow(scratch.real_, binCount)};
+	double* imaginary{Grow(scratch.imaginary_, binCount)};
 
-	// See the middle of page 227 of "The Scientist and Engineer's Guide to Digital Signal Processing" for what we're doing from here...
+	Signal::Fourier::ApplyFFT(timeDomainSignal, real, imaginary);
+	frequencyDomain.Assign(real, imaginary, binCount);
+}
 
-	auto frequencyBinData{frequencyDomainData.GetRectangularFrequencyData()};
+template<typename T>
+void Signal::Fourier::ApplyFFT(const BasicAudioDataView<T>& timeDomainSignal, double* real, double* imaginary)
+{
+	std::size_t N{timeDomainSignal.GetSize()};
+	const auto& plan{GetPlan(N)};
+	plan.ForwardReal(GetDoubleSamples(timeDomainSignal, GetScratch().input_), real, imaginary);
+}
 
-	for(auto frequencyBin : frequencyBinData)
-	{
-		real.push_back(frequencyBin.reX_);
-		imaginary.push_back(frequencyBin.imX_);
-	}
+template<typename T>
+BasicAudioData<T> Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData)
+{
+	BasicAudioData<T> audioData;
+	audioData.AddSilence((frequencyDomainData.GetSize() - 1) * 2);
+	Signal::Fourier::ApplyInverseFFT(frequencyDomainData, audioData.GetDataPointerWriteAccess());
+	return audioData;	
+}
 
-	for(std::size_t i = frequencyBinData.size() - 2; i > 0; --i)
+template<typename T>
+void Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain& frequencyDomainData, T* samples)
+{
+	std::size_t binCount{frequencyDomainData.GetSize()};
+	auto& scratch{GetScratch()};
+	double* real{Grow(scratch.real_, binCount)};
+	double* imaginary{Grow(scratch.imaginary_, binCount)};
+	for(std::size_t index{0}; index < binCount; ++index)
 	{
-		real.push_back(frequencyBinData[i].reX_);
-		imaginary.push_back(-1.0 * frequencyBinData[i].imX_);  // Note the -1 multiplication
+		const auto& frequencyBin{frequencyDomainData.GetBin(index)};
+		real[index] = frequencyBin.reX_;
+		imaginary[index] = frequencyBin.imX_;
 	}
 
-	// ...to here.
-
-	ScientistsAndEngineersInverseFFT(real, imaginary);
-
-	AudioData audioData;
-	for(std::size_t index{0}; index < real.size(); ++index) 
-	{
-		audioData.PushSample(real[index]);	
-	}
+	Signal::Fourier::ApplyInverseFFT(real, imaginary, binCount, samples);
+}
 
-	return audioData;	
+// Only the N/2+1 bins of the non-negative frequencies are needed, the negative frequencies of a real signal 
+// mirror them.  See the middle of page 227 of "The Scientist and Engineer's Guide to Digital Signal Processing" 
+// for the relationship.
+template<typename T>
+void Signal::Fourier::ApplyInverseFFT(const double* real, const double* imaginary, std::size_t bins, T* samples)
+{
+	std::size_t N{(bins - 1) * 2};
+	const auto& plan{GetPlan(N)};
+	WriteSamples(N, samples, [&](double* output) { plan.InverseReal(real, imaginary, output); });
 }
+
+template Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioData<double>&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioDataView<double>&);
+template BasicAudioData<double> Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioData<double>&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioDataView<double>&);
+template BasicAudioData<double> Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain&);
+template void Signal::Fourier::ApplyFFT(const BasicAudioDataView<double>&, Signal::FrequencyDomain&);
+template void Signal::Fourier::ApplyFFT(const BasicAudioDataView<double>&, double*, double*);
+template void Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain&, double*);
+template void Signal::Fourier::ApplyInverseFFT(const double*, const double*, std::size_t, double*);
+
+template Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioData<float>&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyDFT(const BasicAudioDataView<float>&);
+template BasicAudioData<float> Signal::Fourier::ApplyInverseDFT(const Signal::FrequencyDomain&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioData<float>&);
+template Signal::FrequencyDomain Signal::Fourier::ApplyFFT(const BasicAudioDataView<float>&);
+template BasicAudioData<float> Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain&);
+template void Signal::Fourier::ApplyFFT(const BasicAudioDataView<float>&, Signal::FrequencyDomain&);
+template void Signal::Fourier::ApplyFFT(const BasicAudioDataView<float>&, double*, double*);
+template void Signal::Fourier::ApplyInverseFFT(const Signal::FrequencyDomain&, float*);
+template void Signal::Fourier::ApplyInverseFFT(const double*, const double*, std::size_t, float*);
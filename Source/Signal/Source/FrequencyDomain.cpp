@@ -31,14 +31,43 @@
 #include <iostream>
 #include <algorithm>
 #include <cassert>
+#include <utility>
 
 Signal::FrequencyDomain::FrequencyDomain() { }
 
-Signal::FrequencyDomain::FrequencyDomain(std::vector<FrequencyBin> FrequencyBin) : data_{FrequencyBin} { }
+Signal::FrequencyDomain::FrequencyDomain(std::vector<FrequencyBin> FrequencyBin) : data_{std::move(FrequencyBin)} { }
 
 void Signal::FrequencyDomain::PushFrequencyBin(FrequencyBin FrequencyBin)
 {
 	data_.push_back(FrequencyBin);
+	ClearCachedData();
+}
+
+void Signal::FrequencyDomain::Assign(const double* real, const double* imaginary, std::size_t bins)
+{
+	data_.resize(bins);
+	for(std::size_t bin{0}; bin < bins; ++bin)
+	{
+		data_[bin].reX_ = real[bin];
+		data_[bin].imX_ = imaginary[bin];
+	}
+
+	ClearCachedData();
+}
+
+void Signal::FrequencyDomain::Clear()
+{
+	data_.clear();
+	ClearCachedData();
+}
+
+// The cached vectors are cleared rather than released so recalculating them reuses their storage
+void Signal::FrequencyDomain::ClearCachedData()
+{
+	magnitudes_.clear();
+	wrappedPhases_.clear();
+	realComponent_.clear();
+	imaginaryComponent_.clear();
 }
 
 std::size_t Signal::FrequencyDomain::GetSize() const
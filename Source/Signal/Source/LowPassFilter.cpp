@@ -25,81 +25,131 @@
  */
 
 #include <Signal/LowPassFilter.h>
+#include <Signal/FftPlan.h>
+#include <Signal/Source/FirKernels.h>
+#include <Signal/Source/FilterKernelCache.h>
 #include <Utilities/Exception.h>
-#define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
-#include <math.h>
 #include <algorithm>
-#include <numeric>
 #include <iostream>
 
-Signal::LowPassFilter::LowPassFilter(double cutoffRatio, std::size_t filterLength) : 
-	cutoffRatio_{cutoffRatio},
-	filterLength_{filterLength}
+namespace
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	template<typename T>
+	T ClipSample(T sample)
+	{
+		return std::min(std::max(sample, T{-1}), T{1});
+	}
+
+	std::size_t NextPowerOfTwo(std::size_t number)
+	{
+		std::size_t powerOfTwo{1};
+		while(powerOfTwo < number)
+		{
+			powerOfTwo *= 2;
+		}
+
+		return powerOfTwo;
+	}
+}
 
+template<typename T>
+const std::size_t Signal::BasicLowPassFilter<T>::FFT_CONVOLUTION_MINIMUM_LENGTH;
+
+template<typename T>
+Signal::BasicLowPassFilter<T>::BasicLowPassFilter(double cutoffRatio, std::size_t filterLength, Utilities::Synchronization synchronization,
+												  ConvolutionMethod convolutionMethod) : 
+	cutoffRatio_{cutoffRatio},
+	filterLength_{filterLength},
+	convolutionMethod_{convolutionMethod},
+	outputQueue_{synchronization},
+	synchronization_{synchronization}
+{
 	if(cutoffRatio_ < minCutoffRatioRange_ || cutoffRatio_ > maxCutoffRatioRange_)
 	{
 		Utilities::ThrowException("LowPassFilter cutoffRatio is out of range");
 	}
+
+	if(convolutionMethod_ == ConvolutionMethod::AUTOMATIC)
+	{
+		convolutionMethod_ = (filterLength_ >= FFT_CONVOLUTION_MINIMUM_LENGTH) ? ConvolutionMethod::FFT : ConvolutionMethod::DIRECT;
+	}
 	
 	CalculateFilterKernel();
 }
 
-void Signal::LowPassFilter::Reset()
+template<typename T>
+void Signal::BasicLowPassFilter<T>::Reset()
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	audioInput_.Clear();
 	audioOutput_.Clear();
+	outputQueue_.Clear();
 }
 
-void Signal::LowPassFilter::SubmitAudioData(const AudioData& audioData)
+template<typename T>
+void Signal::BasicLowPassFilter<T>::SubmitAudioData(const BasicAudioData<T>& audioData)
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	audioInput_.Append(audioData);
 	Process();	
 }
 
-AudioData Signal::LowPassFilter::GetAudioData(uint64_t samples)
+template<typename T>
+BasicAudioData<T> Signal::BasicLowPassFilter<T>::GetAudioData(uint64_t samples)
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	return outputQueue_.Pop(samples);
+}
 
-	uint64_t samplesToRetrieve{samples};
-	if(audioOutput_.GetSize() < samplesToRetrieve)
-	{
-		samplesToRetrieve = audioOutput_.GetSize();
-	}
+template<typename T>
+std::size_t Signal::BasicLowPassFilter<T>::OutputSamplesAvailable()
+{
+	return outputQueue_.GetSize();
+}
 
-	return audioOutput_.RetrieveRemove(samplesToRetrieve);
+template<typename T>
+std::size_t Signal::BasicLowPassFilter<T>::MinimumSamplesNeededForProcessing()
+{
+	return filterLength_;	
 }
 
-std::size_t Signal::LowPassFilter::OutputSamplesAvailable()
+template<typename T>
+const std::vector<T>& Signal::BasicLowPassFilter<T>::GetFilterKernel() const
 {
-	std::lock_guard<std::mutex> guard(mutex_);
-	return audioOutput_.GetSize();
+	return *filterKernel_;
 }
 
-std::size_t Signal::LowPassFilter::MinimumSamplesNeededForProcessing()
+template<typename T>
+typename Signal::BasicLowPassFilter<T>::ConvolutionMethod Signal::BasicLowPassFilter<T>::GetConvolutionMethod() const
 {
-	return filterLength_;	
+	return convolutionMethod_;
 }
 
-AudioData Signal::LowPassFilter::FlushAudioData()
+template<typename T>
+BasicAudioData<T> Signal::BasicLowPassFilter<T>::FlushAudioData()
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	audioInput_.AddSilence(filterLength_);
 	Process();
 
-	AudioData audioData{audioOutput_};
-	audioOutput_.Clear();
+	return outputQueue_.PopAll();
+}
+
+template<typename T>
+std::unique_lock<std::mutex> Signal::BasicLowPassFilter<T>::LockProcessing()
+{
+	if(synchronization_ == Utilities::Synchronization::SINGLE_THREADED)
+	{
+		return std::unique_lock<std::mutex>{};
+	}
 
-	return audioData;
+	return std::unique_lock<std::mutex>{mutex_};
 }
 
-void Signal::LowPassFilter::Process()
+template<typename T>
+void Signal::BasicLowPassFilter<T>::Process()
 {
 	if(audioInput_.GetSize() < filterLength_)
 	{
@@ -107,58 +157,94 @@ void Signal::LowPassFilter::Process()
 	}
 
 	std::size_t samplesToProcess{audioInput_.GetSize() - filterLength_};
-	auto inputBuffer{audioInput_.GetData()};
+	const T* inputBuffer{audioInput_.GetDataPointer()};
 
-	// Convolve the input signal and filter kernel
-	for(uint64_t i = 0; i < samplesToProcess; ++i)
+	if(convolutionMethod_ == ConvolutionMethod::FFT)
 	{
-		double accumulator{0};
-		for(uint64_t j = 0; j < filterLength_; j++)
-		{
-			accumulator = accumulator + (inputBuffer[i + j] * filterKernel_[j]);
-		}
-
-		if(accumulator > 1.0)
-		{
-			audioOutput_.PushSample(1.0);
-		}
-		else if(accumulator < -1.0)
-		{
-			audioOutput_.PushSample(-1.0);
-		}
-		else
-		{
-			audioOutput_.PushSample(accumulator);
-		}
+		ConvolveFft(inputBuffer, samplesToProcess);
+	}
+	else
+	{
+		ConvolveDirect(inputBuffer, samplesToProcess);
 	}
 
 	// Remove the samples we just processed
 	audioInput_.RemoveFrontSamples(samplesToProcess);
+
+	// And publish the output
+	outputQueue_.Push(audioOutput_);
+	audioOutput_.Clear();
 }
 
-void Signal::LowPassFilter::CalculateFilterKernel()
+template<typename T>
+void Signal::BasicLowPassFilter<T>::ConvolveDirect(const T* input, std::size_t samples)
 {
-	// This is straight out of "The Scientist and Engineer's Guide to Digital Signal Processing" chapter 16 table 16-1
+	// Convolve the input signal and filter kernel
+	std::size_t outputPosition{audioOutput_.GetSize()};
+	audioOutput_.AddSilence(samples);
+	FirKernels::Filter(input, filterKernel_->data(), filterLength_, audioOutput_.GetDataPointerWriteAccess() + outputPosition, samples);
+}
 
-	std::size_t halfFilterLength{filterLength_ / 2};
-	double twoPI{2.0 * M_PI};
-	for(std::size_t i = 0; i < filterLength_; ++i) {
+// Overlap-save: the circular convolution of a block with the kernel is only wrong for the first 
+// filterLength - 1 samples, where it wraps around, so each block after that gives blockOutputSize_ 
+// correct samples.  A short last block is zero padded; the padding only reaches the outputs thrown away.
+template<typename T>
+void Signal::BasicLowPassFilter<T>::ConvolveFft(const T* input, std::size_t samples)
+{
+	const std::vector<double>& kernelReal{kernelSpectrum_->real};
+	const std::vector<double>& kernelImaginary{kernelSpectrum_->imaginary};
+	std::size_t bins{kernelReal.size()};
+	for(std::size_t start{0}; start < samples; start += blockOutputSize_)
+	{
+		std::size_t outputSamples{std::min(blockOutputSize_, samples - start)};
+		std::size_t inputSamples{outputSamples + filterLength_ - 1};
+		std::copy(input + start, input + start + inputSamples, block_.begin());
+		std::fill(block_.begin() + inputSamples, block_.end(), 0.0);
 
-		if((i - halfFilterLength) / 2 == 0)
+		fftPlan_->ForwardReal(block_.data(), blockReal_.data(), blockImaginary_.data());
+		for(std::size_t bin{0}; bin < bins; ++bin)
 		{
-			filterKernel_.push_back(twoPI * cutoffRatio_);
+			double real{blockReal_[bin] * kernelReal[bin] - blockImaginary_[bin] * kernelImaginary[bin]};
+			blockImaginary_[bin] = blockReal_[bin] * kernelImaginary[bin] + blockImaginary_[bin] * kernelReal[bin];
+			blockReal_[bin] = real;
 		}
-		else
+
+		fftPlan_->InverseReal(blockReal_.data(), blockImaginary_.data(), block_.data());
+
+		for(std::size_t i{0}; i < outputSamples; ++i)
 		{
-			double position{static_cast<double>(i) - halfFilterLength};
-			filterKernel_.push_back(sin(twoPI * cutoffRatio_ * position) / position);
+			audioOutput_.PushSample(ClipSample(static_cast<T>(block_[filterLength_ - 1 + i])));
 		}
-			
-		// Apply windowing
-		filterKernel_[i] = filterKernel_[i] * (0.54 - 0.46 * cos(2 * M_PI * (float)i / filterLength_));
 	}
-	
-	// Normalize the low-pass filter kernal for unity gain at DC
-	double filterKernelSum{std::accumulate(filterKernel_.begin(), filterKernel_.end(), 0.0)};
-	std::for_each(filterKernel_.begin(), filterKernel_.end(), [&](double& currentIndexValue) { currentIndexValue /= filterKernelSum; });
 }
+
+template<typename T>
+void Signal::BasicLowPassFilter<T>::PrepareFftConvolution()
+{
+	// Four times the filter length keeps at least three quarters of every block
+	fftPlan_ = Fourier::FftPlan::GetPlan(NextPowerOfTwo(filterLength_ * 4));
+	std::size_t fftSize{fftPlan_->GetSize()};
+	blockOutputSize_ = fftSize - filterLength_ + 1;
+
+	// Process() correlates the input with the kernel, which is convolution with the reversed kernel
+	kernelSpectrum_ = GetLowPassFilterSpectrum(cutoffRatio_, filterLength_, SincWindow::HAMMING, fftSize);
+
+	block_.resize(fftSize);
+	blockReal_.resize(fftSize / 2 + 1);
+	blockImaginary_.resize(fftSize / 2 + 1);
+}
+
+// The kernel is calculated once for each cutoff ratio and length and shared by every filter using it
+template<typename T>
+void Signal::BasicLowPassFilter<T>::CalculateFilterKernel()
+{
+	filterKernel_ = GetLowPassFilterKernel<T>(cutoffRatio_, filterLength_, SincWindow::HAMMING);
+
+	if(convolutionMethod_ == ConvolutionMethod::FFT)
+	{
+		PrepareFftConvolution();
+	}
+}
+
+template class Signal::BasicLowPassFilter<double>;
+template class Signal::BasicLowPassFilter<float>;
@@ -0,0 +1,845 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/MultichannelResampler.h>
+#include <Utilities/Stringify.h>
+#include <Utilities/Exception.h>
+#include <Signal/Source/WindowedSincValues.h>
+#include <Signal/Source/FirKernels.h>
+#include <Signal/Source/FilterKernelCache.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+	std::size_t GreatestCommonDivisor(std::size_t a, std::size_t b)
+	{
+		while(b != 0)
+		{
+			std::size_t remainder{a % b};
+			a = b;
+			b = remainder;
+		}
+
+		return a;
+	}
+
+	struct QualitySettings
+	{
+		std::size_t samplesPerSide;
+		std::size_t sincSamplesPerXInteger;
+		std::size_t lowPassFilterLength;
+		Signal::SincWindow lowPassFilterWindow;
+	};
+
+	QualitySettings GetQualitySettings(Signal::ResamplerQuality quality)
+	{
+		switch(quality)
+		{
+			case Signal::ResamplerQuality::LEGACY:
+				return QualitySettings{19, 224, 100, Signal::SincWindow::HAMMING};
+			case Signal::ResamplerQuality::DRAFT:
+				return QualitySettings{8, 64, 32, Signal::SincWindow::BLACKMAN};
+			case Signal::ResamplerQuality::NORMAL:
+				return QualitySettings{19, 224, 100, Signal::SincWindow::BLACKMAN};
+			case Signal::ResamplerQuality::HIGH:
+				return QualitySettings{32, 512, 256, Signal::SincWindow::BLACKMAN};
+			case Signal::ResamplerQuality::MASTERING:
+				return QualitySettings{48, 1024, 512, Signal::SincWindow::BLACKMAN};
+		}
+
+		Utilities::ThrowException("Invalid resampler quality");
+		return QualitySettings{};
+	}
+
+	// Appends the viewed samples to the end of the history buffer
+	template<typename T>
+	void AppendToHistory(std::vector<T>& history, const BasicAudioDataView<T>& audioData)
+	{
+		if(audioData.IsContiguous())
+		{
+			history.insert(history.end(), audioData.GetDataPointer(), audioData.GetDataPointer() + audioData.GetSize());
+			return;
+		}
+
+		std::size_t previousSize{history.size()};
+		history.resize(previousSize + audioData.GetSize());
+		for(std::size_t i{0}; i < audioData.GetSize(); ++i)
+		{
+			history[previousSize + i] = audioData[i];
+		}
+	}
+
+	// The sinc filter reaches a little past samplesPerSide zero crossings as its position moves between input 
+	// samples, so the tables cover a few more.  Legacy and normal quality's table is the one GetSincValue() uses.
+	std::shared_ptr<const Signal::WindowedSincTable> GetSincTable(Signal::ResamplerQuality quality)
+	{
+		const std::size_t extraZeroCrossings{3};
+		QualitySettings settings{GetQualitySettings(quality)};
+		return Signal::WindowedSincTable::GetTable(settings.sincSamplesPerXInteger, settings.samplesPerSide + extraZeroCrossings);
+	}
+}
+
+// To understand how this works in detail please see the document ResamplingUsingWindowedSincFilter.odg in Sabbatical Notes
+
+template<typename T>
+Signal::BasicMultichannelResampler<T>::BasicMultichannelResampler(std::size_t inputSampleRate, double resampleRatio, std::size_t channels, 
+																   Utilities::Synchronization synchronization, ResamplerQuality quality) :
+	inputSampleRate_{inputSampleRate}, 
+	resampleRatio_{resampleRatio},
+	channels_{channels},
+	inputData_(channels),
+	outputData_(channels),
+	synchronization_{synchronization},
+	quality_{quality},
+	sincTable_{GetSincTable(quality)},
+	sincSamplesPerXInteger_{sincTable_->GetSamplesPerXInteger()},
+	samplesPerSide_{GetQualitySettings(quality).samplesPerSide},
+	lowPassFilterLength_{GetQualitySettings(quality).lowPassFilterLength},
+	passingThrough_{resampleRatio == 1.0},
+	lowPassFiltering_{resampleRatio < 1.0},
+	sincPositions_(minimumSamplesNeededForProcessing_),
+	sincCoefficients_(minimumSamplesNeededForProcessing_),
+	unfilteredInputData_(channels),
+	inputBuffers_(channels)
+{
+	if(channels_ == 0)
+	{
+		Utilities::ThrowException("The resampler needs at least one channel");
+	}
+
+	ValidateSampleRates();
+	CalculateLowPassFilterKernel();	
+	CalculateXSincCenterAdjustmentPerInputSample();
+	CalculatePolyphaseBanks();
+
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		outputQueues_.emplace_back(new BasicAudioDataQueue<T>{synchronization});
+	}
+
+	RestartInput();
+}
+
+template<typename T>
+Signal::BasicMultichannelResampler<T>::~BasicMultichannelResampler()
+{
+
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::Reset()
+{
+	auto guard{LockProcessing()};
+
+	// A ramp in progress is finished
+	if(rampOutputSamplesRemaining_ > 0)
+	{
+		xSincCenterAdjustmentPerInputSample_ = targetXSincCenterAdjustment_;
+		rampOutputSamplesRemaining_ = 0;
+		CompleteResampleRatioChange();
+	}
+
+	for(auto& outputQueue : outputQueues_)
+	{
+		outputQueue->Clear();
+	}
+
+	RestartInput();
+}
+
+// The input buffers start with samplesPerSide_ samples of silence.  See the document ResamplingUsingWindowedSincFilter.odg 
+// in SabbaticalNotes for why we do this.  The silence before that is the history the rest of the resampler keeps, which 
+// is only read if the ratio changes.  Both buffers hold it, so it's already "filtered".
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::RestartInput()
+{
+	currentXSincPosition_ = 0.0;
+	inputSampleIndex_ = GetHistorySize();
+	filteredInputSize_ = inputSampleIndex_;
+
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		inputData_[channel].assign(inputSampleIndex_, T{0});
+		unfilteredInputData_[channel].assign(inputSampleIndex_, T{0});
+	}
+
+	// Banks for a position left between phases by a ratio change no longer fit
+	if(polyphasePhases_ > 0 && polyphaseOffset_ != 0.0)
+	{
+		CalculatePolyphaseBanks();
+	}
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::SubmitAudioData(const std::vector<BasicAudioData<T>>& audioData)
+{
+	std::vector<BasicAudioDataView<T>> views;
+	for(const auto& channel : audioData)
+	{
+		views.push_back(channel.View());
+	}
+
+	SubmitAudioData(views);
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::SubmitAudioData(const std::vector<BasicAudioDataView<T>>& audioData)
+{
+	ValidateChannels(audioData);
+
+	auto guard{LockProcessing()};
+
+	if(passingThrough_)  // Check for edge case
+	{
+		HandleNoSampleRateChange(audioData);
+		return;
+	}
+
+	Process(audioData);
+}
+
+// Channels are published one after another, so only the samples every queue has been given are returned
+template<typename T>
+std::vector<BasicAudioData<T>> Signal::BasicMultichannelResampler<T>::GetAudioData(uint64_t samples)
+{
+	uint64_t samplesToReturn{std::min(samples, static_cast<uint64_t>(OutputSamplesAvailable()))};
+
+	std::vector<BasicAudioData<T>> audioData;
+	for(auto& outputQueue : outputQueues_)
+	{
+		audioData.push_back(outputQueue->Pop(samplesToReturn));
+	}
+
+	return audioData;
+}
+
+template<typename T>
+std::size_t Signal::BasicMultichannelResampler<T>::OutputSamplesAvailable()
+{
+	std::size_t samplesAvailable{outputQueues_[0]->GetSize()};
+	for(std::size_t channel{1}; channel < channels_; ++channel)
+	{
+		samplesAvailable = std::min(samplesAvailable, outputQueues_[channel]->GetSize());
+	}
+
+	return samplesAvailable;
+}
+
+template<typename T>
+std::vector<BasicAudioData<T>> Signal::BasicMultichannelResampler<T>::FlushAudioData()
+{
+	auto guard{LockProcessing()};
+
+	// First get any output audio data remaining in the output queues
+	std::vector<BasicAudioData<T>> audioDataToReturn;
+	for(auto& outputQueue : outputQueues_)
+	{
+		audioDataToReturn.push_back(outputQueue->PopAll());
+	}
+
+	// Then process any input samples that might remain
+	if(inputData_[0].size() > 0)
+	{
+		// Process whatever samples remain by adding silence to the right side.  See the document ResamplingUsingWindowedSincFilter.odg 
+		// in SabbaticalNotes for details.  Also, it might help to look at it like we're adding "right side" samples of silence so 
+		// we can flush the given input.
+		// A low pass filter centered on each sample needs the silence to reach past the end of its kernel too
+		BasicAudioData<T> silence;
+		silence.AddSilence(samplesPerSide_ + 1 + ((lowPassFilterOffset_ > 0) ? lowPassFilterLength_ - lowPassFilterOffset_ : 0));
+		Process(std::vector<BasicAudioDataView<T>>(channels_, silence.View()));
+
+		for(std::size_t channel{0}; channel < channels_; ++channel)
+		{
+			audioDataToReturn[channel].Append(outputQueues_[channel]->PopAll());
+		}
+
+		// Any input submitted next starts from silence, as it does after Reset()
+		RestartInput();
+	}
+
+	return audioDataToReturn;
+}
+
+template<typename T>
+std::size_t Signal::BasicMultichannelResampler<T>::GetChannels() const
+{
+	return channels_;
+}
+
+template<typename T>
+Signal::ResamplerQuality Signal::BasicMultichannelResampler<T>::GetQuality() const
+{
+	return quality_;
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::SetResampleRatio(double resampleRatio, std::size_t rampOutputSamples)
+{
+	ValidateResampleRatio(resampleRatio);
+
+	auto guard{LockProcessing()};
+
+	if(resampleRatio == resampleRatio_ && rampOutputSamplesRemaining_ == 0)
+	{
+		return;
+	}
+
+	// Processing starts with the sinc filter centered on the next input sample.  The input buffers hold the history 
+	// the sinc filter and a low pass filter reach back into, see HandleNoSampleRateChange().
+	if(passingThrough_)
+	{
+		passingThrough_ = false;
+		inputSampleIndex_ = inputData_[0].size();
+		filteredInputSize_ = inputSampleIndex_;
+	}
+
+	// The polyphase banks only hold the positions the sinc filter takes at one ratio
+	polyphasePhases_ = 0;
+	polyphaseBanks_.reset();
+
+	double currentResampleRatio{sincSamplesPerXInteger_ / (sincSamplesPerXInteger_ - xSincCenterAdjustmentPerInputSample_)};
+	resampleRatio_ = resampleRatio;
+	targetXSincCenterAdjustment_ = sincSamplesPerXInteger_ - (sincSamplesPerXInteger_ / resampleRatio_);
+	rampOutputSamplesRemaining_ = rampOutputSamples;
+	if(rampOutputSamplesRemaining_ == 0)
+	{
+		// A change of direction moves the position into the range for the new direction before any bank is looked up
+		xSincCenterAdjustmentPerInputSample_ = targetXSincCenterAdjustment_;
+		CheckForSincPositionWrapping();
+		CompleteResampleRatioChange();
+	}
+	else
+	{
+		xSincCenterAdjustmentStep_ = (targetXSincCenterAdjustment_ - xSincCenterAdjustmentPerInputSample_) / static_cast<double>(rampOutputSamples);
+
+		// Until the ramp finishes the low pass filter is for the lowest ratio it passes through
+		double lowestResampleRatio{std::min(currentResampleRatio, resampleRatio_)};
+		if(lowPassFiltering_ || lowestResampleRatio < 1.0)
+		{
+			UpdateLowPassFilter(lowestResampleRatio);
+		}
+	}
+}
+
+// Once the ratio has settled the low pass filter is for that ratio, and the polyphase banks are used again if they 
+// can represent it.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::CompleteResampleRatioChange()
+{
+	if(lowPassFiltering_ || resampleRatio_ < 1.0)
+	{
+		UpdateLowPassFilter(resampleRatio_);
+	}
+
+	CalculatePolyphaseBanks();
+}
+
+// Low pass filters for the given ratio.  A filter for a ratio of 1.0 or more passes everything: a blackman windowed sinc 
+// with a cutoff at the Nyquist frequency is a single center tap.  A resampler instantiated without a low pass filter 
+// starts one here, always blackman windowed since the legacy kernel's center is half a sample off its center tap.  
+// For the same reason a resampler instantiated to downsample at legacy quality moves its output half an input sample 
+// when the ratio crosses 1.0.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::UpdateLowPassFilter(double resampleRatio)
+{
+	if(!lowPassFiltering_)
+	{
+		StartLowPassFiltering();
+	}
+
+	if(resampleRatio < 1.0)
+	{
+		SincWindow window{(lowPassFilterOffset_ > 0) ? SincWindow::BLACKMAN : GetQualitySettings(quality_).lowPassFilterWindow};
+		lowPassFilterKernel_ = GetLowPassFilterKernel<T>(resampleRatio * 0.5, lowPassFilterLength_, window);
+	}
+	else
+	{
+		lowPassFilterKernel_ = GetLowPassFilterKernel<T>(0.5, lowPassFilterLength_, SincWindow::BLACKMAN);
+	}
+}
+
+// The input so far is unfiltered, so the low pass filter is centered on each sample to keep the input where it is.  The 
+// input from the start of the sinc filter on is filtered again, reaching back into the history kept for this.  The last 
+// samples can't be filtered until the input after them arrives, so the filtered input is shorter than the input so far 
+// and the input past its end waits to be filtered again.  The position can still wrap back one input sample.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::StartLowPassFiltering()
+{
+	lowPassFiltering_ = true;
+	lowPassFilterOffset_ = GetLowPassFilterReach();
+
+	std::size_t latency{lowPassFilterLength_ - lowPassFilterOffset_};
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		unfilteredInputData_[channel] = inputData_[channel];
+		inputData_[channel].resize(unfilteredInputData_[channel].size() - latency);
+	}
+
+	filteredInputSize_ = std::max(inputSampleIndex_ - samplesPerSide_ - 1, lowPassFilterOffset_);
+}
+
+// The low pass filter reaches back this far from the sample it's centered on
+template<typename T>
+std::size_t Signal::BasicMultichannelResampler<T>::GetLowPassFilterReach() const
+{
+	return lowPassFilterLength_ / 2;
+}
+
+// The input samples kept before the one the sinc filter is centered on.  One more than the sinc filter needs is kept, as 
+// when the ratio changes from downsampling to upsampling the position can wrap back an input sample before it wraps 
+// forward again.  So are the samples a low pass filter centered on the first of them reaches back to, for when the ratio 
+// changes to downsampling.
+template<typename T>
+std::size_t Signal::BasicMultichannelResampler<T>::GetHistorySize() const
+{
+	return samplesPerSide_ + 1 + GetLowPassFilterReach();
+}
+
+template<typename T>
+double Signal::BasicMultichannelResampler<T>::GetResampleRatio()
+{
+	auto guard{LockProcessing()};
+
+	if(rampOutputSamplesRemaining_ == 0)
+	{
+		return resampleRatio_;
+	}
+
+	return sincSamplesPerXInteger_ / (sincSamplesPerXInteger_ - xSincCenterAdjustmentPerInputSample_);
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::ValidateChannels(const std::vector<BasicAudioDataView<T>>& audioData) const
+{
+	if(audioData.size() != channels_)
+	{
+		Utilities::ThrowException(Utilities::CreateString(" ", "Audio data submitted for", audioData.size(), "channels to a resampler with", channels_));
+	}
+
+	for(const auto& channel : audioData)
+	{
+		if(channel.GetSize() != audioData[0].GetSize())
+		{
+			Utilities::ThrowException("Audio data submitted for each channel must be the same size");
+		}
+	}
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::ValidateSampleRates()
+{
+	if(inputSampleRate_ < minimumSampleRate_ || inputSampleRate_ > maximumSampleRate_)
+	{
+		Utilities::ThrowException(Utilities::CreateString(" ", "Input sample rate of ", inputSampleRate_, 
+																" out of range.  Min:", minimumSampleRate_, "Max:", maximumSampleRate_));
+	}
+
+	ValidateResampleRatio(resampleRatio_);
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::ValidateResampleRatio(double resampleRatio)
+{
+	double outputSampleRate{static_cast<double>(inputSampleRate_) * resampleRatio};
+
+	if(outputSampleRate < minimumSampleRate_ || outputSampleRate > maximumSampleRate_)
+	{
+		Utilities::ThrowException(Utilities::CreateString(" ", "Resample ratio results in an output sample rate of ", outputSampleRate, 
+																" this is out of range.  Sample rate min:", minimumSampleRate_, "Max:", maximumSampleRate_));
+	}
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::CalculateLowPassFilterKernel()
+{
+	if(!lowPassFiltering_)
+	{
+		// No need for low pass filter if output sample rate is >= input sample rate
+		return;
+	}
+
+	// The multiplication of 0.5 might at first seem confusing here.  Recall Nyquist. The max frequency in the signal can be one 
+	// half of the sample rate of the audio.  The output from the resampler cannot contain audio less than half of the new sample 
+	// rate.
+	// The LowPassFilter kernel puts the center value on two taps, which limits its stopband attenuation to about 16dB 
+	// however long it is.  Legacy quality keeps it so its output doesn't change, the other levels use a blackman 
+	// windowed kernel with a single center tap.
+	double lowPassRatio{resampleRatio_ * 0.5};
+	QualitySettings settings{GetQualitySettings(quality_)};
+	lowPassFilterKernel_ = GetLowPassFilterKernel<T>(lowPassRatio, lowPassFilterLength_, settings.lowPassFilterWindow);
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::CalculateXSincCenterAdjustmentPerInputSample()
+{
+	xSincCenterAdjustmentPerInputSample_ = sincSamplesPerXInteger_ - (sincSamplesPerXInteger_ / resampleRatio_);
+}
+
+// The position of the sinc filter repeats every polyphasePhases_ output samples when the ratio is a fraction with 
+// that numerator, so it only ever takes multiples of sincSamplesPerXInteger_ / polyphasePhases_ from where it started.  
+// Since our sample rates are whole numbers, the fraction is found from the output sample rate.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::CalculatePolyphaseBanks()
+{
+	if(resampleRatio_ == 1.0)
+	{
+		return;
+	}
+
+	double outputSampleRate{std::round(static_cast<double>(inputSampleRate_) * resampleRatio_)};
+	std::size_t divisor{GreatestCommonDivisor(static_cast<std::size_t>(outputSampleRate), inputSampleRate_)};
+	std::size_t numerator{static_cast<std::size_t>(outputSampleRate) / divisor};
+	std::size_t denominator{inputSampleRate_ / divisor};
+
+	if(numerator > maximumPolyphasePhases_ || static_cast<double>(numerator) / static_cast<double>(denominator) != resampleRatio_)
+	{
+		return;
+	}
+
+	// A ratio ramp can leave the sinc filter anywhere between phases, where it stays at the new ratio.  Within rounding 
+	// errors of a phase it's put on the phase, so resamplers with the same numerator, direction and quality share the banks.
+	double phaseWidth{sincSamplesPerXInteger_ / static_cast<double>(numerator)};
+	double phase{currentXSincPosition_ / phaseWidth};
+	polyphaseOffset_ = (phase - std::floor(phase)) * phaseWidth;
+	if(std::abs(phase - std::round(phase)) < 1e-6)
+	{
+		currentXSincPosition_ = std::round(phase) * phaseWidth;
+		polyphaseOffset_ = 0.0;
+	}
+
+	polyphasePhases_ = numerator;
+	polyphaseBanks_ = GetPolyphaseBanks(*sincTable_, polyphasePhases_, resampleRatio_ < 1.0, samplesPerSide_, polyphaseOffset_);
+}
+
+// This helps handle the simple case where there is no change between the input sample rate and the output 
+// sample rate.  In this case we simply copy the input to the output buffers.  The input buffers keep as many of 
+// the last input samples as they start with, which with the sinc filter centered on the next input sample is the 
+// state processing starts from if the ratio is changed.  They never hold fewer, as flushing restarts them.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::HandleNoSampleRateChange(const std::vector<BasicAudioDataView<T>>& audioData)
+{
+	std::size_t samples{audioData[0].GetSize()};
+	std::size_t historySize{GetHistorySize()};
+	std::size_t historySamples{std::min(samples, historySize)};
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		outputQueues_[channel]->Push(audioData[channel].ToAudioData());
+
+		auto& inputData{inputData_[channel]};
+		AppendToHistory(inputData, audioData[channel].View(samples - historySamples, historySamples));
+		inputData.erase(inputData.begin(), inputData.end() - historySize);
+	}
+}
+
+// This is where the actual resampling occurs - processing input samples through the windowed sinc filter
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::Process(const std::vector<BasicAudioDataView<T>>& audioData)
+{
+	// Apply a low pass filter to the input if the output sample rate is less than the input sample rate
+	if(lowPassFiltering_)
+	{
+		AppendLowPassFilterInput(audioData);
+	}
+	else
+	{
+		for(std::size_t channel{0}; channel < channels_; ++channel)
+		{
+			AppendToHistory(inputData_[channel], audioData[channel]);
+		}
+	}
+
+	// No processing to do if we don't have the minimum requires samples for processing
+	std::size_t inputSize{inputData_[0].size()};
+	if(inputSize < minimumSamplesNeededForProcessing_)
+	{
+		return;
+	}
+
+	if(lowPassFiltering_)
+	{
+		LowPassFilterInput(filteredInputSize_, inputSize);
+	}
+
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		inputBuffers_[channel] = inputData_[channel].data();
+	}
+
+	// Each output steps the sinc filter 1/resampleRatio_ input samples, so this is enough room for all the output 
+	// give or take rounding
+	std::size_t outputSamples{0};
+	if(inputSampleIndex_ < inputSize)
+	{
+		ReserveOutputSamples(static_cast<std::size_t>(static_cast<double>(inputSize - inputSampleIndex_) * resampleRatio_) + 2);
+	}
+
+	while(inputSampleIndex_ < (inputSize - samplesPerSide_))
+	{
+		if(outputSamples == outputData_[0].size())
+		{
+			ReserveOutputSamples(2 * outputSamples + 1);
+		}
+
+		// The windowed sinc values are found once for the output frame and applied to every channel
+		if(polyphasePhases_ > 0)
+		{
+			const double* coefficients{GetPolyphaseCoefficients()};
+			for(std::size_t channel{0}; channel < channels_; ++channel)
+			{
+				outputData_[channel][outputSamples] = static_cast<T>(ApplyPolyphaseFilter(coefficients, inputBuffers_[channel]));
+			}
+		}
+		else
+		{
+			const double* coefficients{CalculateWindowedSincCoefficients()};
+			for(std::size_t channel{0}; channel < channels_; ++channel)
+			{
+				outputData_[channel][outputSamples] = static_cast<T>(ApplyWindowedSincFilter(coefficients, inputBuffers_[channel]));
+			}
+		}
+
+		++outputSamples;
+		++inputSampleIndex_;
+
+		currentXSincPosition_ += xSincCenterAdjustmentPerInputSample_;
+		if(rampOutputSamplesRemaining_ > 0)
+		{
+			StepResampleRatioRamp();
+		}
+
+		CheckForSincPositionWrapping();
+	}
+
+	DiscardInputNoLongerNeeded();
+
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		outputQueues_[channel]->Push(outputData_[channel].data(), outputSamples);
+	}
+}
+
+// Grows the output blocks to hold at least the given number of samples
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::ReserveOutputSamples(std::size_t samples)
+{
+	for(auto& outputBlock : outputData_)
+	{
+		if(outputBlock.size() < samples)
+		{
+			outputBlock.resize(samples);
+		}
+	}
+}
+
+// Finds the windowed sinc value for each input sample the filter covers.  The positions are stepped out from the 
+// center one input sample at a time, as the resampler always has, so the values don't change by a rounding error.
+template<typename T>
+const double* Signal::BasicMultichannelResampler<T>::CalculateWindowedSincCoefficients()
+{
+	double* center{sincPositions_.data() + samplesPerSide_};
+	center[0] = currentXSincPosition_;
+	double leftXSincPosition{currentXSincPosition_ - sincSamplesPerXInteger_};
+	double rightXSincPosition{currentXSincPosition_ + sincSamplesPerXInteger_};
+
+	for(std::size_t j{1}; j <= samplesPerSide_; ++j)
+	{
+		*(center - j) = leftXSincPosition;
+		*(center + j) = rightXSincPosition;
+
+		leftXSincPosition -= sincSamplesPerXInteger_;
+		rightXSincPosition += sincSamplesPerXInteger_;
+	}
+
+	sincTable_->GetValues(sincPositions_.data(), minimumSamplesNeededForProcessing_, sincCoefficients_.data());
+	return sincCoefficients_.data();
+}
+
+template<typename T>
+const double* Signal::BasicMultichannelResampler<T>::GetPolyphaseCoefficients() const
+{
+	// The position only ever drifts from a multiple of the phase spacing by rounding errors
+	std::size_t phase{static_cast<std::size_t>(std::lround((currentXSincPosition_ - polyphaseOffset_) * polyphasePhases_ / sincSamplesPerXInteger_))};
+	std::size_t bank{(resampleRatio_ < 1.0 && phase >= polyphasePhases_) ? phase - polyphasePhases_ + 1 : phase};
+	assert(bank < polyphasePhases_ + 2);
+	return polyphaseBanks_->data() + bank * minimumSamplesNeededForProcessing_;
+}
+
+template<typename T>
+double Signal::BasicMultichannelResampler<T>::ApplyWindowedSincFilter(const double* coefficients, const T* inputBuffer) const
+{
+	const double* centerCoefficient{coefficients + samplesPerSide_};
+	const T* centerInput{inputBuffer + inputSampleIndex_};
+	double outputSample = centerInput[0] * centerCoefficient[0];
+
+	for(std::size_t j{1}; j <= samplesPerSide_; ++j)
+	{
+		// Add in values for the left and right side of the sinc filter
+		outputSample += (*(centerInput - j) * *(centerCoefficient - j)) + (*(centerInput + j) * *(centerCoefficient + j));
+	}
+
+	return outputSample;
+}
+
+template<typename T>
+double Signal::BasicMultichannelResampler<T>::ApplyPolyphaseFilter(const double* coefficients, const T* inputBuffer) const
+{
+	const T* input{inputBuffer + inputSampleIndex_ - samplesPerSide_};
+
+	// Four partial sums keep the additions from waiting on each other
+	double sums[4]{0.0, 0.0, 0.0, 0.0};
+	std::size_t i{0};
+	for(; i + 4 <= minimumSamplesNeededForProcessing_; i += 4)
+	{
+		sums[0] += input[i] * coefficients[i];
+		sums[1] += input[i + 1] * coefficients[i + 1];
+		sums[2] += input[i + 2] * coefficients[i + 2];
+		sums[3] += input[i + 3] * coefficients[i + 3];
+	}
+
+	for(; i < minimumSamplesNeededForProcessing_; ++i)
+	{
+		sums[0] += input[i] * coefficients[i];
+	}
+
+	return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+// The filter outputs a sample once it has all the input samples the kernel covers, so input for the sinc 
+// filter is added kernel length samples behind the unfiltered input, less the samples the kernel reaches back 
+// when it's centered.  It's filtered later, by LowPassFilterInput().
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::AppendLowPassFilterInput(const std::vector<BasicAudioDataView<T>>& audioData)
+{
+	std::size_t latency{lowPassFilterLength_ - lowPassFilterOffset_};
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		AppendToHistory(unfilteredInputData_[channel], audioData[channel]);
+
+		if(unfilteredInputData_[channel].size() > inputData_[channel].size() + latency)
+		{
+			inputData_[channel].resize(unfilteredInputData_[channel].size() - latency);
+		}
+	}
+}
+
+// Filters inputData_ samples [begin, end) of every channel, which must all be past any already filtered
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::LowPassFilterInput(std::size_t begin, std::size_t end)
+{
+	if(begin < end)
+	{
+		for(std::size_t channel{0}; channel < channels_; ++channel)
+		{
+			Signal::FirKernels::Filter(unfilteredInputData_[channel].data() + begin - lowPassFilterOffset_, lowPassFilterKernel_->data(), lowPassFilterLength_, 
+									   inputData_[channel].data() + begin, end - begin);
+		}
+
+		filteredInputSize_ = end;
+	}
+}
+
+// The last step of the ramp lands exactly on the target rather than on the sum of the steps
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::StepResampleRatioRamp()
+{
+	--rampOutputSamplesRemaining_;
+	if(rampOutputSamplesRemaining_ == 0)
+	{
+		xSincCenterAdjustmentPerInputSample_ = targetXSincCenterAdjustment_;
+		CompleteResampleRatioChange();
+	}
+	else
+	{
+		xSincCenterAdjustmentPerInputSample_ += xSincCenterAdjustmentStep_;
+	}
+}
+
+// See the document ResamplingUsingWindowedSincFilter.odg in SabbaticalNotes for why we need this method.  The 
+// adjustment is positive exactly when upsampling, and following it rather than the ratio keeps the wrapping 
+// right part way through a ramp.  A change of direction moves the position between the two ranges, which 
+// keeps the sinc filter centered in the same place.
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::CheckForSincPositionWrapping()
+{
+	if(xSincCenterAdjustmentPerInputSample_ > 0.0)
+	{
+		while(currentXSincPosition_ >= sincSamplesPerXInteger_)
+		{
+			currentXSincPosition_ -= sincSamplesPerXInteger_;
+			--inputSampleIndex_;				
+		}
+	}
+	else
+	{
+		while(currentXSincPosition_ <= sincSamplesPerXInteger_)
+		{
+			currentXSincPosition_ += sincSamplesPerXInteger_;
+			++inputSampleIndex_;
+		}
+	}
+}
+
+template<typename T>
+std::unique_lock<std::mutex> Signal::BasicMultichannelResampler<T>::LockProcessing()
+{
+	if(synchronization_ == Utilities::Synchronization::SINGLE_THREADED)
+	{
+		return std::unique_lock<std::mutex>{};
+	}
+
+	return std::unique_lock<std::mutex>{mutex_};
+}
+
+template<typename T>
+void Signal::BasicMultichannelResampler<T>::DiscardInputNoLongerNeeded()
+{
+	std::size_t samplesToKeep{GetHistorySize()};
+	std::size_t samplesToRemove{std::max(inputSampleIndex_, samplesToKeep) - samplesToKeep};
+	std::size_t samplesRemoved{std::min(samplesToRemove, inputData_[0].size())};
+	inputSampleIndex_ -= samplesToRemove;
+
+	for(std::size_t channel{0}; channel < channels_; ++channel)
+	{
+		// Only the tail the sinc filter still needs is moved, the buffer keeps its memory for the next input
+		inputData_[channel].erase(inputData_[channel].begin(), inputData_[channel].begin() + samplesRemoved);
+
+		// Keep the unfiltered input lined up with the input
+		if(lowPassFiltering_)
+		{
+			unfilteredInputData_[channel].erase(unfilteredInputData_[channel].begin(), unfilteredInputData_[channel].begin() + samplesRemoved);
+		}
+	}
+
+	if(lowPassFiltering_)
+	{
+		filteredInputSize_ = std::max(filteredInputSize_, samplesRemoved) - samplesRemoved;
+	}
+}
+
+template class Signal::BasicMultichannelResampler<double>;
+template class Signal::BasicMultichannelResampler<float>;
@@ -70,8 +70,13 @@ double Signal::GetPeakFrequencyByQuinn(std::size_t peakBin,
 // Let's the user just pass in a peakBin and time domain signal and internally does the FFT
 double Signal::GetPeakFrequencyByQuinn(std::size_t peakBin, const std::vector<double>& timeDomainSignal, double inputSignalSampleRate)
 {
-	auto frequencyDomain{Signal::Fourier::ApplyFFT(AudioData(timeDomainSignal))};
-	return GetPeakFrequencyByQuinn(peakBin, timeDomainSignal.size(), frequencyDomain.GetRealComponent(), frequencyDomain.GetImaginaryComponent(), inputSignalSampleRate);
+	return GetPeakFrequencyByQuinn(peakBin, AudioDataView{timeDomainSignal}, inputSignalSampleRate);
+}
+
+double Signal::GetPeakFrequencyByQuinn(std::size_t peakBin, const AudioDataView& timeDomainSignal, double inputSignalSampleRate)
+{
+	auto frequencyDomain{Signal::Fourier::ApplyFFT(timeDomainSignal)};
+	return GetPeakFrequencyByQuinn(peakBin, timeDomainSignal.GetSize(), frequencyDomain.GetRealComponent(), frequencyDomain.GetImaginaryComponent(), inputSignalSampleRate);
 }
 
 // The phase parameter is the starting phase of the signal and can be anywhere from 0-to-360 degrees
@@ -96,7 +101,12 @@ std::vector<double> Signal::GenerateSineWave(double sampleRate, std::size_t leng
 // Don't use this algorithm.  Use the Quinn algorithm below.  If you have any question which performs better see the TestPeakBinFrequencyAccuracy UT
 double Signal::GetPeakFrequencyByCorrelation(std::size_t peakBin, const std::vector<double>& timeDomainSignal, double inputSignalSampleRate)
 {
-	double fourierSize{static_cast<double>(timeDomainSignal.size())};
+	return GetPeakFrequencyByCorrelation(peakBin, AudioDataView{timeDomainSignal}, inputSignalSampleRate);
+}
+
+double Signal::GetPeakFrequencyByCorrelation(std::size_t peakBin, const AudioDataView& timeDomainSignal, double inputSignalSampleRate)
+{
+	double fourierSize{static_cast<double>(timeDomainSignal.GetSize())};
 	double hzPerFrequencyBin{inputSignalSampleRate / fourierSize};
 
 	double startFrequency{static_cast<double>(peakBin - 1) * hzPerFrequencyBin};
@@ -107,7 +117,7 @@ double Signal::GetPeakFrequencyByCorrelation(std::size_t peakBin, const std::vec
 
 	for(double correlateFrequency{startFrequency}; correlateFrequency <= endFrequency; correlateFrequency += 0.1)
 	{
-		std::vector<double> correlationSignal{Signal::GenerateSineWave(inputSignalSampleRate, timeDomainSignal.size(), correlateFrequency)};
+		std::vector<double> correlationSignal{Signal::GenerateSineWave(inputSignalSampleRate, timeDomainSignal.GetSize(), correlateFrequency)};
 
 		double aTimesBSum{0};
 		double aSquaredSum{0};
@@ -32,13 +32,18 @@
 #include <Signal/Windowing.h>
 #include <Signal/PeakProfile.h>
 #include <Utilities/Exception.h>
+#include <Utilities/MemoryPool.h>
 #include <iostream>
 
-Signal::PhaseVocoder::PhaseVocoder(std::size_t sampleRate, std::size_t inputLength, double stretchFactor) :
+template<typename T>
+Signal::BasicPhaseVocoder<T>::BasicPhaseVocoder(std::size_t sampleRate, std::size_t inputLength, double stretchFactor, 
+													Utilities::Synchronization synchronization) :
 	sampleRate_{sampleRate}, 
 	inputLength_{inputLength},
 	stretchFactor_{stretchFactor},
-	minimumOutputSamplesNecessary_{static_cast<std::size_t>(static_cast<double>(inputLength_) * stretchFactor_ + 0.5)}
+	minimumOutputSamplesNecessary_{static_cast<std::size_t>(static_cast<double>(inputLength_) * stretchFactor_ + 0.5)},
+	outputQueue_{synchronization},
+	synchronization_{synchronization}
 {
 	if(!CheckForEdgeCases()) 
 	{
@@ -47,18 +52,21 @@ Signal::PhaseVocoder::PhaseVocoder(std::size_t sampleRate, std::size_t inputLeng
 	}
 }
 
-Signal::PhaseVocoder::~PhaseVocoder()
+template<typename T>
+Signal::BasicPhaseVocoder<T>::~BasicPhaseVocoder()
 {
 
 }
 
-void Signal::PhaseVocoder::SubmitAudioData(const AudioData& audioData)
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::SubmitAudioData(const BasicAudioData<T>& audioData)
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	if(noStretch_)  // Check for edge case
 	{
 		HandleNoStretchInput(audioData);
+		PublishOutput();
 		return;
 	}
 
@@ -76,24 +84,20 @@ void Signal::PhaseVocoder::SubmitAudioData(const AudioData& audioData)
 	{
 		ProcessBuffer();
 	}
+
+	PublishOutput();
 }
 
-AudioData Signal::PhaseVocoder::GetAudioData(uint64_t samples)
+template<typename T>
+BasicAudioData<T> Signal::BasicPhaseVocoder<T>::GetAudioData(uint64_t samples)
 {
-	std::lock_guard<std::mutex> guard(mutex_);
-
-	uint64_t samplesToRetrieve{samples};
-	if(outputData_.GetSize() < samplesToRetrieve)
-	{
-		samplesToRetrieve = outputData_.GetSize();
-	}
-
-	return outputData_.RetrieveRemove(samplesToRetrieve);
+	return outputQueue_.Pop(samples);
 }
 
-AudioData Signal::PhaseVocoder::FlushAudioData()
+template<typename T>
+BasicAudioData<T> Signal::BasicPhaseVocoder<T>::FlushAudioData()
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	if(shortInputCompress_)  // Check for edge case
 	{
@@ -111,42 +115,44 @@ AudioData Signal::PhaseVocoder::FlushAudioData()
 		ProcessBuffer();
 	} while(windowsProcessed_ <= OVERLAP_FACTOR || totalOutputSamplesCreated_ < outputSamplesLimit);
 
-	AudioData audioData{outputData_};
-	outputData_.Clear();
+	PublishOutput();
 
-	return audioData;
+	return outputQueue_.PopAll();
 }
 
 // Returns the stretch factor given at construction
-double Signal::PhaseVocoder::GetStretchFactor()
+template<typename T>
+double Signal::BasicPhaseVocoder<T>::GetStretchFactor()
 {
 	return stretchFactor_;
 }
 
-AudioData Signal::PhaseVocoder::HandleShortInputCompress()
+template<typename T>
+BasicAudioData<T> Signal::BasicPhaseVocoder<T>::HandleShortInputCompress()
 {
 	auto outputSampleCount{static_cast<std::size_t>(static_cast<double>(inputData_.GetSize()) * stretchFactor_ + 0.5)};
-	AudioData audioData(inputData_);
+	BasicAudioData<T> audioData(inputData_);
 	audioData.Truncate(outputSampleCount);
 	inputData_.Clear();
 	return audioData;
 }
 
-std::size_t Signal::PhaseVocoder::OutputSamplesAvailable()
+template<typename T>
+std::size_t Signal::BasicPhaseVocoder<T>::OutputSamplesAvailable()
 {
-	std::lock_guard<std::mutex> guard(mutex_);
-
-	return outputData_.GetSize();
+	return outputQueue_.GetSize();
 }
 
-void Signal::PhaseVocoder::Reset()
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::Reset()
 {
-	std::lock_guard<std::mutex> guard(mutex_);
+	auto guard{LockProcessing()};
 
 	inputData_.Clear();
 	transientSamples_.Clear();
 	windowsInUse_.clear();
 	outputData_.Clear();
+	outputQueue_.Clear();
 	previousWrappedPhases_.clear();
 	previousExtrapolatedUnwrappedPhases_.clear();
 	windowsProcessed_ = 0;
@@ -155,7 +161,26 @@ void Signal::PhaseVocoder::Reset()
 	sampleAdvancementRemainder_ = 0.0;
 }
 
-bool Signal::PhaseVocoder::CheckForEdgeCases()
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::PublishOutput()
+{
+	outputQueue_.Push(outputData_);
+	outputData_.Clear();
+}
+
+template<typename T>
+std::unique_lock<std::mutex> Signal::BasicPhaseVocoder<T>::LockProcessing()
+{
+	if(synchronization_ == Utilities::Synchronization::SINGLE_THREADED)
+	{
+		return std::unique_lock<std::mutex>{};
+	}
+
+	return std::unique_lock<std::mutex>{mutex_};
+}
+
+template<typename T>
+bool Signal::BasicPhaseVocoder<T>::CheckForEdgeCases()
 {
 	if(CheckForNoStretchEdgeCase())
 	{
@@ -170,7 +195,8 @@ bool Signal::PhaseVocoder::CheckForEdgeCases()
 	return false;
 }
 
-bool Signal::PhaseVocoder::CheckForNoStretchEdgeCase()
+template<typename T>
+bool Signal::BasicPhaseVocoder<T>::CheckForNoStretchEdgeCase()
 {
 	if(stretchFactor_ == 1.0)
 	{
@@ -180,7 +206,8 @@ bool Signal::PhaseVocoder::CheckForNoStretchEdgeCase()
 	return false;
 }
 
-bool Signal::PhaseVocoder::CheckForShortInputEdgeCases()
+template<typename T>
+bool Signal::BasicPhaseVocoder<T>::CheckForShortInputEdgeCases()
 {
 	if(inputLength_ < FFT_SIZE && stretchFactor_ > 1.0)
 	{
@@ -200,7 +227,8 @@ bool Signal::PhaseVocoder::CheckForShortInputEdgeCases()
 }
 
 // The following calculates the transientCutoff_ and sampleAdvancement_
-void Signal::PhaseVocoder::DoPrecalculations()
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::DoPrecalculations()
 {
 	double fftSizeOneEighth{QUARTER_FFT_SIZE / 2};
 
@@ -229,13 +257,15 @@ void Signal::PhaseVocoder::DoPrecalculations()
 
 // This helps handle the simple case where there is a stretch factor of 1.0 (i.e. "no stretch").  In this case we 
 // simply copy the input to the output buffer.
-void Signal::PhaseVocoder::HandleNoStretchInput(const AudioData& audioData)
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::HandleNoStretchInput(const BasicAudioData<T>& audioData)
 {
 	outputData_.Append(audioData);
 	totalOutputSamplesCreated_ += audioData.GetSize();
 }
 
-void Signal::PhaseVocoder::ProcessBuffer()
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::ProcessBuffer()
 {
 	if(inputData_.GetSize() < FFT_SIZE)
 	{
@@ -248,18 +278,18 @@ void Signal::PhaseVocoder::ProcessBuffer()
 	std::size_t advancement{static_cast<std::size_t>(sampleAdvancement_ + sampleAdvancementRemainder_ + 0.5)};
 
 	// Here we get the next input window, apply the Blackman window, and do the Fourier transform to get the phases.
-	auto inputWindow{inputData_.Retrieve(FFT_SIZE)};
-	Signal::BlackmanWindow(inputWindow.GetDataWriteAccess());
-	auto frequencyDomain{Signal::Fourier::ApplyFFT(inputWindow)};
+	Utilities::PoolVector<T> inputWindow(FFT_SIZE);
+	Signal::BlackmanWindow(inputData_.View(0, FFT_SIZE), inputWindow.data());
+	Signal::Fourier::ApplyFFT(BasicAudioDataView<T>{inputWindow}, analysisFrequencyDomain_);
 
 	// Next we do the actual processing
 	if(windowsProcessed_ == 0)
 	{
-		HandleFirstWindow(frequencyDomain);
+		HandleFirstWindow(analysisFrequencyDomain_);
 	}
 	else
 	{
-		CreateSynthesizedOutputWindow(frequencyDomain, advancement);
+		CreateSynthesizedOutputWindow(analysisFrequencyDomain_, advancement);
 	}
 
 	// And finally we do the advancement of the buffer, sample counts, etc
@@ -272,7 +302,8 @@ void Signal::PhaseVocoder::ProcessBuffer()
 }
 
 // The first window does no stretching, since, well, it's the first window.  It also obtains the transient audio.
-void Signal::PhaseVocoder::HandleFirstWindow(Signal::FrequencyDomain& frequencyDomain)
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::HandleFirstWindow(Signal::FrequencyDomain& frequencyDomain)
 {
 	auto wrappedPhases = frequencyDomain.GetWrappedPhases();
 
@@ -288,16 +319,17 @@ void Signal::PhaseVocoder::HandleFirstWindow(Signal::FrequencyDomain& frequencyD
 
 	// Pass the first buffer to the output stage unaltered since there is no stretching on the first buffer 
 	auto audioData{inputData_.Retrieve(static_cast<uint64_t>(FFT_SIZE))};
-	OverlapAndAddForOutput(audioData);
+	OverlapAndAddForOutput(std::move(audioData));
 
 	// Save off our starting phases as our starting point
 	previousWrappedPhases_ = wrappedPhases;
 	previousExtrapolatedUnwrappedPhases_ = wrappedPhases;
 }
 
-void Signal::PhaseVocoder::CreateSynthesizedOutputWindow(Signal::FrequencyDomain& frequencyDomain, std::size_t advancement)
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::CreateSynthesizedOutputWindow(Signal::FrequencyDomain& frequencyDomain, std::size_t advancement)
 {
-	auto wrappedPhases = frequencyDomain.GetWrappedPhases();
+	const auto& wrappedPhases = frequencyDomain.GetWrappedPhases();
 
 	// The PeakProfile will find all the "peaks" in the frequency domain.  We will then use it to find out what the 
 	// local peak bin is for a given frequency bin.
@@ -306,17 +338,18 @@ void Signal::PhaseVocoder::CreateSynthesizedOutputWindow(Signal::FrequencyDomain
 	// The timeDomainSignal is the unaltered input signal.  This is needed when determining the peak frequency bins 
 	// below.  If we give this process the time domain signal with a Blackman window already applied to it the peak 
 	// frequency calculations will be wrong.
-	auto timeDomainSignal{inputData_.Retrieve(FFT_SIZE)};
+	auto timeDomainSignal{inputData_.View(0, FFT_SIZE)};
 
 	// Get the frequency for each peak bin from the PeakProfile.  We could wait and do it in the for loop below, but if we 
 	// did we would be re-calculating the same peak frequency for every bin that had that bin as a local peak.
 	auto frequencyPeaks{GetPeakFrequencies(timeDomainSignal, peakProfile)};
 	
 	// This will store the new frequency domain after we're done processing this window
-	Signal::FrequencyDomain newFrequencyDomain;
+	auto& newFrequencyDomain = synthesisFrequencyDomain_;
+	newFrequencyDomain.Clear();
 
 	// I'm calculating the magnitudes up here so we don't recalculate them for each bin
-	auto magnitudes = frequencyDomain.GetMagnitudes();
+	const auto& magnitudes = frequencyDomain.GetMagnitudes();
 
 	// In this loop we calculate the new phase for each frequency bin, which then allows us to calculate new ReX and ImX values.
 	for(std::size_t currentBin = 0; currentBin < wrappedPhases.size(); ++currentBin)
@@ -339,23 +372,25 @@ void Signal::PhaseVocoder::CreateSynthesizedOutputWindow(Signal::FrequencyDomain
 	}
 
 	// Now that we have the new frequency domain signal, we can apply a inverse Fourier transform to get it back to the time domain...
-	auto synthisizedSignal{Signal::Fourier::ApplyInverseFFT(newFrequencyDomain)};
+	auto synthisizedSignal{Signal::Fourier::ApplyInverseFFT<T>(newFrequencyDomain)};
 
 
 	// Then hand it to the overlap-and-add procedure
-	OverlapAndAddForOutput(synthisizedSignal);
+	OverlapAndAddForOutput(std::move(synthisizedSignal));
 }
 
 // Here we calculate the frequency for each peak bin from the PeakProfile and return it in a std::map where the key is the peak 
 // bin index and the value is the peak frequency value in Hz for the peak bin.  We could wait and do it in the for loop below.
 // did we would be re-calculating the same peak frequency for every bin that had that bin as a local peak.
-std::map<std::size_t, double> Signal::PhaseVocoder::GetPeakFrequencies(const AudioData& timeDomainSignal, Signal::PeakProfile& peakProfile)
+template<typename T>
+std::map<std::size_t, double> Signal::BasicPhaseVocoder<T>::GetPeakFrequencies(const BasicAudioDataView<T>& timeDomainSignal, Signal::PeakProfile& peakProfile)
 {
 	// The GetPeakFrequencyByQuinn() call needs the FFT of the time domain signal to do it's calculation.  If you look at it's 
 	// function prototypes you'll see two methods: One where it takes the time domain signal and another where it takes the 
 	// real and imaginary frequency components.  By giving it the real and imaginary signals we can just do the FFT outside 
 	// the loop and save the time of doing the same FFT over and over.
-	auto frequencyDomain{Signal::Fourier::ApplyFFT(AudioData(timeDomainSignal))};
+	auto& frequencyDomain = peakFrequencyDomain_;
+	Signal::Fourier::ApplyFFT(timeDomainSignal, frequencyDomain);
 
 	std::map<std::size_t, double> frequencyPeaks;
 	auto getPeakFrequency{[&](std::size_t peakBin)
@@ -368,7 +403,8 @@ std::map<std::size_t, double> Signal::PhaseVocoder::GetPeakFrequencies(const Aud
 }
 
 // This method is at the heart of what makes the Phase Vocoder work
-double Signal::PhaseVocoder::CalculateNewPhaseWrapped(std::size_t currentBin, double currentWrappedPhase, double peakFrequency, std::size_t advancement)
+template<typename T>
+double Signal::BasicPhaseVocoder<T>::CalculateNewPhaseWrapped(std::size_t currentBin, double currentWrappedPhase, double peakFrequency, std::size_t advancement)
 {
 	if(advancement == 0)
 	{
@@ -409,7 +445,8 @@ double Signal::PhaseVocoder::CalculateNewPhaseWrapped(std::size_t currentBin, do
 }
 
 // This function handles the overlap-and-add process for the synthesized windows
-void Signal::PhaseVocoder::OverlapAndAddForOutput(AudioData& newSythesizedWindow)
+template<typename T>
+void Signal::BasicPhaseVocoder<T>::OverlapAndAddForOutput(BasicAudioData<T> newSythesizedWindow)
 {
 	// Get rid of the oldest of the four past windows since we'll no longer need it now that 
 	// we're adding a new window.
@@ -421,17 +458,17 @@ void Signal::PhaseVocoder::OverlapAndAddForOutput(AudioData& newSythesizedWindow
 	// Prep the new window and add it into the list of past windows
 	BlackmanWindow(newSythesizedWindow.GetDataWriteAccess());
 	newSythesizedWindow.Amplify(SYNTHEIZED_OVERLAP_AMP_FACTOR);
-	windowsInUse_.push_back(newSythesizedWindow);
+	windowsInUse_.push_back(std::move(newSythesizedWindow));
 
 	// Now perform the overlap and add with the previous synthesized windows *if* we have enough windows
-	std::vector<double> accumulatedSamples(QUARTER_FFT_SIZE, 0.0);
+	Utilities::PoolVector<T> accumulatedSamples(QUARTER_FFT_SIZE, T{0});
 	if(windowsInUse_.size () == 4)
 	{
 		std::size_t windowCount = windowsInUse_.size();
-		for(auto window : windowsInUse_)
+		for(const auto& window : windowsInUse_)
 		{
 			--windowCount;
-			auto windowData{window.GetData()};
+			const T* windowData{window.GetDataPointer()};
 			for(unsigned int i = 0; i < QUARTER_FFT_SIZE; ++i)
 			{
 				accumulatedSamples[i] += windowData[windowCount * QUARTER_FFT_SIZE + i];
@@ -449,7 +486,7 @@ void Signal::PhaseVocoder::OverlapAndAddForOutput(AudioData& newSythesizedWindow
 		}
 		else if(transientSamples_.GetSize() == QUARTER_FFT_SIZE && windowsInUse_.size() == 4)
 		{
-			auto resultingAudio{MixAtBestCorrelation(transientSamples_.RetrieveRemove(QUARTER_FFT_SIZE), AudioData(accumulatedSamples))};
+			auto resultingAudio{MixAtBestCorrelation(transientSamples_.RetrieveRemove(QUARTER_FFT_SIZE), BasicAudioData<T>(accumulatedSamples.data(), accumulatedSamples.size()))};
 			outputData_.Append(resultingAudio);
 			totalOutputSamplesCreated_ += resultingAudio.GetSize();
 		}
@@ -457,18 +494,20 @@ void Signal::PhaseVocoder::OverlapAndAddForOutput(AudioData& newSythesizedWindow
 	else if(windowsInUse_.size() == 4)
 	{
 		// And we finally have a new output buffer of 1024 samples so we add that to our FIFO output data
-		outputData_.PushBuffer(accumulatedSamples);
+		outputData_.PushBuffer(accumulatedSamples.data(), accumulatedSamples.size());
 		totalOutputSamplesCreated_ += accumulatedSamples.size();
 	}
 }
 
-double Signal::PhaseVocoder::ConvertUnwrappedPhaseToWrappedPhase(double unwrappedPhase)
+template<typename T>
+double Signal::BasicPhaseVocoder<T>::ConvertUnwrappedPhaseToWrappedPhase(double unwrappedPhase)
 {
 	return fmod(unwrappedPhase, TWO_PI_RADIANS);
 }
 
 // This is a method that performs mixing of two audio signals but does so to avoid phase cancellation.
-AudioData Signal::PhaseVocoder::MixAtBestCorrelation(const AudioData& transientBuffer, const AudioData& stretchBuffer)
+template<typename T>
+BasicAudioData<T> Signal::BasicPhaseVocoder<T>::MixAtBestCorrelation(const BasicAudioData<T>& transientBuffer, const BasicAudioData<T>& stretchBuffer)
 {
 	// We first do some up from sanity checks
 
@@ -490,8 +529,8 @@ AudioData Signal::PhaseVocoder::MixAtBestCorrelation(const AudioData& transientB
 
 	// We then do correlation on the first 256 samples to see what matches best
 
-	auto transientData{transientBuffer.GetData()};
-	auto stretchData{stretchBuffer.GetData()};
+	const T* transientData{transientBuffer.GetDataPointer()};
+	const T* stretchData{stretchBuffer.GetDataPointer()};
 
 	struct
 	{
@@ -514,8 +553,8 @@ AudioData Signal::PhaseVocoder::MixAtBestCorrelation(const AudioData& transientB
 		}
 	}
 
-	AudioData transientBufferModified{transientBuffer};
-	AudioData stretchBufferModified{stretchBuffer};
+	BasicAudioData<T> transientBufferModified{transientBuffer};
+	BasicAudioData<T> stretchBufferModified{stretchBuffer};
 
 	if(bestCorrelationFit.sampleIndex_ > 0)
 	{
@@ -536,4 +575,7 @@ AudioData Signal::PhaseVocoder::MixAtBestCorrelation(const AudioData& transientB
 	transientBufferModified.LinearCrossfade(stretchBufferModified);
 
 	return transientBufferModified;
-}
\ No newline at end of file
+}
+
+template class Signal::BasicPhaseVocoder<double>;
+template class Signal::BasicPhaseVocoder<float>;
@@ -148,16 +148,26 @@ std::vector<double> Signal::ConvertSigned16ToFloat64(const std::vector<int16_t>&
 
 std::vector<int16_t> Signal::ConvertAudioDataToSigned16(const AudioData& audioData)
 {
-	std::vector<int16_t> returnSignal;
+	return Signal::ConvertAudioDataToSigned16(audioData.View());
+}
+
+std::vector<int16_t> Signal::ConvertAudioDataToSigned16(const AudioDataView& audioData)
+{
+	std::vector<int16_t> returnSignal(audioData.GetSize());
 	for(std::size_t i{0}; i < audioData.GetSize(); ++i)
 	{
-		returnSignal.push_back(Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(audioData.GetData()[i]));
+		returnSignal[i] = Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(audioData[i]);
 	}
 
 	return returnSignal;
 }
 
 std::vector<int16_t> Signal::ConvertAudioDataToInterleavedSigned16(const AudioData& leftChannel, const AudioData& rightChannel)
+{
+	return Signal::ConvertAudioDataToInterleavedSigned16(leftChannel.View(), rightChannel.View());
+}
+
+std::vector<int16_t> Signal::ConvertAudioDataToInterleavedSigned16(const AudioDataView& leftChannel, const AudioDataView& rightChannel)
 {
 	if(leftChannel.GetSize() != rightChannel.GetSize())
 	{
@@ -165,11 +175,11 @@ std::vector<int16_t> Signal::ConvertAudioDataToInterleavedSigned16(const AudioDa
 						"and right channel has", rightChannel.GetSize(), "samples"));
 	}
 
-	std::vector<int16_t> returnSignal;
+	std::vector<int16_t> returnSignal(leftChannel.GetSize() * 2);
 	for(std::size_t i{0}; i < leftChannel.GetSize(); ++i)
 	{
-		returnSignal.push_back(Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(leftChannel.GetData()[i]));
-		returnSignal.push_back(Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(rightChannel.GetData()[i]));
+		returnSignal[2 * i] = Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(leftChannel[i]);
+		returnSignal[2 * i + 1] = Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(rightChannel[i]);
 	}
 
 	return returnSignal;
@@ -198,12 +208,79 @@ std::vector<AudioData> Signal::ConvertInterleavedSigned16ToAudioData(const std::
 		Utilities::ThrowException("Input given is not divisible by two and therefore cannot be interleaved");
 	}
 
-	std::vector<int16_t> returnSignal;
+	audioDataLeft.GetDataWriteAccess().reserve(interleavedSigned16.size() / 2);
+	audioDataRight.GetDataWriteAccess().reserve(interleavedSigned16.size() / 2);
 	for(std::size_t i{0}; i < interleavedSigned16.size();)
 	{
 		audioDataLeft.PushSample(Signal::SignalConversion::ConvertSigned16SampleToFloat64(interleavedSigned16[i++]));
 		audioDataRight.PushSample(Signal::SignalConversion::ConvertSigned16SampleToFloat64(interleavedSigned16[i++]));
 	}
 
-	return std::vector<AudioData>{audioDataLeft, audioDataRight};
+	// Move the channels into the result, an initializer list would copy them
+	std::vector<AudioData> audioData;
+	audioData.reserve(2);
+	audioData.push_back(std::move(audioDataLeft));
+	audioData.push_back(std::move(audioDataRight));
+	return audioData;
+}
+
+AudioBuffer Signal::ConvertInterleavedSigned16ToAudioBuffer(const std::vector<int16_t>& interleavedSigned16, std::size_t channels, AudioBuffer::Layout layout)
+{
+	if(channels == 0 || interleavedSigned16.size() % channels != 0)
+	{
+		Utilities::ThrowException("Input given is not divisible by the channel count and therefore cannot be interleaved", interleavedSigned16.size(), channels);
+	}
+
+	std::size_t frames{interleavedSigned16.size() / channels};
+	AudioBuffer audioBuffer{channels, frames, layout};
+	double* samples{audioBuffer.GetDataPointerWriteAccess()};
+
+	if(layout == AudioBuffer::Layout::INTERLEAVED)
+	{
+		for(std::size_t i{0}; i < interleavedSigned16.size(); ++i)
+		{
+			samples[i] = Signal::SignalConversion::ConvertSigned16SampleToFloat64(interleavedSigned16[i]);
+		}
+	}
+	else
+	{
+		for(std::size_t frame{0}; frame < frames; ++frame)
+		{
+			for(std::size_t channel{0}; channel < channels; ++channel)
+			{
+				samples[channel * frames + frame] = Signal::SignalConversion::ConvertSigned16SampleToFloat64(interleavedSigned16[frame * channels + channel]);
+			}
+		}
+	}
+
+	return audioBuffer;
+}
+
+std::vector<int16_t> Signal::ConvertAudioBufferToInterleavedSigned16(const AudioBuffer& audioBuffer)
+{
+	std::size_t channels{audioBuffer.GetChannels()};
+	std::size_t frames{audioBuffer.GetFrames()};
+	const double* samples{audioBuffer.GetDataPointer()};
+
+	std::vector<int16_t> returnSignal(channels * frames);
+
+	if(audioBuffer.GetLayout() == AudioBuffer::Layout::INTERLEAVED)
+	{
+		for(std::size_t i{0}; i < returnSignal.size(); ++i)
+		{
+			returnSignal[i] = Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(samples[i]);
+		}
+	}
+	else
+	{
+		for(std::size_t frame{0}; frame < frames; ++frame)
+		{
+			for(std::size_t channel{0}; channel < channels; ++channel)
+			{
+				returnSignal[frame * channels + channel] = Signal::SignalConversion::ConvertFloat64SampleToSigned16Sample(samples[channel * frames + frame]);
+			}
+		}
+	}
+
+	return returnSignal;
 }
@@ -0,0 +1,234 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Signal/Stft.h>
+#include <Signal/FftPlan.h>
+#include <Utilities/Exception.h>
+#include <Utilities/MemoryPool.h>
+#include <algorithm>
+
+namespace
+{
+	void CheckParameters(const std::vector<double>& window, std::size_t hopSize, std::size_t fftSize)
+	{
+		if(window.empty() || window.size() > fftSize)
+		{
+			Utilities::ThrowException("STFT window must not be empty or longer than the FFT", window.size(), fftSize);
+		}
+
+		if(hopSize == 0)
+		{
+			Utilities::ThrowException("STFT hop size must be at least one sample");
+		}
+	}
+
+	// Enough frames to put every sample of the signal in a frame
+	std::size_t GetFrameCount(std::size_t signalLength, std::size_t windowLength, std::size_t hopSize)
+	{
+		if(signalLength == 0)
+		{
+			return 0;
+		}
+
+		if(signalLength <= windowLength)
+		{
+			return 1;
+		}
+
+		return 1 + (signalLength - windowLength + hopSize - 1) / hopSize;
+	}
+}
+
+Signal::StftFrames::StftFrames() { }
+
+Signal::StftFrames::StftFrames(std::size_t frameCount, std::size_t fftSize, std::size_t hopSize, std::size_t signalLength) :
+	frameCount_{frameCount},
+	fftSize_{fftSize},
+	hopSize_{hopSize},
+	signalLength_{signalLength},
+	binCount_{fftSize / 2 + 1},
+	data_(frameCount * binCount_ * 2, 0.0)
+{
+
+}
+
+std::size_t Signal::StftFrames::GetFrameCount() const
+{
+	return frameCount_;
+}
+
+std::size_t Signal::StftFrames::GetBinCount() const
+{
+	return binCount_;
+}
+
+std::size_t Signal::StftFrames::GetFftSize() const
+{
+	return fftSize_;
+}
+
+std::size_t Signal::StftFrames::GetHopSize() const
+{
+	return hopSize_;
+}
+
+std::size_t Signal::StftFrames::GetSignalLength() const
+{
+	return signalLength_;
+}
+
+const double* Signal::StftFrames::GetReal(std::size_t frame) const
+{
+	return data_.data() + frame * binCount_ * 2;
+}
+
+double* Signal::StftFrames::GetReal(std::size_t frame)
+{
+	return data_.data() + frame * binCount_ * 2;
+}
+
+const double* Signal::StftFrames::GetImaginary(std::size_t frame) const
+{
+	return GetReal(frame) + binCount_;
+}
+
+double* Signal::StftFrames::GetImaginary(std::size_t frame)
+{
+	return GetReal(frame) + binCount_;
+}
+
+Signal::FrequencyDomain Signal::StftFrames::GetFrequencyDomain(std::size_t frame) const
+{
+	if(frame >= frameCount_)
+	{
+		Utilities::ThrowException("Attempting to access an STFT frame that does not exist", frameCount_, frame);
+	}
+
+	Signal::FrequencyDomain frequencyDomain;
+	frequencyDomain.Assign(GetReal(frame), GetImaginary(frame), binCount_);
+	return frequencyDomain;
+}
+
+template<typename T>
+Signal::StftFrames Signal::Stft(const BasicAudioDataView<T>& signal, const std::vector<double>& window, std::size_t hopSize, 
+								std::size_t fftSize, Utilities::ThreadPool& threadPool)
+{
+	CheckParameters(window, hopSize, fftSize);
+
+	auto plan{Signal::Fourier::FftPlan::GetPlan(fftSize)};
+	StftFrames frames{GetFrameCount(signal.GetSize(), window.size(), hopSize), fftSize, hopSize, signal.GetSize()};
+
+	// Frames are independent, each writes only its own part of the output
+	threadPool.ParallelFor(frames.GetFrameCount(), [&](std::size_t beginFrame, std::size_t endFrame)
+	{
+		Utilities::PoolVector<double> input(fftSize, 0.0);
+		for(std::size_t frame{beginFrame}; frame < endFrame; ++frame)
+		{
+			std::size_t start{frame * hopSize};
+			std::size_t samples{std::min(window.size(), signal.GetSize() - start)};
+			for(std::size_t i{0}; i < samples; ++i)
+			{
+				input[i] = signal[start + i] * window[i];
+			}
+
+			std::fill(input.begin() + samples, input.end(), 0.0);
+			plan->ForwardReal(input.data(), frames.GetReal(frame), frames.GetImaginary(frame));
+		}
+	});
+
+	return frames;
+}
+
+// Neighbouring frames overlap, so the frames are grouped into blocks spanning at least a window's worth of 
+// samples.  Blocks then only overlap their neighbours, so all even blocks can be added in parallel followed 
+// by all odd blocks.  The blocks don't depend on the number of threads, so neither does the order of the sums.
+template<typename T>
+BasicAudioData<T> Signal::Istft(const StftFrames& frames, const std::vector<double>& window, Utilities::ThreadPool& threadPool)
+{
+	std::size_t fftSize{frames.GetFftSize()};
+	std::size_t hopSize{frames.GetHopSize()};
+	std::size_t signalLength{frames.GetSignalLength()};
+	if(frames.GetFrameCount() == 0)
+	{
+		return BasicAudioData<T>{};
+	}
+
+	CheckParameters(window, hopSize, fftSize);
+
+	auto plan{Signal::Fourier::FftPlan::GetPlan(fftSize)};
+
+	// The sums cover the full last frame, which may reach past the end of the signal
+	std::size_t sumLength{(frames.GetFrameCount() - 1) * hopSize + window.size()};
+	std::vector<double> output(sumLength, 0.0);
+	std::vector<double> windowSums(sumLength, 0.0);
+
+	std::size_t framesPerBlock{(window.size() + hopSize - 1) / hopSize};
+	std::size_t blocks{(frames.GetFrameCount() + framesPerBlock - 1) / framesPerBlock};
+
+	for(std::size_t parity{0}; parity < 2; ++parity)
+	{
+		threadPool.ParallelFor((blocks + 1 - parity) / 2, [&](std::size_t beginIndex, std::size_t endIndex)
+		{
+			Utilities::PoolVector<double> samples(fftSize);
+			for(std::size_t index{beginIndex}; index < endIndex; ++index)
+			{
+				std::size_t block{index * 2 + parity};
+				std::size_t endFrame{std::min((block + 1) * framesPerBlock, frames.GetFrameCount())};
+				for(std::size_t frame{block * framesPerBlock}; frame < endFrame; ++frame)
+				{
+					plan->InverseReal(frames.GetReal(frame), frames.GetImaginary(frame), samples.data());
+
+					std::size_t start{frame * hopSize};
+					for(std::size_t i{0}; i < window.size(); ++i)
+					{
+						output[start + i] += samples[i] * window[i];
+						windowSums[start + i] += window[i] * window[i];
+					}
+				}
+			}
+		});
+	}
+
+	// Samples the window never reaches can't be recovered and are left silent
+	const double MINIMUM_WINDOW_SUM{1e-10};
+	BasicAudioData<T> audioData;
+	audioData.AddSilence(signalLength);
+	T* audioSamples{audioData.GetDataPointerWriteAccess()};
+	for(std::size_t i{0}; i < signalLength; ++i)
+	{
+		if(windowSums[i] > MINIMUM_WINDOW_SUM)
+		{
+			audioSamples[i] = static_cast<T>(output[i] / windowSums[i]);
+		}
+	}
+
+	return audioData;
+}
+
+template Signal::StftFrames Signal::Stft(const BasicAudioDataView<double>&, const std::vector<double>&, std::size_t, std::size_t, Utilities::ThreadPool&);
+template Signal::StftFrames Signal::Stft(const BasicAudioDataView<float>&, const std::vector<double>&, std::size_t, std::size_t, Utilities::ThreadPool&);
+template BasicAudioData<double> Signal::Istft(const StftFrames&, const std::vector<double>&, Utilities::ThreadPool&);
+template BasicAudioData<float> Signal::Istft(const StftFrames&, const std::vector<double>&, Utilities::ThreadPool&);
@@ -234,8 +234,8 @@ bool Signal::TransientDetector::CheckForEnoughAudioToProcess()
 // Check if the input is silent as there is no sense in looking for peaks in silence
 bool Signal::TransientDetector::CheckForAllSilence()
 {
-	const std::vector<double>& audioData{audioDataInput_.GetData()};
-	std::size_t sampleCount{audioData.size() - GetLookAheadSampleCount()};
+	const double* audioData{audioDataInput_.GetDataPointer()};
+	std::size_t sampleCount{audioDataInput_.GetSize() - GetLookAheadSampleCount()};
 	for(std::size_t i{0}; i < sampleCount; ++i)
 	{
 		if(audioData[i] > 0.0)
@@ -266,7 +266,7 @@ bool Signal::TransientDetector::FindTransients(std::vector<std::size_t>& transie
 
 	// Try and find peaks in the audio we have
 	Signal::TransientPeakAndValley firstLevelPeakAndValley(0, firstLevelStepSize_);
-	while(GetPeakAndValley(audioDataInput_, firstLevelStepSize_, firstLevelPeakAndValley))
+	while(GetPeakAndValley(audioDataInput_.View(), firstLevelStepSize_, firstLevelPeakAndValley))
 	{
 		auto transientSamplePosition{inputSamplesProcessed_ + FindTransientSamplePosition(firstLevelPeakAndValley)};
 		if(transientsFound_ == false || (3 * firstLevelStepSize_ + lastTransientValue_) <= transientSamplePosition)
@@ -296,9 +296,10 @@ bool Signal::TransientDetector::FindTransients(std::vector<std::size_t>& transie
 std::size_t Signal::TransientDetector::FindFirstTransient()
 {
 	std::size_t samplesToCheck{audioDataInput_.GetSize()};
+	const double* audioData{audioDataInput_.GetDataPointer()};
 	for(std::size_t i{0}; i < samplesToCheck; ++i)
 	{
-		if(audioDataInput_.GetData()[i] > 0.0)
+		if(audioData[i] > 0.0)
 		{
 			return i;
 		}
@@ -314,7 +315,7 @@ std::size_t Signal::TransientDetector::FindTransientSamplePosition(const Signal:
 	Signal::TransientPeakAndValley secondLevelPeakAndValley(0, secondLevelStepSize_);
 	std::size_t secondLevelLength{(firstLevelPeakAndValley.GetPeakSamplePosition() - firstLevelPeakAndValley.GetValleySamplePosition()) + (2 * firstLevelStepSize_)};
 
-	AudioData secondLevelAudioData{audioDataInput_.Retrieve(secondLevelStartPosition, secondLevelLength)};
+	auto secondLevelAudioData{audioDataInput_.View(secondLevelStartPosition, secondLevelLength)};
 	GetPeakAndValley(secondLevelAudioData, secondLevelStepSize_, secondLevelPeakAndValley);
 	secondLevel_.push_back(secondLevelPeakAndValley);
 
@@ -323,7 +324,7 @@ std::size_t Signal::TransientDetector::FindTransientSamplePosition(const Signal:
 	std::size_t thirdLevelLength{(secondLevelPeakAndValley.GetPeakSamplePosition() - secondLevelPeakAndValley.GetValleySamplePosition()) + firstLevelStepSize_};
 	thirdLevel_.push_back(thirdLevelPeakAndValley);
 
-	AudioData thirdLevelAudioData{audioDataInput_.Retrieve(thirdLevelStartPosition, thirdLevelLength)};
+	auto thirdLevelAudioData{audioDataInput_.View(thirdLevelStartPosition, thirdLevelLength)};
 	GetPeakAndValley(thirdLevelAudioData, thirdLevelStepSize_, thirdLevelPeakAndValley);
 
 	return (thirdLevelStartPosition + thirdLevelPeakAndValley.GetValleySamplePosition());
@@ -366,23 +367,21 @@ std::vector<double> Signal::TransientDetector::GetFirstStepValues(const AudioDat
 	for(std::size_t i{0}; i < audioInput.GetSize(); i += firstLevelStepSize_)
 	{
 		std::size_t samplesToRetrieve{std::min(firstLevelStepSize_, (audioInput.GetSize() - i))};
-		auto audio{audioInput.Retrieve(i, samplesToRetrieve)};
+		auto audio{audioInput.View(i, samplesToRetrieve)};
 		firstStepValues.push_back(GetMaxSample(audio, firstLevelStepSize_));
 	}
 	return firstStepValues;
 }
 
-double Signal::TransientDetector::GetMaxSample(const AudioData& audioData, std::size_t sampleCount)
+double Signal::TransientDetector::GetMaxSample(const AudioDataView& audioData, std::size_t sampleCount)
 {
 	std::size_t samplesToIterate{std::min(sampleCount, (audioData.GetSize()))};
 
-	const std::vector<double>& sampleBuffer{audioData.GetData()};
-
 	double maxSample{0.0};
 
 	for(std::size_t i{0}; i < samplesToIterate; ++i)
 	{
-		double currentSample{sampleBuffer[i]};
+		double currentSample{audioData[i]};
 		if(currentSample < 0.0)
 		{
 			currentSample = -1.0 * currentSample;				
@@ -397,7 +396,7 @@ double Signal::TransientDetector::GetMaxSample(const AudioData& audioData, std::
 	return maxSample;
 }
 
-bool Signal::TransientDetector::GetPeakAndValley(const AudioData& audioData, std::size_t stepSize, TransientPeakAndValley& peakAndValley)
+bool Signal::TransientDetector::GetPeakAndValley(const AudioDataView& audioData, std::size_t stepSize, TransientPeakAndValley& peakAndValley)
 {
 	// To find a peak, we need to analyze at least 3 data points
 	if(audioData.GetSize() < (3 * stepSize))
@@ -405,25 +404,23 @@ bool Signal::TransientDetector::GetPeakAndValley(const AudioData& audioData, std
 		return false;
 	}
 
-	AudioData tempBuffer{audioData};
+	// The sampleCounter is the start of the step currently being analyzed
 	std::size_t sampleCounter{0};
 
-	double leftSample{GetMaxSample(tempBuffer, stepSize)};
+	double leftSample{GetMaxSample(audioData.View(sampleCounter, stepSize), stepSize)};
 	peakAndValley.PushPlottedPoint(leftSample);
-	tempBuffer.RemoveFrontSamples(stepSize);
 	sampleCounter += stepSize;
 
-	double centerSample{GetMaxSample(tempBuffer, stepSize)};
+	double centerSample{GetMaxSample(audioData.View(sampleCounter, stepSize), stepSize)};
 	peakAndValley.PushPlottedPoint(centerSample);
-	tempBuffer.RemoveFrontSamples(stepSize);
 	sampleCounter += stepSize;
 
 	std::size_t valleySamplePosition{0};
 	double valleyValue{leftSample};
 
-	while(tempBuffer.GetSize() >= stepSize)
+	while((audioData.GetSize() - sampleCounter) >= stepSize)
 	{
-		auto rightSample{GetMaxSample(tempBuffer, stepSize)};
+		auto rightSample{GetMaxSample(audioData.View(sampleCounter, stepSize), stepSize)};
 		peakAndValley.PushPlottedPoint(rightSample);
 		if(SampleIsPeak(centerSample, leftSample, rightSample))
 		{
@@ -454,7 +451,6 @@ bool Signal::TransientDetector::GetPeakAndValley(const AudioData& audioData, std
 			valleySamplePosition = sampleCounter;
 		}
 
-		tempBuffer.RemoveFrontSamples(stepSize);
 		sampleCounter += stepSize;
 
 		leftSample = centerSample;
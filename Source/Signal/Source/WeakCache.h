@@ -0,0 +1,80 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file WeakCache.h
+//! @brief The weak reference cache behind the plans, tables and kernels shared process-wide.
+
+#pragma once
+
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace Signal {
+
+//! Returns the cached value for the key, or creates, caches and returns it.
+//
+//! The cache only holds weak references, so a value is freed once nothing else uses it and created again if it's 
+//! needed after that.  Values are created outside the lock, as creating one may need other cached values.  If two 
+//! threads race to create the same value the first one stored wins.  Entries whose value has been freed are dropped 
+//! whenever a new value is stored, so the cache only grows with the values in use.
+template<typename Key, typename Value, typename Create>
+std::shared_ptr<const Value> GetCachedValue(std::map<Key, std::weak_ptr<const Value>>& cache, std::mutex& mutex, const Key& key, Create create)
+{
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+		auto existingValue = cache.find(key);
+		if(existingValue != cache.end())
+		{
+			auto value{existingValue->second.lock()};
+			if(value)
+			{
+				return value;
+			}
+		}
+	}
+
+	std::shared_ptr<const Value> value{create()};
+
+	std::lock_guard<std::mutex> guard(mutex);
+	for(auto entry = cache.begin(); entry != cache.end(); )
+	{
+		entry = entry->second.expired() ? cache.erase(entry) : std::next(entry);
+	}
+
+	auto& cachedValue = cache[key];
+	auto existingValue{cachedValue.lock()};
+	if(existingValue)
+	{
+		return existingValue;
+	}
+
+	cachedValue = value;
+	return value;
+}
+
+}
@@ -25,9978 +25,105 @@
  */
 
 #include <Signal/Source/WindowedSincValues.h>
-#include <cstdint>
+#include <Signal/Source/WeakCache.h>
+#include <Utilities/Exception.h>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 // For more info on this please see the document ResamplingUsingWindowedSincFilter.odg 
 // in SabbaticalNotes for details.
 
-// This file contains a list of precalculated sinc values with hamming window
-// applied.  The code below was used to generate this table.  Note that the 
-// values are mirror images around the center point (4,928) but I kept it this 
-// way so that the calculation was easier to understand.  So, there very well 
-// may be performance gains and definitely code simplification in the logic 
-// the GetSincValue() function below but I'm going to leave that for when we 
-// need to do any performance testing.
+// The tables hold the normalized sinc function, sin(PI * x) / (PI * x), with a window applied so 
+// that the frequency response of the filter in the frequency domain is as smooth as possible.  See 
+// page 287 of "The Scientist and Engineer's Guide to Digital Signal Processing" (i.e. Figure 16-1).  
+// There are samplesPerXInteger table values for each unit of x, so the sinc function crosses the x 
+// axis every samplesPerXInteger values, and the window spans zeroCrossingsPerSide zero crossings on 
+// each side of the center.
 //
-// #include <iostream>
-// 
-// #define PI 3.14159265358979323846
-// #define SAMPLES_IN_SINC_FILTER 9857.0
-// #define CENTER_OF_SINC_FILTER SAMPLES_IN_SINC_FILTER/2.0
-// #define SINC_SAMPLES_PER_X_INTEGER 224.0
-// 
-// 	class SincValue
-// 	{
-// 		public:
-// 			SincValue()
-// 			{ 
-// 				std::cout.precision(25);
-// 
-// 				for(int i = CENTER_OF_SINC_FILTER; i > 0; --i)
-// 				{
-// 					std::cout << GetValue(static_cast<double>(i)) << std::endl;
-// 				}
-// 
-// 				std::cout << GetValue(0.0) << std::endl;
-// 
-// 				for(int i = 1; i <= SAMPLES_IN_SINC_FILTER; ++i)
-// 				{
-// 					std::cout << GetValue(static_cast<double>(i)) << std::endl;
-// 				}
-// 			}
-// 
-// 			double GetValue(double xPosition)
-// 			{
-// 
-// 				// This is the equation for the normalized sinc function.  Remember that (other than at x=0) it's 
-// 				// returned value crosses the x axis where x equals any integer.
-// 				double sincValue;
-// 				if(xPosition == 0)
-// 				{
-// 					sincValue = 1.0;
-// 				}
-// 				else
-// 				{
-// 					sincValue = (sin(PI * xPosition / SINC_SAMPLES_PER_X_INTEGER) / (PI * xPosition / SINC_SAMPLES_PER_X_INTEGER));
-// 				}
-// 				
-// 				// This is a hamming window.  We apply a hamming window to the sinc filter so that the frequency response of 
-// 				// the filter in the frequency domain is as smooth as possible.  See page 287 of "The Scientisrs and Engineer's 
-// 				// Guide to Digital Signal Processing"(i.e. Figure 16-1)
-// 				double hanningFactor = (0.54 - 0.46 * cos(2.0 * PI * (xPosition + CENTER_OF_SINC_FILTER) / SAMPLES_IN_SINC_FILTER));
-// 
-// 				return sincValue * hanningFactor;
-// 			}
-// 	};
-// 
-// void main()
-// {
-//	SincValue sincV;
-// }
+// This used to be a precalculated table of 9,857 values (224 per zero crossing, 22 zero crossings 
+// per side, hamming window).  The table calculated for those parameters differs from it by no more 
+// than one bit in the last place in a few percent of the values.
 
-const double SINC_VALUES[Signal::SINC_VALUE_SIZE] = {
-5.1059286559943242e-018,
--1.623657146900403e-005,
--3.2476692558989092e-005,
--4.8717284831473526e-005,
--6.4955268439808662e-005,
--8.1187562681522504e-005,
--9.7411086550805334e-005,
--0.00011362275929163097,
--0.00012981950095084692,
--0.0001459982329314864,
--0.00016215587854609415,
--0.00017828936356998961,
--0.00019439561679437814,
--0.00021047157057921278,
--0.00022651416140571804,
--0.00024252033042848322,
--0.00025848702402702793,
--0.00027441119435675612,
--0.0002902897998991963,
--0.00030611980601144263,
--0.00032189818547470307,
--0.00033762191904185941,
--0.00035328799598395241,
--0.00036889341463549387,
--0.00038443518293853409,
--0.00039991031898529918,
--0.00041531585155952112,
--0.00043064882067615453,
--0.00044590627811940357,
--0.00046108528797909399,
--0.0004761829271853088,
--0.00049119628604097439,
--0.00050612246875262148,
--0.00052095859395882263,
--0.00053570179525676352,
--0.00055034922172632762,
--0.00056489803845191774,
--0.00057934542704183385,
--0.00059368858614511171,
--0.00060792473196575431,
--0.00062205109877426154,
--0.00063606493941635795,
--0.00064996352581885811,
--0.00066374414949255274,
--0.00067740412203205118,
--0.00069094077561248463,
--0.00070435146348298287,
--0.00071763356045686231,
--0.00073078446339833614,
--0.00074380159170594486,
--0.00075668238779216595,
--0.00076942431755958453,
--0.00078202487087319732,
--0.00079448156202903116,
--0.00080679193021881296,
--0.00081895353999060267,
--0.00083096398170544349,
--0.00084282087198992058,
--0.00085452185418440736,
--0.0008660645987870791,
--0.00087744680389353815,
--0.00088866619563200049,
--0.00089972052859394868,
--0.00091060758626018874,
--0.00092132518142222497,
--0.00093187115659888525,
--0.00094224338444812313,
--0.00095243976817390721,
--0.00096245824192815017,
--0.00097229677120758357,
--0.00098195335324551794,
--0.00099142601739841485,
--0.0010007128255271973,
--0.0010098118723732335,
--0.0010187212859289398,
--0.0010274392278028573,
--0.0010359638935793045,
--0.0010442935131723546,
--0.0010524263511741464,
--0.0010603607071974826,
--0.001068094916212689,
--0.0010756273488785324,
--0.001082956411867311,
--0.001090080548183849,
--0.0010969982374785961,
--0.0011037079963545355,
--0.0011102083786679589,
--0.0011164979758230436,
--0.0011225754170601468,
--0.0011284393697377807,
--0.0011340885396082091,
--0.0011395216710866109,
--0.0011447375475137573,
--0.00114973499141215,
--0.0011545128647355803,
--0.0011590700691120361,
--0.0011634055460799369,
--0.0011675182773176276,
--0.0011714072848660747,
--0.0011750716313447937,
--0.0011785104201608187,
--0.0011817227957108354,
--0.0011847079435762995,
--0.0011874650907116016,
--0.0011899935056251657,
--0.0011922924985534693,
--0.0011943614216279523,
--0.0011961996690347824,
--0.0011978066771674088,
--0.0011991819247719078,
--0.001200324933085063,
--0.0012012352659651537,
--0.0012019125300154175,
--0.0012023563747001734,
--0.0012025664924535399,
--0.0012025426187807621,
--0.001202284532352092,
--0.0012017920550892,
--0.0012010650522441186,
--0.0012001034324706434,
--0.0011989071478882357,
--0.0011974761941383378,
--0.001195810610433134,
--0.001193910479596719,
--0.0011917759280986357,
--0.0011894071260798189,
--0.0011868042873708546,
--0.0011839676695026289,
--0.0011808975737092749,
--0.0011775943449234636,
--0.0011740583717639796,
--0.0011702900865156309,
--0.0011662899651014064,
--0.0011620585270469973,
--0.0011575963354375095,
--0.0011529039968665193,
--0.0011479821613773857,
--0.0011428315223968376,
--0.0011374528166608329,
--0.0011318468241326969,
--0.0011260143679135465,
--0.0011199563141449825,
--0.0011136735719040856,
--0.0011071670930906902,
--0.0011004378723069729,
--0.0010934869467293465,
--0.0010863153959726696,
--0.0010789243419468001,
--0.0010713149487054791,
--0.0010634884222875873,
--0.0010554460105507654,
--0.0010471890029974216,
--0.0010387187305931876,
--0.0010300365655777309,
--0.0010211439212680505,
--0.0010120422518542784,
--0.0010027330521879495,
--0.00099321785756272918,
--0.00098349824348778502,
--0.00097357582545361493,
--0.00096345225869064427,
--0.0009531292379202326,
--0.00094260849709850629,
--0.00093189180915280825,
--0.00092098098571088505,
--0.00090987787682283408,
--0.00089858437067584116,
--0.00088710239330174866,
--0.00087543390827749109,
--0.00086358091641844544,
--0.00085154545546471975,
--0.0008393295997604467,
--0.0008269354599260984,
--0.00081436518252388658,
--0.0008016209497162778,
--0.00078870497891775219,
--0.00077561952243958981,
--0.00076236686712819,
--0.00074894933399649859,
--0.00073536927784895515,
--0.00072162908689972992,
--0.00070773118238450818,
--0.0006936780181658682,
--0.00067947208033219367,
--0.00066511588679016775,
--0.00065061198685109969,
--0.00063596296081095728,
--0.00062117141952423784,
--0.00060624000397173697,
--0.00059117138482227402,
--0.00057596826198843827,
--0.00056063336417642919,
--0.00054516944843004404,
--0.00052957929966889936,
--0.00051386573022093804,
--0.00049803157934930368,
--0.00048207971277365385,
--0.00046601302218597608,
--0.00044983442476099155,
--0.00043354686266121236,
--0.00041715330253673473,
--0.00040065673501982343,
--0.00038406017421448776,
--0.00036736665718077176,
--0.00035057924341442789,
--0.00033370101432144881,
--0.00031673507268800086,
--0.00029968454214545899,
--0.00028255256663100984,
--0.0002653423098435278,
--0.00024805695469527951,
--0.00023069970275891501,
--0.00021327377371044325,
--0.00019578240476791767,
--0.00017822885012604042,
--0.00016061638038676113,
--0.00014294828198595813,
--0.00012522785661629865,
--0.00010745842064636794,
--8.9643304536163386e-005,
--7.1785852249048031e-005,
--5.3889420660258145e-005,
--3.5957378962063317e-005,
--1.7993108065674893e-005,
--1.259430308216258e-018,
-1.8018542692650681e-005,
-3.6059107563828837e-005,
-5.4118272869043366e-005,
-7.2192608180645483e-005,
-9.0278675003266232e-005,
-0.00010837302739196864,
-0.00012647221257275408,
-0.00014457277156533743,
-0.0001626712398082329,
-0.00018076414778606348,
-0.00019884802165871435,
-0.00021691938389260714,
-0.00023497475389349664,
-0.000253010648641337,
-0.00027102358332647432,
-0.000289010071987436,
-0.00030696662815008326,
-0.00032488976546803588,
-0.00034277599836425631,
-0.00036062184267368315,
-0.00037842381628680846,
-0.00039617843979407688,
-0.00041388223713100859,
-0.00043153173622391926,
-0.00044912346963613581,
-0.00046665397521459195,
-0.00048411979673670269,
-0.00050151748455728898,
-0.00051884359625580163,
-0.0005360946972831199,
-0.00055326736160843924,
-0.00057035817236566111,
-0.00058736372249953864,
-0.00060428061541119619,
-0.00062110546560293516,
-0.00063783489932233838,
-0.00065446555520557912,
-0.00067099408491958239,
-0.00068741715380315224,
-0.00070373144150685763,
-0.00071993364263157216,
-0.00073602046736554816,
-0.00075198864211992178,
-0.00076783491016251318,
-0.00078355603224982751,
-0.00079914878725712208,
-0.00081460997280643458,
-0.00082993640589245276,
-0.00084512492350610714,
-0.00086017238325578169,
-0.00087507566398600594,
-0.00088983166639353844,
-0.00090443731364070272,
-0.00091888955196589149,
-0.00093318535129101928,
-0.00094732170582609721,
-0.00096129563467034051,
-0.00097510418241017775,
-0.00098874441971369235,
-0.001002213443921671,
-0.0010155083796348466,
-0.0010286263792975341,
-0.0010415646237771658,
-0.0010543203229401031,
-0.0010668907162231561,
-0.0010792730732009507,
-0.001091464694148981,
-0.001103462910602206,
-0.0011152650859091091,
-0.0011268686157811111,
-0.0011382709288371982,
-0.0011494694871436975,
-0.0011604617867490624,
-0.0011712453582135727,
-0.0011818177671338427,
-0.0011921766146620162,
-0.001202319538019576,
-0.0012122442110056252,
-0.0012219483444995615,
-0.0012314296869580369,
-0.001240686024906091,
-0.0012497151834223409,
-0.0012585150266182011,
-0.0012670834581109528,
-0.0012754184214905527,
-0.0012835179007801474,
-0.0012913799208902231,
-0.0012990025480661348,
-0.0013063838903291328,
-0.0013135220979105515,
-0.0013204153636793333,
-0.0013270619235625689,
-0.0013334600569590764,
-0.0013396080871459078,
-0.0013455043816776699,
-0.0013511473527786087,
-0.0013565354577273346,
-0.0013616671992341095,
-0.0013665411258106334,
-0.0013711558321322054,
-0.0013755099593922161,
-0.0013796021956488586,
-0.0013834312761639854,
-0.00138699598373405,
-0.0013902951490130044,
-0.0013933276508271628,
-0.0013960924164818313,
-0.0013985884220597546,
-0.0014008146927112102,
-0.0014027703029357368,
-0.0014044543768554007,
-0.0014058660884795162,
-0.0014070046619607788,
-0.0014078693718427434,
-0.001408459543298548,
-0.0014087745523608617,
-0.0014088138261429508,
-0.0014085768430508461,
-0.0014080631329865072,
-0.001407272277541954,
-0.0014062039101843066,
-0.0014048577164316467,
-0.0014032334340196946,
-0.0014013308530592074,
-0.0013991498161840634,
-0.0013966902186899847,
-0.001393952008663845,
-0.0013909351871035181,
-0.0013876398080282194,
-0.0013840659785792897,
-0.0013802138591113961,
-0.0013760836632741187,
-0.0013716756580837957,
-0.0013669901639857623,
-0.0013620275549067451,
-0.001356788258297572,
-0.0013512727551659672,
-0.0013454815800996024,
-0.0013394153212791797,
-0.0013330746204817544,
-0.0013264601730739679,
-0.0013195727279954534,
-0.0013124130877322253,
-0.0013049821082800755,
-0.001297280699097987,
-0.0012893098230515117,
-0.0012810704963460693,
-0.0012725637884502495,
-0.0012637908220090341,
-0.0012547527727468887,
-0.0012454508693608671,
-0.0012358863934035407,
-0.0012260606791559007,
-0.0012159751134901001,
-0.0012056311357221377,
-0.001195030237454459,
-0.0011841739624084491,
-0.00117306390624681,
-0.0011617017163859,
-0.001150089091797985,
-0.0011382277828034261,
-0.001126119590852821,
-0.0011137663682991095,
-0.0011011700181596488,
-0.0010883324938683462,
-0.0010752557990176836,
-0.0010619419870909383,
-0.0010483931611843548,
-0.0010346114737194774,
-0.001020599126145527,
-0.0010063583686320036,
-0.00099189149975138606,
-0.00097720086615215814,
-0.00096228886222193724,
-0.00094715792974098658,
-0.0009318105575260501,
-0.00091624928106444738,
-0.00090047668213871649,
-0.00088449538844159248,
-0.00086830807318156772,
-0.00085191745467889696,
-0.00083532629595230103,
-0.00081853740429620777,
-0.00080155363084884505,
-0.0007843778701509095,
-0.00076701305969517207,
-0.00074946217946691605,
-0.00073172825147530571,
-0.00071381433927576309,
-0.00069572354748339324,
-0.00067745902127753783,
-0.00065902394589757284,
-0.00064042154612988216,
-0.00062165508578622311,
-0.0006027278671735444,
-0.00058364323055524992,
-0.0005644045536039922,
-0.00054501525084619628,
-0.00052547877309821588,
-0.00050579860689445007,
-0.00048597827390716429,
-0.00046602133035842611,
-0.0004459313664241085,
-0.00042571200562996938,
-0.0004053669042400324,
-0.00038489975063736023,
-0.00036431426469722288,
-0.00034361419715275149,
-0.00032280332895333823,
-0.00030188547061564736,
-0.00028086446156764486,
-0.00025974416948534699,
-0.00023852848962278039,
-0.0002172213441350199,
-0.00019582668139456186,
-0.00017434847530090676,
-0.00015279072458384052,
-0.00013115745210013724,
-0.00010945270412409232,
-8.7680549631770355e-005,
-6.5845079579250867e-005,
-4.3950406174980413e-005,
-2.2000662146262692e-005,
--3.8463573494755484e-018,
--2.2047408722072105e-005,
--4.4137374193529353e-005,
--6.626568905895958e-005,
--8.8428129194576804e-005,
--0.00011062045447410491,
--0.00013283840953946856,
--0.00015507772457640432,
--0.00017733411609468486,
--0.00019960328771283979,
--0.00022188093094732363,
--0.00024416272600600528,
--0.0002664443425856903,
--0.00028872144067368518,
--0.00031098967135320579,
--0.00033324467761249282,
--0.00035548209515749501,
--0.0003776975532279922,
--0.00039988667541692423,
--0.00042204508049303109,
--0.00044416838322624988,
--0.00046625219521613851,
--0.00048829212572286602,
--0.00051028378250086764,
--0.00053222277263477739,
--0.00055410470337771526,
--0.00057592518299149915,
--0.00059767982158900478,
--0.00061936423197816071,
--0.00064097403050757747,
--0.00066250483791379028,
--0.00068395228016961867,
--0.00070531198933385087,
--0.00072657960440181547,
--0.00074775077215692438,
--0.00076882114802277583,
--0.00078978639691591225,
--0.00081064219409877469,
--0.00083138422603307226,
--0.00085200819123305068,
--0.00087250980111869985,
--0.00089288478086869071,
--0.0009131288702728537,
--0.0009332378245840773,
--0.00095320741536944454,
--0.00097303343136038642,
--0.00099271167930185182,
--0.0010122379848001568,
--0.0010316081931693877,
--0.0010508181702762603,
--0.0010698638033832682,
--0.00108874100198984,
--0.0011074456986715153,
--0.0011259738499167292,
--0.0011443214369613801,
--0.001162484466620686,
--0.0011804589721183345,
--0.0011982410139127764,
--0.0012158266805204281,
--0.0012332120893356036,
--0.0012503933874470682,
--0.0012673667524511062,
--0.0012841283932607437,
--0.0013006745509111916,
--0.0013170014993611067,
--0.0013331055462897908,
--0.0013489830338898853,
--0.0013646303396555801,
--0.0013800438771660749,
--0.0013952200968642553,
--0.0014101554868302263,
--0.0014248465735497424,
--0.001439289922677214,
--0.0014534821397932853,
--0.0014674198711566748,
--0.0014810998044501901,
--0.0014945186695207605,
--0.0015076732391133484,
--0.0015205603295985273,
--0.001533176801693561,
--0.0015455195611769857,
--0.0015575855595962708,
--0.001569371794968654,
--0.0015808753124748603,
--0.0015920932051455999,
--0.0016030226145407008,
--0.00161366073142065,
--0.0016240047964104984,
--0.001634052100655961,
--0.0016437999864714621,
--0.0016532458479801295,
--0.0016623871317454672,
--0.0016712213373946514,
--0.001679746018233253,
--0.0016879587818512565,
--0.0016958572907202522,
--0.0017034392627816664,
--0.0017107024720258402,
--0.0017176447490618843,
--0.0017242639816781287,
--0.0017305581153930953,
--0.0017365251539967518,
--0.0017421631600820532,
--0.0017474702555665056,
--0.0017524446222037444,
--0.0017570845020849217,
--0.0017613881981297912,
--0.0017653540745674239,
--0.0017689805574063306,
--0.0017722661348939831,
--0.0017752093579655182,
--0.0017778088406815867,
--0.0017800632606551918,
--0.0017819713594673899,
--0.0017835319430717894,
--0.0017847438821877043,
--0.0017856061126818544,
--0.0017861176359385389,
--0.0017862775192181268,
--0.0017860848960038222,
--0.0017855389663365632,
--0.0017846389971379537,
--0.0017833843225211826,
--0.0017817743440897648,
--0.0017798085312240783,
--0.00177748642135557,
--0.0017748076202285371,
--0.0017717718021494422,
--0.0017683787102236244,
--0.001764628156579362,
--0.0017605200225792139,
--0.0017560542590185158,
--0.0017512308863110125,
--0.0017460499946615261,
--0.0017405117442255791,
--0.0017346163652559329,
--0.0017283641582359767,
--0.0017217554939998839,
--0.0017147908138394428,
--0.001707470629597618,
--0.0016997955237486458,
--0.0016917661494647298,
--0.0016833832306691978,
--0.001674647562076117,
--0.0016655600092163275,
--0.0016561215084498397,
--0.0016463330669644837,
--0.0016361957627609616,
--0.0016257107446240246,
--0.0016148792320799686,
--0.0016037025153401992,
--0.0015921819552310668,
--0.0015803189831097146,
--0.0015681151007661755,
--0.0015555718803114016,
--0.0015426909640514519,
--0.001529474064347765,
--0.0015159229634633263,
--0.0015020395133950577,
--0.0014878256356920915,
--0.0014732833212601441,
--0.0014584146301518486,
--0.0014432216913431589,
--0.0014277067024957301,
--0.0014118719297054336,
--0.0013957197072367524,
--0.0013792524372433729,
--0.0013624725894747646,
--0.0013453827009688908,
--0.0013279853757309896,
--0.0013102832843985086,
--0.0012922791638921845,
--0.0012739758170533389,
--0.0012553761122673264,
--0.0012364829830732579,
--0.0012172994277600711,
--0.001197828508948881,
--0.001178073353161641,
--0.0011580371503763435,
--0.0011377231535685405,
--0.0011171346782395805,
--0.0010962751019311704,
--0.001075147863726733,
--0.0010537564637394352,
--0.0010321044625868612,
--0.0010101954808525743,
--0.00098803319853458019,
--0.00096562135448070993,
--0.00094296374581096497,
--0.00092006422732706663,
--0.00089692671090906841,
--0.00087355516489940471,
--0.00084995361347404682,
--0.00082612613600126889,
--0.00080207686638784784,
--0.00077780999241296265,
--0.0007533297550496006,
--0.00072864044777403846,
--0.00070374641586300592,
--0.00067865205567900402,
--0.00065336181394361128,
--0.00062788018699906363,
--0.00060221172005822774,
--0.00057636100644296352,
--0.00055033268681097599,
--0.00052413144837146143,
--0.00049776202408956,
--0.00047122919187954972,
--0.00044453777378735564,
--0.00041769263516202405,
--0.00039069868381665974,
--0.00036356086917866266,
--0.00033628418142962264,
--0.00030887365063498272,
--0.00028133434586350711,
--0.00025367137429668795,
--0.00022588988032842103,
--0.00019799504465491398,
--0.00016999208335505338,
--0.00014188624696137629,
--0.00011368281952179527,
--8.5387117652223034e-005,
--5.700448958035948e-005,
--2.8540314180494806e-005,
--2.4978016311763453e-018,
-2.8611015722833745e-005,
-5.7287268049099487e-005,
-8.6023265337783916e-005,
-0.00011481349025207707,
-0.00014365240077357481,
-0.00017253443122382334,
-0.00020145399329354476,
-0.00023040547707887387,
-0.00025938325212462057,
-0.00028838166847458422,
-0.00031739505772823229,
-0.00034641773410408119,
-0.00037544399550920024,
-0.00040446812461495779,
-0.00043348438993850795,
-0.00046248704693012768,
-0.00049147033906583035,
-0.00052042849894556832,
-0.00054935574939631862,
-0.00057824630458016158,
-0.0006070943711070319,
-0.00063589414915197345,
-0.00066463983357666837,
-0.00069332561505506022,
-0.00072194568120277885,
-0.00075049421771033954,
-0.00077896540947972818,
-0.00080735344176414666,
-0.00083565250131084309,
-0.00086385677750680837,
-0.00089196046352691099,
-0.00091995775748455913,
-0.00094784286358428065,
-0.00097560999327649903,
-0.0010032533664138395,
-0.0010307672124089035,
-0.001058145771393436,
-0.0010853832953784345,
-0.0011124740494150359,
-0.0011394123127560182,
-0.001166192380017737,
-0.0011928085623420599,
-0.00121925518855833,
-0.0012455266063448106,
-0.0012716171833898194,
-0.0012975213085518796,
-0.0013232333930189545,
-0.0013487478714663253,
-0.0013740592032131962,
-0.0013991618733773217,
-0.0014240503940278898,
-0.0014487193053360965,
-0.0014731631767234412,
-0.0014973766080072879,
-0.001521354230543541,
-0.0015450907083662266,
-0.0015685807393238198,
-0.0015918190562118687,
-0.00161480042790184,
-0.0016375196604660348,
-0.0016599715982980499,
-0.0016821511252288804,
-0.0017040531656381595,
-0.001725672685560567,
-0.0017470046937869302,
-0.0017680442429598843,
-0.0017887864306639,
-0.0018092264005094472,
-0.0018293593432109579,
-0.001849180497658463,
-0.0018686851519826486,
-0.001887868644613088,
-0.0019067263653294148,
-0.0019252537563052663,
-0.0019434463131446404,
-0.0019612995859106916,
-0.0019788091801463707,
-0.0019959707578870657,
-0.0020127800386647394,
-0.0020292328005035226,
-0.0020453248809064249,
-0.0020610521778330212,
-0.002076410650667793,
-0.0020913963211790947,
-0.002106005274468302,
-0.0021202336599090818,
-0.0021340776920765608,
-0.0021475336516660706,
-0.0021605978864013935,
-0.0021732668119321904,
-0.0021855369127205346,
-0.002197404742916157,
-0.0022088669272204175,
-0.0022199201617385698,
-0.0022305612148203432,
-0.002240786927888479,
-0.0022505942162550896,
-0.002259980069925649,
-0.002268941554390403,
-0.0022774758114029923,
-0.0022855800597461665,
-0.0022932515959842919,
-0.002300487795202606,
-0.0023072861117328842,
-0.0023136440798654668,
-0.0023195593145473796,
-0.0023250295120664168,
-0.0023300524507210169,
-0.0023346259914757074,
-0.0023387480786020063,
-0.0023424167403045888,
-0.0023456300893325401,
-0.0023483863235755583,
-0.0023506837266449349,
-0.0023525206684391594,
-0.0023538956056939784,
-0.002354807082516766,
-0.0023552537309050854,
-0.0023552342712492278,
-0.002354747512818662,
-0.0023537923542322004,
-0.002352367783911733,
-0.0023504728805194795,
-0.0023481068133784995,
-0.0023452688428764572,
-0.0023419583208523914,
-0.0023381746909665086,
-0.0023339174890527302,
-0.0023291863434539845,
-0.0023239809753400845,
-0.0023183011990080549,
-0.0023121469221648993,
-0.0023055181461925844,
-0.0022984149663951743,
-0.0022908375722280874,
-0.0022827862475092958,
-0.0022742613706123647,
-0.0022652634146413846,
-0.0022557929475874937,
-0.0022458506324671344,
-0.0022354372274417476,
-0.002224553585919008,
-0.0022132006566354633,
-0.0022013794837204732,
-0.0021890912067414211,
-0.0021763370607301284,
-0.0021631183761904619,
-0.0021494365790869648,
-0.0021352931908145936,
-0.0021206898281494317,
-0.0021056282031803328,
-0.0020901101232215758,
-0.0020741374907062185,
-0.0020577123030605282,
-0.0020408366525590553,
-0.0020235127261606163,
-0.0020057428053249652,
-0.001987529265810297,
-0.0019688745774514359,
-0.0019497813039188793,
-0.0019302521024583987,
-0.0019102897236115163,
-0.0018898970109166963,
-0.0018690769005911491,
-0.0018478324211935934,
-0.001826166693267598,
-0.0018040829289658587,
-0.0017815844316551132,
-0.0017586745955020544,
-0.001735356905039931,
-0.001711634934716283,
-0.0016875123484213139,
-0.0016629928989974529,
-0.0016380804277298538,
-0.0016127788638179547,
-0.0015870922238281826,
-0.0015610246111278133,
-0.0015345802153000599,
-0.0015077633115405458,
-0.001480578260034995,
-0.0014530295053184674,
-0.0014251215756161467,
-0.0013968590821656767,
-0.0013682467185211192,
-0.0013392892598388187,
-0.0013099915621449776,
-0.0012803585615854291,
-0.0012503952736571606,
-0.0012201067924222332,
-0.0011894982897039377,
-0.001158575014265232,
-0.0011273422909697272,
-0.0010958055199253866,
-0.0010639701756108859,
-0.0010318418059847506,
-0.00099942603157768023,
-0.0009667285445678005,
-0.00093375510783947051,
-0.00090051155402515789,
-0.00086700378453111919,
-0.00083323776854668757,
-0.00079921954203752271,
-0.00076495520672263044,
-0.00073045092903590073,
-0.00069571293907170443,
-0.00066074752951520723,
-0.00062556105455716419,
-0.000590159928793672,
-0.00055455062611102328,
-0.00051873967855569519,
-0.00048273367518965554,
-0.00044653926093139073,
-0.00041016313538274333,
-0.00037361205164145234,
-0.00033689281510024824,
-0.00030001228223201749,
-0.00026297735936175358,
-0.00022579500142511322,
-0.00018847221071405969,
-0.00015101603560980083,
-0.00011343356930308529,
-7.5731948502053142e-005,
-3.7918352128140955e-005,
--5.9676426423826825e-018,
--3.8015848494264474e-005,
--7.6121895736196125e-005,
--0.00011431080722740326,
--0.00015257521295086084,
--0.00019090770874284355,
--0.00022930085767561403,
--0.00026774719144994193,
--0.00030623921179790488,
--0.00034476939189519504,
--0.00038333017778309459,
--0.00042191398979945138,
--0.00046051322401879696,
--0.00049912025370084736,
--0.0005377274307477955,
--0.00057632708716947635,
--0.00061491153655641691,
--0.00065347307556074268,
--0.0006920039853840407,
--0.00073049653327256193,
--0.00076894297401899577,
--0.00080733555147093625,
--0.0008456665000453361,
--0.00088392804624909849,
--0.00092211241020498467,
--0.00096021180718324059,
--0.000998218449137998,
--0.0010361245462485243,
--0.0010739223084649345,
--0.0011116039470580423,
--0.0011491616761730957,
--0.001186587714387076,
--0.0012238742862691763,
--0.0012610136239444062,
--0.0012979979686597383,
--0.0013348195723525596,
--0.0013714706992212083,
--0.0014079436272973393,
--0.0014442306500195466,
--0.0014803240778082623,
--0.0015162162396412042,
--0.0015518994846296338,
--0.001587366183594548,
--0.0016226087306427531,
--0.0016576195447426049,
--0.001692391071298899,
--0.0017269157837265855,
--0.0017611861850231462,
--0.0017951948093393353,
--0.0018289342235476836,
--0.0018623970288088397,
--0.0018955758621349336,
--0.0019284633979502889,
--0.0019610523496485406,
--0.0019933354711462103,
--0.0020253055584322261,
--0.002056955451113359,
--0.0020882780339547607,
--0.00211926623841579,
--0.0021499130441804274,
--0.0021802114806822809,
--0.0022101546286235852,
--0.0022397356214879679,
--0.0022689476470467186,
--0.0022977839488582579,
--0.0023262378277603673,
--0.0023543026433548624,
--0.0023819718154846803,
--0.0024092388257025777,
--0.0024360972187315606,
--0.0024625406039164668,
--0.0024885626566665555,
--0.0025141571198886905,
--0.0025393178054107404,
--0.0025640385953950603,
--0.0025883134437416819,
--0.0026121363774807707,
--0.0026355014981542446,
--0.0026584029831860949,
--0.0026808350872411842,
--0.0027027921435722113,
--0.0027242685653544882,
--0.0027452588470082777,
--0.0027657575655084476,
--0.0027857593816809629,
--0.0028052590414861457,
--0.0028242513772882001,
--0.0028427313091109493,
--0.0028606938458792105,
--0.0028781340866458204,
--0.0028950472218036904,
--0.0029114285342829991,
--0.0029272734007329158,
--0.0029425772926876797,
--0.0029573357777169166,
--0.0029715445205595972,
--0.0029851992842417139,
--0.0029982959311771365,
--0.0030108304242515531,
--0.0030227988278891528,
--0.003034197309101806,
--0.0030450221385204717,
--0.0030552696914086337,
--0.0030649364486574578,
--0.0030740189977624113,
--0.0030825140337811686,
--0.0030904183602725082,
--0.0030977288902159571,
--0.0031044426469119713,
--0.0031105567648624364,
--0.0031160684906311863,
--0.0031209751836844242,
--0.0031252743172107155,
--0.0031289634789203849,
--0.0031320403718241405,
--0.0031345028149906227,
--0.0031363487442827441,
--0.0031375762130725873,
--0.003138183392934684,
--0.0031381685743174215,
--0.0031375301671924425,
--0.0031362667016818506,
--0.0031343768286629585,
--0.0031318593203505285,
--0.0031287130708562106,
--0.0031249370967250298,
--0.0031205305374488465,
--0.0031154926559564624,
--0.0031098228390803997,
--0.0031035205980000369,
--0.0030965855686610148,
--0.0030890175121708148,
--0.0030808163151702841,
--0.0030719819901809794,
--0.0030625146759282931,
--0.0030524146376400703,
--0.0030416822673207961,
--0.0030303180840009769,
--0.0030183227339618591,
--0.0030056969909352123,
--0.0029924417562781397,
--0.0029785580591227545,
--0.0029640470565006748,
--0.0029489100334423222,
--0.0029331484030506554,
--0.0029167637065496848,
--0.002899757613307288,
--0.0028821319208325235,
--0.0028638885547472119,
--0.0028450295687317906,
--0.002825557144445481,
--0.0028054735914205199,
--0.0027847813469305,
--0.0027634829758328696,
--0.0027415811703853897,
--0.0027190787500366571,
--0.0026959786611905727,
--0.0026722839769447696,
--0.0026479978968030073,
--0.0026231237463615396,
--0.0025976649769692394,
--0.0025716251653618944,
--0.0025450080132702565,
--0.0025178173470021487,
--0.0024900571169983979,
--0.0024617313973629186,
--0.0024328443853665993,
--0.0024034004009255258,
--0.002373403886052932,
--0.0023428594042854923,
--0.0023117716400838139,
--0.0022801453982068715,
--0.0022479856030610916,
--0.0022152972980234889,
--0.0021820856447393984,
--0.0021483559223945143,
--0.0021141135269616773,
--0.0020793639704221236,
--0.002044112879961753,
--0.0020083659971418611,
--0.0019721291770451173,
--0.001935408387396427,
--0.0018982097076590155,
--0.0018605393281057381,
--0.0018224035488658235,
--0.0017838087789470935,
--0.001744761535233944,
--0.0017052684414609394,
--0.0016653362271624433,
--0.0016249717265984192,
--0.0015841818776563829,
--0.0015429737207296389,
--0.0015013543975722697,
--0.0014593311501308547,
--0.0014169113193528088,
--0.0013741023439722334,
--0.0013309117592726792,
--0.0012873471958276372,
--0.0012434163782184303,
--0.0011991271237300882,
--0.0011544873410253766,
--0.0011095050287969871,
--0.0010641882743981181,
--0.0010185452524519418,
--0.00097258422343990977,
--0.00092631353226921233,
--0.0008797416068196559,
--0.00083287695647015034,
--0.00078572817060505349,
--0.00073830391710079076,
--0.00069061294079247252,
--0.00064266406192164157,
--0.00059446617456452547,
--0.00054602824504171278,
--0.00049735931030900446,
--0.00044846847633023268,
--0.00039936491643180895,
--0.0003500578696399368,
--0.00030055663899989017,
--0.00025087058987850112,
--0.0002010091482497964,
--0.00015098179896374123,
--0.00010079808399924414,
--5.0467600700830633e-005,
-2.0301902222768197e-017,
-5.0595015379119649e-005,
-0.00010130769272850601,
-0.00015212823118031634,
-0.00020304678354456844,
-0.00025405345816144538,
-0.00030513832076684483,
-0.00035629139637139914,
-0.00040750267115243031,
-0.00045876209435853366,
-0.0005100595802264217,
-0.000561385009909717,
-0.00061272823341917125,
-0.00066407907157430717,
-0.00071542731796577603,
-0.00076676274092806775,
-0.00081807508552241904,
-0.00086935407552958435,
-0.00092058941545167803,
-0.00097177079252328035,
-0.0010228878787307135,
-0.0010739303328400245,
-0.0011248878024324334,
-0.0011757499259472226,
-0.0012265063347318725,
-0.0012771466550986856,
-0.0013276605103875764,
-0.0013780375230347827,
-0.0014282673166471445,
-0.0014783395180811784,
-0.0015282437595270386,
-0.0015779696805963217,
-0.0016275069304141684,
-0.001676845169714384,
-0.0017259740729377454,
-0.0017748833303326877,
-0.0018235626500585269,
-0.0018720017602899262,
-0.0019201904113230622,
-0.0019681183776824544,
-0.0020157754602284699,
-0.0020631514882647954,
-0.0021102363216454322,
-0.0021570198528809738,
-0.0022034920092438171,
-0.0022496427548714909,
-0.0022954620928679276,
-0.0023409400674025134,
-0.0023860667658057869,
-0.002430832320662104,
-0.0024752269118982696,
-0.0025192407688681916,
-0.0025628641724327211,
-0.0026060874570343817,
-0.0026489010127666228,
-0.0026912952874372405,
-0.0027332607886252618,
-0.0027747880857310809,
-0.0028158678120193638,
-0.0028564906666543027,
-0.0028966474167267152,
-0.0029363288992727116,
-0.0029755260232832243,
-0.0030142297717044957,
-0.0030524312034283531,
-0.0030901214552725379,
-0.0031272917439502225,
-0.003163933368028581,
-0.0032000377098757218,
-0.0032355962375958231,
-0.0032706005069517083,
-0.0033050421632749715,
-0.003338912943362657,
-0.0033722046773604149,
-0.003404909290631788,
-0.0034370188056128412,
-0.0034685253436521476,
-0.0034994211268353833,
-0.0035296984797944797,
-0.0035593498315004911,
-0.00358836771704025,
-0.0036167447793758758,
-0.0036444737710873642,
-0.0036715475560973156,
-0.0036979591113776825,
-0.0037237015286381301,
-0.0037487680159955612,
-0.003773151899624419,
-0.00379684662538751,
-0.0038198457604467139,
-0.0038421429948535739,
-0.0038637321431190348,
-0.0038846071457621632,
-0.0039047620708374088,
-0.0039241911154401562,
-0.0039428886071900555,
-0.0039608490056918704,
-0.0039780669039734262,
-0.0039945370299004669,
-0.0040102542475678373,
-0.0040252135586668738,
-0.0040394101038285207,
-0.0040528391639419598,
-0.0040654961614482767,
-0.0040773766616089661,
-0.0040884763737489473,
-0.0040987911524737047,
-0.0041083169988603181,
-0.0041170500616219911,
-0.0041249866382458769,
-0.0041321231761038612,
-0.0041384562735359582,
-0.0041439826809061544,
-0.0041486993016302673,
-0.0041526031931756963,
-0.0041556915680326725,
-0.0041579617946567926,
-0.0041594113983825917,
-0.0041600380623078529,
-0.0041598396281484588,
-0.0041588140970634868,
-0.0041569596304502935,
-0.0041542745507094784,
-0.0041507573419793196,
-0.0041464066508395906,
-0.0041412212869845018,
-0.0041352002238644941,
-0.0041283425992968371,
-0.0041206477160445881,
-0.0041121150423639504,
-0.0041027442125197494,
-0.0040925350272687875,
-0.0040814874543109855,
-0.0040696016287080803,
-0.0040568778532698059,
-0.0040433165989072406,
-0.0040289185049533485,
-0.004013684379450439,
-0.003997615199404423,
-0.0039807121110058772,
-0.0039629764298174438,
-0.0039444096409279273,
-0.0039250133990725551,
-0.0039047895287195201,
-0.0038837400241225964,
-0.0038618670493398215,
-0.0038391729382180593,
-0.0038156601943435718,
-0.0037913314909581138,
-0.0037661896708409601,
-0.003740237746156538,
-0.0037134788982675147,
-0.0036859164775136523,
-0.0036575540029560212,
-0.0036283951620867841,
-0.0035984438105042937,
-0.0035677039715538124,
-0.0035361798359334058,
-0.0035038757612655936,
-0.0034707962716340299,
-0.003436946057085841,
-0.0034023299730993654,
-0.003366953040017294,
-0.0033308204424453499,
-0.0032939375286164733,
-0.0032563098097205365,
-0.0032179429591998121,
-0.0031788428120099084,
-0.0031390153638465616,
-0.0030984667703383107,
-0.0030572033462049745,
-0.0030152315643820296,
-0.0029725580551112243,
-0.00292918960499717,
-0.0028851331560305342,
-0.0028403958045771682,
-0.0027949848003341053,
-0.0027489075452521239,
-0.0027021715924249422,
-0.0026547846449454186,
-0.0026067545547289448,
-0.0025580893213039448,
-0.0025087970905696296,
-0.0024588861535216034,
-0.0024083649449448642,
-0.0023572420420751995,
-0.002305526163228132,
-0.0022532261663965728,
-0.0022003510478168344,
-0.0021469099405035208,
-0.0020929121127529781,
-0.0020383669666164755,
-0.0019832840363423103,
-0.0019276729867879205,
-0.001871543611801548,
-0.0018149058325742306,
-0.0017577696959622888,
-0.0017001453727803688,
-0.0016420431560652945,
-0.0015834734593113495,
-0.0015244468146771259,
-0.0014649738711637222,
-0.0014050653927656592,
-0.0013447322565937139,
-0.0012839854509707851,
-0.0012228360735005042,
-0.0011612953291093285,
-0.0010993745280624692,
-0.0010370850839536996,
-0.00097443851166936388,
-0.00091144642532739906,
-0.00084812053619123687,
-0.00078447265055918956,
-0.00072051466762959983,
-0.00065625857734217012,
-0.00059171645819579342,
-0.00052690047504349647,
-0.00046182287686421115,
-0.00039649599451290022,
-0.00033093223844826161,
-0.00026514409643931241,
-0.00019914413125051613,
-0.00013294497830662098,
-6.6559343336879351e-005,
--9.3105749671934523e-018,
--6.6720212511018207e-005,
--0.00013358839188239209,
--0.00020059157511175706,
--0.00026771674095876801,
--0.00033495081241269651,
--0.0004022806591777183,
--0.00046969310017452783,
--0.00053717490605856765,
--0.0006047128017536436,
--0.0006722934690012195,
--0.00073990354892397928,
--0.00080752964460440715,
--0.00087515832367671261,
--0.00094277612093232079,
--0.0010103695409382021,
--0.0010779250606675714,
--0.0011454291321424562,
--0.0012128681850876817,
--0.0012802286295955291,
--0.0013474968588010696,
--0.0014146592515671382,
--0.0014817021751785198,
--0.0015486119880450506,
--0.0016153750424131596,
--0.0016819776870848318,
--0.0017484062701441465,
--0.0018146471416899859,
--0.0018806866565755358,
--0.001946511177152942,
--0.0020121070760230966,
--0.0020774607387901772,
--0.0021425585668200485,
--0.0022073869800019502,
--0.0022719324195132106,
--0.0023361813505864823,
--0.0024001202652784125,
--0.0024637356852399237,
--0.0025270141644866771,
--0.0025899422921702529,
--0.002652506695348473,
--0.0027146940417548961,
--0.0027764910425666007,
--0.002837884455170248,
--0.0028988610859249182,
--0.002959407792922141,
--0.0030195114887418143,
--0.0030791591432040555,
--0.0031383377861159373,
--0.0031970345100126351,
--0.003255236472892636,
--0.0033129309009464025,
--0.0033701050912776777,
--0.0034267464146169424,
--0.0034828423180269805,
--0.0035383803275989625,
--0.0035933480511395098,
--0.0036477331808474813,
--0.0037015234959803722,
--0.0037547068655095031,
--0.0038072712507633225,
--0.0038592047080586037,
--0.0039104953913189199,
--0.0039611315546794635,
--0.004011101555078121,
--0.0040603938548319316,
--0.0041089970241985803,
--0.0041568997439222271,
--0.0042040908077632024,
--0.004250559125010908,
--0.00429629372297974,
--0.0043412837494868428,
--0.0043855184753118035,
--0.0044289872966372908,
--0.0044716797374705066,
--0.0045135854520444198,
--0.0045546942271988012,
--0.0045949959847399156,
--0.0046344807837790389,
--0.004673138823048725,
--0.0047109604431964233,
--0.0047479361290553405,
--0.0047840565118912638,
--0.0048193123716256453,
--0.0048536946390337994,
--0.004887194397918228,
--0.0049198028872561575,
--0.0049515115033210641,
--0.0049823118017774896,
--0.0050121954997489736,
--0.0050411544778582234,
--0.0050691807822394064,
--0.0050962666265218079,
--0.0051224043937846252,
--0.0051475866384822601,
--0.0051718060883397289,
--0.0051950556462177127,
--0.0052173283919468719,
--0.0052386175841309104,
--0.0052589166619178961,
--0.0052782192467395097,
--0.005296519144017884,
--0.0053138103448392843,
--0.0053300870275946521,
--0.0053453435595861264,
--0.0053595744985996405,
--0.0053727745944427818,
--0.0053849387904477105,
--0.0053960622249387977,
--0.0054061402326644765,
--0.0054151683461930149,
--0.0054231422972718154,
--0.0054300580181498746,
--0.0054359116428631385,
--0.005440699508482214,
--0.0054444181563223434,
--0.0054470643331150977,
--0.005448634992141565,
--0.0054491272943267503,
--0.0054485386092947606,
--0.0054468665163845548,
--0.0054441088056259978,
--0.0054402634786757595,
--0.0054353287497130431,
--0.0054293030462945497,
--0.0054221850101687135,
--0.0054139734980487332,
--0.0054046675823443014,
--0.0053942665518516286,
--0.0053827699124016394,
--0.0053701773874661905,
--0.0053564889187217588,
--0.0053417046665708619,
--0.0053258250106206079,
--0.0053088505501183731,
--0.0052907821043443864,
--0.0052716207129609406,
--0.0052513676363183373,
--0.0052300243557170858,
--0.0052075925736262641,
--0.0051840742138581529,
--0.0051594714216986462,
--0.0051337865639936075,
--0.0051070222291908132,
--0.0050791812273375614,
--0.0050502665900337409,
--0.005020281570340325,
--0.0049892296426430234,
--0.0049571145024713921,
--0.0049239400662729228,
--0.0048897104711423866,
--0.0048544300745060123,
--0.0048181034537609479,
--0.0047807354058694044,
--0.0047423309469081789,
--0.0047028953115726231,
--0.0046624339526359004,
--0.0046209525403631954,
--0.0045784569618805195,
--0.0045349533204990253,
--0.0044904479349939129,
--0.0044449473388386623,
--0.004398458279394152,
--0.0043509877170531371,
--0.0043025428243397678,
--0.0042531309849647807,
--0.0042027597928355779,
--0.004151437051022222,
--0.0040991707706788515,
--0.0040459691699208725,
--0.0039918406726579337,
--0.0039367939073829605,
--0.003880837705917206,
--0.0038239811021117498,
--0.0037662333305051856,
--0.0037076038249379958,
--0.003648102217123902,
--0.003587738335178013,
--0.0035265222021019977,
--0.0034644640342269464,
--0.0034015742396134919,
--0.0033378634164102018,
--0.0032733423511694558,
--0.0032080220171219736,
--0.0031419135724099516,
--0.0030750283582786473,
--0.0030073778972272694,
--0.002938973891119326,
--0.0028698282192524678,
--0.0027999529363881346,
--0.0027293602707417312,
--0.0026580626219330126,
--0.0025860725588979223,
--0.0025134028177608708,
--0.0024400662996691661,
--0.0023660760685890203,
--0.0022914453490641409,
--0.0022161875239362985,
--0.0021403161320297077,
--0.0020638448657981346,
--0.0019867875689361923,
--0.0019091582339544359,
--0.0018309709997191761,
--0.0017522401489574791,
--0.001672980105727381,
--0.0015932054328537497,
--0.0015129308293307467,
--0.0014321711276910338,
--0.0013509412913416021,
--0.0012692564118680428,
--0.0011871317063062638,
--0.0011045825143832589,
--0.0010216242957265015,
--0.00093827262704312964,
--0.00085454319926933045,
--0.00077045181469014414,
--0.00068601438403010522,
--0.00060124692351587775,
--0.00051616555191079643,
--0.00043078648752209805,
--0.0003451260451813591,
--0.00025920063319867016,
--0.0001730267502910639,
--8.6620982486066483e-005,
--1.0609254296283521e-017,
-8.6819445906775801e-005,
-0.0001738205260989093,
-0.00026098633675724616,
-0.00034829990259291224,
-0.00043574418008249943,
-0.00052330206072480107,
-0.00061095637431727939,
-0.00069868989225324509,
-0.00078648533083763362,
-0.00087432535462135866,
-0.00096219257975425096,
-0.0010500695773544252,
-0.0011379388768950449,
-0.0012257829696066382,
-0.001313584311895282,
-0.0014013253287750488,
-0.001488988417315008,
-0.0015765559500989486,
-0.0016640102786987228,
-0.0017513337371590104,
-0.0018385086454937674,
-0.0019255173131933305,
-0.0020123420427415988,
-0.0020989651331425577,
-0.0021853688834555063,
-0.0022715355963380838,
-0.0023574475815969285,
-0.0024430871597447279,
-0.0025284366655629904,
-0.002613478451670139,
-0.0026981948920943286,
-0.002782568385849562,
-0.0028665813605153667,
-0.0029502162758181004,
-0.0030334556272147502,
-0.003116281949477032,
-0.0031986778202757198,
-0.0032806258637647925,
-0.0033621087541640779,
-0.0034431092193397956,
-0.0035236100443825375,
-0.003603594075182002,
-0.0036830442219972404,
-0.0037619434630221794,
-0.0038402748479455218,
-0.0039180215015042832,
-0.0039951666270302347,
-0.0040716935099886385,
-0.0041475855215081471,
-0.0042228261219020707,
-0.0042973988641788509,
-0.0043712873975424327,
-0.004444475470880802,
-0.0045169469362426789,
-0.004588685752300997,
-0.0046596759878030428,
-0.0047299018250057867,
-0.0047993475630967418,
-0.0048679976215985615,
-0.004935836543757172,
-0.0050028489999130264,
-0.00506901979085386,
-0.0051343338511491794,
-0.0051987762524651022,
-0.0052623322068594252,
-0.0053249870700554933,
-0.005386726344694984,
-0.0054475356835679382,
-0.0055074008928204694,
-0.0055663079351384983,
-0.0056242429329072512,
-0.0056811921713458445,
-0.0057371421016161371,
-0.005792079343905205,
-0.0058459906904808666,
-0.005898863108719306,
-0.0059506837441046113,
-0.0060014399231990154,
-0.0060511191565834821,
-0.0060997091417679056,
-0.0061471977660704086,
-0.0061935731094648373,
-0.0062388234473960422,
-0.0062829372535619975,
-0.0063259032026626713,
-0.006367710173114393,
-0.0064083472497294741,
-0.0064478037263604555,
-0.0064860691085082628,
-0.006523133115893566,
-0.0065589856849909639,
-0.0065936169715254426,
-0.0066270173529301346,
-0.0066591774307653128,
-0.006690088033097512,
-0.0067197402168387415,
-0.0067481252700448673,
-0.006775234714172686,
-0.0068010603062951995,
-0.0068255940412746364,
-0.0068488281538924304,
-0.0068707551209358812,
-0.0068913676632408136,
-0.0069106587476899448,
-0.006928621589166151,
-0.0069452496524604109,
-0.0069605366541337903,
-0.0069744765643330632,
-0.0069870636085595031,
-0.0069982922693902693,
-0.0070081572881521498,
-0.0070166536665470331,
-0.0070237766682287065,
-0.0070295218203306978,
-0.0070338849149445158,
-0.0070368620105481202,
-0.007038449433384034,
-0.0070386437787867944,
-0.0070374419124594181,
-0.0070348409716983525,
-0.0070308383665667632,
-0.0070254317810155842,
-0.0070186191739521836,
-0.0070103987802562339,
-0.0070007691117423684,
-0.0069897289580696043,
-0.0069772773875967659,
-0.0069634137481841916,
-0.006948137667940924,
-0.0069314490559174487,
-0.0069133481027435616,
-0.0068938352812111751,
-0.006872911346801811,
-0.0068505773381586366,
-0.0068268345775025739,
-0.0068016846709926292,
-0.0067751295090300052,
-0.006747171266505759,
-0.006717812402992197,
-0.0066870556628773363,
-0.0066549040754428045,
-0.0066213609548844672,
-0.0065864299002762906,
-0.006550114795476656,
-0.0065124198089778025,
-0.0064733493936973505,
-0.006432908286712705,
-0.0063911015089377649,
-0.0063479343647419749,
-0.0063034124415117772,
-0.0062575416091543079,
-0.0062103280195433073,
-0.0061617781059074821,
-0.0061118985821607989,
-0.00606069644217522,
-0.0060081789589957867,
-0.0059543536839979077,
-0.0058992284459868805,
-0.0058428113502400686,
-0.0057851107774912645,
-0.0057261353828580702,
-0.0056658940947112808,
-0.0056043961134875225,
-0.0055416509104446315,
-0.0054776682263598551,
-0.0054124580701712353,
-0.005346030717562505,
-0.0052783967094912239,
-0.0052095668506603457,
-0.0051395522079339725,
-0.005068364108696659,
-0.0049960141391575518,
-0.0049225141425981609,
-0.0048478762175653452,
-0.0047721127160089806,
-0.0046952362413649777,
-0.0046172596465831805,
-0.0045381960321017253,
-0.0044580587437667313,
-0.0043768613706987808,
-0.0042946177431055065,
-0.004211341930041356,
-0.0041270482371147978,
-0.0040417512041429019,
-0.0039554656027537402,
-0.0038682064339373959,
-0.0037799889255458029,
-0.0036908285297409861,
-0.0036007409203937918,
-0.003509741990431749,
-0.0034178478491378107,
-0.0033250748193994228,
-0.0032314394349090203,
-0.0031369584373164357,
-0.0030416487733332664,
-0.0029455275917896076,
-0.0028486122406443846,
-0.0027509202639490241,
-0.0026524693987653464,
-0.0025532775720380867,
-0.0024533628974226004,
-0.0023527436720682678,
-0.0022514383733584537,
-0.0021494656556065627,
-0.0020468443467105066,
-0.001943593444764359,
-0.0018397321146291592,
-0.0017352796844623021,
-0.0016302556422073283,
-0.0015246796320435071,
-0.0014185714507973491,
-0.0013119510443146928,
-0.0012048385037958769,
-0.0010972540620939044,
-0.00098921808997546289,
-0.00088075109234737805,
-0.00077187370444716929,
-0.00066260668799991089,
-0.00055297092734086942,
-0.00044298742550583867,
-0.0003326773002886811,
-0.00022206178026828763,
-0.00011116220080368507,
--1.3604384402114805e-017,
--0.00011140328535524955,
--0.00022302602388409804,
--0.00033484649373808636,
--0.00044684288674497836,
--0.00055899331258180954,
--0.00067127580297305094,
--0.00078366831591389905,
--0.00089614873991711275,
--0.0010086948982826463,
--0.0011212845533897225,
--0.0012338954110105835,
--0.0013465051246442682,
--0.001459091299870745,
--0.0015716314987230793,
--0.0016841032440788012,
--0.001796484024067716,
--0.0019087512964961752,
--0.0020208824932873293,
--0.0021328550249357608,
--0.0022446462849757339,
--0.0023562336544625836,
--0.0024675945064664881,
--0.0025787062105768438,
--0.0026895461374176043,
--0.0028000916631711363,
--0.0029103201741117234,
--0.0030202090711459167,
--0.0031297357743599848,
--0.0032388777275728798,
--0.0033476124028949282,
--0.0034559173052895148,
--0.0035637699771387688,
--0.0036711480028108635,
--0.0037780290132292133,
--0.0038843906904417439,
--0.0039902107721894982,
--0.0040954670564739967,
--0.0042001374061224712,
--0.0043041997533494834,
--0.004407632104314209,
--0.0045104125436733989,
--0.0046125192391271996,
--0.0047139304459588608,
--0.0048146245115659953,
--0.004914579879983459,
--0.0050137750963962962,
--0.00511218881164176,
--0.005209799786699945,
--0.005306586897172139,
--0.0054025291377452506,
--0.0054976056266421445,
--0.0055917956100565514,
--0.0056850784665718425,
--0.0057774337115625548,
--0.005868841001577964,
--0.0059592801387063901,
--0.0060487310749202045,
--0.0061371739163992326,
--0.0062245889278330409,
--0.0063109565367001474,
--0.0063962573375241707,
--0.0064804720961050095,
--0.0065635817537251801,
--0.0066455674313292421,
--0.0067264104336768361,
--0.0068060922534671966,
--0.0068845945754347085,
--0.0069618992804152116,
--0.0070379884493808496,
--0.0071128443674439382,
--0.0071864495278280843,
--0.0072587866358062919,
--0.0073298386126046415,
--0.0073995885992712189,
--0.0074680199605087691,
--0.0075351162884712284,
--0.0076008614065222234,
--0.0076652393729554425,
--0.0077282344846757089,
--0.0077898312808401008,
--0.0078500145464581641,
--0.007908769315950517,
--0.007966080876664932,
--0.0080219347723493265,
--0.0080763168065806721,
--0.0081292130461489264,
--0.0081806098243955103,
--0.0082304937445055858,
--0.0082788516827529222,
--0.0083256707916971977,
--0.0083709385033323928,
--0.0084146425321861649,
--0.0084567708783690118,
--0.0084973118305725522,
--0.0085362539690166037,
--0.0085735861683438573,
--0.0086092976004617482,
--0.0086433777373307336,
--0.0086758163536984675,
--0.0087066035297789866,
--0.0087357296538764177,
--0.0087631854249523751,
--0.0087889618551368048,
--0.008813050272181126,
--0.0088354423218535288,
--0.0088561299702754424,
--0.0088751055061990058,
--0.008892361543224472,
--0.0089078910219573676,
--0.0089216872121046994,
--0.0089337437145096156,
--0.0089440544631241188,
--0.0089526137269191047,
--0.0089594161117314535,
--0.008964456562047524,
--0.0089677303627224911,
--0.008969233140635342,
--0.0089689608662786302,
--0.0089669098552829993,
--0.0089630767698756567,
--0.0089574586202725761,
--0.0089500527660039807,
--0.0089408569171725745,
--0.008929869135644402,
--0.0089170878361716395,
--0.0089025117874471336,
--0.0088861401130903937,
--0.0088679722925644484,
--0.0088480081620235553,
--0.0088262479150911979,
--0.008802692103568141,
--0.0087773416380703927,
--0.0087501977885966128,
--0.0087212621850247026,
--0.0086905368175375936,
--0.0086580240369776833,
--0.008623726555129909,
--0.0085876474449330699,
--0.0085497901406194985,
--0.008510158437782453,
--0.0084687564933717836,
--0.0084255888256167706,
--0.0083806603138767977,
--0.0083339761984195845,
--0.0082855420801262337,
--0.0082353639201241651,
--0.0081834480393467041,
--0.0081298011180200632,
--0.0080744301950771164,
--0.0080173426674984526,
--0.0079585462895801345,
--0.0078980491721289178,
--0.007835859781583833,
--0.0077719869390653427,
--0.0077064398193512776,
--0.00763922794978003,
--0.0075703612090808441,
--0.0074998498261314881,
--0.00742770437864319,
--0.0073539357917732683,
--0.0072785553366650933,
--0.0072015746289159251,
--0.0071230056269729353,
--0.0070428606304570821,
--0.0069611522784150939,
--0.0068778935475003978,
--0.006793097750082213,
--0.0067067785322843772,
--0.0066189498719523947,
--0.0065296260765505777,
--0.0064388217809889488,
--0.006346551945379671,
--0.0062528318527241191,
--0.0061576771065307862,
--0.0060611036283639303,
--0.0059631276553233784,
--0.0058637657374564361,
--0.0057630347351014114,
--0.005660951816164347,
--0.0055575344533276517,
--0.0054528004211927888,
--0.0053467677933563074,
--0.0052394549394205094,
--0.0051308805219378558,
--0.0050210634932916637,
--0.0049100230925115422,
--0.0047977788420255239,
--0.0046843505443483376,
--0.0045697582787070879,
--0.0044540223976049587,
--0.0043371635233229499,
--0.0042192025443601629,
--0.0041001606118140728,
--0.0039800591357008717,
--0.0038589197812156735,
--0.0037367644649352071,
--0.0036136153509615009,
--0.003489494847008852,
--0.00336442560043339,
--0.0032384304942069614,
--0.0031115326428358529,
--0.0029837553882246554,
--0.0028551222954858279,
--0.0027256571486966412,
--0.0025953839466033575,
--0.0024643268982737256,
--0.0023325104186985605,
--0.0021999591243431339,
--0.0020666978286491256,
--0.0019327515374884191,
--0.0017981454445680745,
--0.0016629049267897628,
--0.0015270555395619741,
--0.0013906230120677226,
--0.001253633242487103,
--0.0011161122931770441,
--0.00097808638580765945,
--0.00083958189645793062,
--0.00070062535066911589,
--0.00056124341845917758,
--0.00042146290929816112,
--0.00028131076704446137,
--0.00014081406484531882,
-5.1709452627355769e-017,
-0.00014110411121183623,
-0.00028247083873609658,
-0.00042407264398380568,
-0.00056588188510302913,
-0.00070787082228133502,
-0.00085001162308000677,
-0.00099227636779654588,
-0.0011346370548559568,
-0.0012770656062292857,
-0.0014195338728784604,
-0.0015620136402263876,
-0.0017044766336513312,
-0.0018468945240041096,
-0.0019892389331480267,
-0.0021314814395194978,
-0.0022735935837083533,
-0.0024155468740573098,
-0.0025573127922796294,
-0.002698862799092757,
-0.0028401683398683797,
-0.0029812008502958709,
-0.0031219317620605749,
-0.0032623325085334009,
-0.0034023745304716723,
-0.0035420292817306487,
-0.0036812682349835965,
-0.0038200628874494498,
-0.0039583847666274175,
-0.0040962054360374834,
-0.0042334965009646723,
-0.0043702296142072942,
-0.0045063764818262745,
-0.004641908868896814,
-0.0047767986052588444,
-0.0049110175912666842,
-0.005044537803535698,
-0.0051773313006863893,
-0.0053093702290823381,
-0.0054406268285632454,
-0.0055710734381702147,
-0.0057006825018633377,
-0.0058294265742295983,
-0.0059572783261798868,
-0.0060842105506345402,
-0.0062101961681963122,
-0.0063352082328086944,
-0.0064592199373990382,
-0.0065822046195060466,
-0.00670413576688857,
-0.0068249870231166139,
-0.0069447321931418136,
-0.0070633452488475289,
-0.0071808003345763755,
-0.007297071772634306,
-0.0074121340687703314,
-0.0075259619176310105,
-0.0076385302081875672,
-0.007749814029135437,
-0.0078597886742647182,
-0.0079684296478004096,
-0.0080757126697113459,
-0.0081816136809868076,
-0.0082861088488791687,
-0.0083891745721127627,
-0.0084907874860558202,
-0.008590924467856453,
-0.0086895626415399788,
-0.0087866793830678226,
-0.0088822523253555725,
-0.0089762593632503936,
-0.0090686786584653484,
-0.0091594886444711834,
-0.0092486680313429836,
-0.0093361958105614082,
-0.0094220512597677723,
-0.0095062139474708027,
-0.0095886637377052882,
-0.0096693807946406068,
-0.009748345587139013,
-0.0098255388932616834,
-0.0099009418047224795,
-0.0099745357312874278,
-0.010046302405120097,
-0.010116223885070852,
-0.010184282560909523,
-0.010250461157500558,
-0.010314742738919424,
-0.010377110712509645,
-0.010437548832879312,
-0.010496041205836094,
-0.010552572292260292,
-0.010607126911914443,
-0.010659690247188871,
-0.010710247846782373,
-0.010758785629317126,
-0.010805289886886888,
-0.010849747288537513,
-0.010892144883679577,
-0.010932470105431328,
-0.010970710773892009,
-0.011006855099344308,
-0.011040891685385308,
-0.011072809531985171,
-0.011102598038472595,
-0.011130247006446626,
-0.011155746642613972,
-0.011179087561550878,
-0.011200260788389272,
-0.011219257761426078,
-0.0112360703346554,
-0.011250690780222611,
-0.011263111790799845,
-0.011273326481882324,
-0.01128132839400472,
-0.011287111494877145,
-0.01129067018144001,
-0.011291999281837314,
-0.011291094057307794,
-0.011287950203993235,
-0.011282563854663663,
-0.01127493158035877,
-0.011265050391944966,
-0.011252917741587907,
-0.011238531524139691,
-0.011221890078440452,
-0.011202992188533973,
-0.011181837084796694,
-0.01115842444498001,
-0.011132754395165142,
-0.011104827510630607,
-0.011074644816631427,
-0.011042207789090505,
-0.011007518355200922,
-0.010970578893939606,
-0.010931392236491854,
-0.010889961666586243,
-0.010846290920740057,
-0.010800384188414688,
-0.010752246112080928,
-0.010701881787194141,
-0.01064929676207867,
-0.010594497037721789,
-0.010537489067476985,
-0.010478279756676223,
-0.010416876462151163,
-0.010353286991663491,
-0.010287519603243875,
-0.010219583004440249,
-0.010149486351474137,
-0.010077239248306374,
-0.01000285174561146,
-0.009926334339660536,
-0.0098476979711133103,
-0.0097669540237191807,
-0.0096841143229271197,
-0.0095991911344044459,
-0.0095121971624653467,
-0.0094231455484081236,
-0.0093320498687628275,
-0.009238924133447575,
-0.0091437827838354128,
-0.0090466406907310625,
-0.0089475131522581894,
-0.0088464158916565592,
-0.0087433650549910598,
-0.0086383772087709042,
-0.0085314693374809927,
-0.0084226588410242914,
-0.0083119635320767025,
-0.0081994016333545063,
-0.0080849917747944002,
-0.007968752990646491,
-0.0078507047164812858,
-0.0077308667861108737,
-0.0076092594284236561,
-0.0074859032641353311,
-0.0073608193024542953,
-0.0072340289376636516,
-0.0071055539456190897,
-0.0069754164801640048,
-0.0068436390694625211,
-0.0067102446122503032,
-0.0065752563740037505,
-0.0064386979830291695,
-0.0063005934264714529,
-0.0061609670462435349,
-0.00601984353487696,
-0.005877247931294456,
-0.0057332056165050396,
-0.0055877423092228285,
-0.0054408840614088546,
-0.0052926572537391157,
-0.0051430885909969793,
-0.0049922050973927878,
-0.0048400341118096683,
-0.0046866032829781887,
-0.0045319405645788376,
-0.0043760742102754227,
-0.0042190327686772652,
-0.0040608450782338695,
-0.0039015402620617948,
-0.003741147722703465,
-0.0035796971368216727,
-0.0034172184498277038,
-0.0032537418704462612,
-0.0030892978652163798,
-0.002923917152931047,
-0.0027576306990147689,
-0.0025904697098423062,
-0.0024224656269965614,
-0.0022536501214696432,
-0.0020840550878063377,
-0.0019137126381916683,
-0.0017426550964835033,
-0.0015709149921913214,
-0.0013985250544021428,
-0.0012255182056552436,
-0.001051927555765582,
-0.00087778639559825975,
-0.00070312819079512354,
-0.00052798657545392934,
-0.00035239534576116501,
-0.0001763884535810419,
--1.8501282140218453e-017,
--0.00017673577116978688,
--0.00035378447992952033,
--0.00053111161667188024,
--0.00070868254879757962,
--0.00088646252737013755,
--0.0010644166938063259,
--0.0012425100866011226,
--0.0014207076480866137,
--0.0015989742312236619,
--0.0017772746064236814,
--0.0019555734684011134,
--0.002133835443052878,
--0.0023120250943666747,
--0.0024901069313537257,
--0.0026680454150065261,
--0.0028458049652790814,
--0.0030233499680901808,
--0.0032006447823452753,
--0.00337765374697878,
--0.0035543411880130261,
--0.0037306714256343885,
--0.0039066087812838117,
--0.004082117584760501,
--0.0042571621813380688,
--0.0044317069388917904,
--0.004605716255034498,
--0.0047791545642602408,
--0.0049519863450956806,
--0.0051241761272547868,
--0.0052956884987985595,
--0.0054664881132960776,
--0.0056365396969871254,
--0.0058058080559438329,
--0.0059742580832298523,
--0.0061418547660564244,
--0.0063085631929339289,
--0.006474348560816261,
--0.0066391761822379011,
--0.0068030114924415687,
--0.00696582005649526,
--0.0071275675763971102,
--0.0072882198981667574,
--0.007447743018921287,
--0.0076061030939357987,
--0.0077632664436846138,
--0.0079191995608643047,
--0.0080738691173951535,
--0.0082272419714012456,
--0.0083792851741660186,
--0.0085299659770636284,
--0.0086792518384625639,
--0.0088271104306027869,
--0.0089735096464425412,
--0.0091184176064742738,
--0.0092618026655094474,
--0.0094036334194282263,
--0.0095438787118952654,
--0.0096825076410383196,
--0.0098194895660897279,
--0.0099547941139879262,
--0.010088391185938985,
--0.010220250963935175,
--0.010350343917231336,
--0.010478640808775502,
--0.010605112701593828,
--0.010729730965127813,
--0.010852467281522775,
--0.010973293651866023,
--0.011092182402373528,
--0.011209106190523451,
--0.011324038011135931,
--0.011436951202397076,
--0.011547819451825847,
--0.011656616802183032,
--0.011763317657321104,
--0.011867896787972732,
--0.011970329337477959,
--0.012070590827447302,
--0.012168657163361277,
--0.012264504640103632,
--0.012358109947427481,
--0.012449450175354005,
--0.012538502819500622,
--0.012625245786339818,
--0.012709657398385006,
--0.012791716399304395,
--0.012871401958960247,
--0.012948693678372938,
--0.013023571594608785,
--0.013096016185590236,
--0.01316600837482745,
--0.013233529536070295,
--0.013298561497879363,
--0.013361086548115289,
--0.013421087438345141,
--0.013478547388164784,
--0.013533450089436282,
--0.013585779710439588,
--0.013635520899936797,
--0.013682658791148938,
--0.01372717900564353,
--0.013769067657132509,
--0.013808311355179206,
--0.013844897208813826,
--0.013878812830056158,
--0.013910046337345012,
--0.013938586358873174,
--0.013964422035827262,
--0.013987543025531719,
--0.01400793950449571,
--0.014025602171362747,
--0.014040522249761744,
--0.014052691491058991,
--0.014062102177010363,
--0.014068747122312802,
--0.014072619677054693,
--0.014073713729064113,
--0.014072023706154617,
--0.01406754457826765,
--0.014060271859511128,
--0.014050201610093552,
--0.014037330438153051,
--0.01402165550148061,
--0.014003174509137552,
--0.013981885722965728,
--0.013957787958991129,
--0.013930880588719262,
--0.013901163540322763,
--0.013868637299720222,
--0.013833302911546047,
--0.013795161980010939,
--0.013754216669652529,
--0.01371046970597605,
--0.01366392437598408,
--0.013614584528596145,
--0.013562454574956527,
--0.013507539488631381,
--0.013449844805693688,
--0.013389376624696709,
--0.013326141606535238,
--0.013260146974194732,
--0.013191400512387947,
--0.013119910567079099,
--0.01304568604489542,
--0.012968736412425845,
--0.012889071695407046,
--0.012806702477796439,
--0.012721639900732398,
--0.012633895661381711,
--0.012543482011673528,
--0.012450411756921582,
--0.012354698254332393,
--0.01225635541140167,
--0.012155397684197709,
--0.012051840075532446,
--0.011945698133020219,
--0.011836987947024317,
--0.011725726148491704,
--0.011611929906675863,
--0.011495616926748638,
--0.011376805447299831,
--0.011255514237727405,
--0.01113176259551564,
--0.011005570343403886,
--0.010876957826445146,
--0.010745945908955111,
--0.010612555971352083,
--0.010476809906888269,
--0.010338730118272682,
--0.010198339514186383,
--0.010055661505690329,
--0.0099107200025265307,
--0.009763539409312811,
--0.0096141446216323721,
--0.0094625610220170405,
--0.0093088144758278948,
--0.0091529313270301543,
--0.0089949383938659772,
--0.0088348629644243257,
--0.0086727327921089937,
--0.0085085760910054639,
--0.008342421531147377,
--0.0081742982336832897,
--0.008004235765944466,
--0.0078322641364151242,
--0.0076584137896039224,
--0.0074827156008213181,
--0.0073052008708590355,
--0.007125901320576296,
--0.0069448490853917227,
--0.0067620767096824444,
--0.006577617141091281,
--0.0063915037247429208,
--0.0062037701973701566,
--0.0060144506813510938,
--0.005823579678658394,
--0.0056311920647216318,
--0.0054373230822036189,
--0.0052420083346926116,
--0.0050452837803091769,
--0.0048471857252330988,
--0.0046477508171457538,
--0.0044470160385953151,
--0.0042450187002802181,
--0.0040417964342563222,
--0.0038373871870667365,
--0.0036318292127963002,
--0.0034251610660517595,
--0.0032174215948689031,
--0.0030086499335485826,
--0.002798885495420643,
--0.0025881679655415028,
--0.0023765372933206288,
--0.0021640336850839176,
--0.0019506975965691796,
--0.0017365697253596451,
--0.0015216910032544979,
--0.0013061025885785925,
--0.0010898458584326848,
--0.00087296240088557682,
--0.00065549400710965538,
--0.00043748266346125734,
--0.00021897054350735343,
--3.4469686980574571e-017,
-0.00021938644319981665,
-0.00043914609924736571,
-0.00065923612648810851,
-0.00087961353667548726,
-0.0011002352032358619,
-0.001321057869574699,
-0.0015420381574248706,
-0.0017631325752346765,
-0.0019842975265941271,
-0.0022054893186978695,
-0.0024266641708431246,
-0.0026477782229611686,
-0.0028687875441798702,
-0.0030896481414181549,
-0.0033103159680061495,
-0.0035307469323348816,
-0.0037508969065293634,
-0.0039707217351457463,
-0.0041901772438901726,
-0.0044092192483576528,
-0.0046278035627893045,
-0.0048458860088462785,
-0.0050634224243985733,
-0.0052803686723271103,
-0.0054966806493372449,
-0.0057123142947821809,
-0.0059272255994937476,
-0.0061413706146211233,
-0.0063547054604714799,
-0.0065671863353559835,
-0.0067787695244351884,
-0.0069894114085642762,
-0.0071990684731356716,
-0.0074076973169174606,
-0.0076152546608856796,
-0.0078216973570488825,
-0.0080269823972631531,
-0.0082310669220352333,
-0.0084339082293141097,
-0.008635463783265164,
-0.0088356912230302172,
-0.0090345483714674799,
-0.0092319932438718905,
-0.0094279840566734094,
-0.0096224792361114513,
-0.0098154374268839047,
-0.010006817500768758,
-0.010196578565216659,
-0.010384679971912718,
-0.010571081325305621,
-0.010755742491102579,
-0.0109386236047275,
-0.011119685079742907,
-0.011298887616229871,
-0.011476192209128889,
-0.011651560156536312,
-0.011824953067956362,
-0.011996332872506692,
-0.012165661827075562,
-0.012332902524429085,
-0.012498017901266836,
-0.012660971246224121,
-0.012821726207818782,
-0.012980246802342423,
-0.013136497421691309,
-0.013290442841139168,
-0.013442048227046907,
-0.013591279144509517,
-0.013738101564937795,
-0.013882481873573412,
-0.01402438687693576,
-0.014163783810198843,
-0.014300640344496752,
-0.014434924594156023,
-0.014566605123853415,
-0.0146956509556975,
-0.014822031576232107,
-0.014945716943361576,
-0.015066677493193469,
-0.015184884146800963,
-0.015300308316899503,
-0.015412921914439656,
-0.015522697355112389,
-0.015629607565766319,
-0.015733625990735339,
-0.01583472659807517,
-0.015932883885707339,
-0.0160280728874692,
-0.016120269179069165,
-0.016209448883944419,
-0.016295588679021804,
-0.016378665800378181,
-0.016458658048801318,
-0.016535543795248096,
-0.016609301986199972,
-0.016679912148913806,
-0.016747354396567125,
-0.016811609433296553,
-0.016872658559127989,
-0.016930483674797794,
-0.01698506728646329,
-0.017036392510301944,
-0.017084443076997729,
-0.017129203336113657,
-0.017170658260349827,
-0.017208793449684959,
-0.017243595135401607,
-0.017275050183992953,
-0.017303146100950871,
-0.017327871034434054,
-0.017349213778815129,
-0.017367163778106154,
-0.017381711129261262,
-0.017392846585355753,
-0.017400561558640813,
-0.017404848123472788,
-0.017405699019116573,
-0.017403107652421864,
-0.017397068100372007,
-0.017387575112504241,
-0.017374624113200975,
-0.017358211203851229,
-0.017338333164881505,
-0.017314987457655726,
-0.017288172226243279,
-0.017257886299054788,
-0.01722412919034506,
-0.017186901101582434,
-0.017146202922684473,
-0.017102036233118709,
-0.017054403302869121,
-0.017003307093266674,
-0.016948751257684507,
-0.016890740142096714,
-0.016829278785500799,
-0.016764372920203132,
-0.016696028971967401,
-0.016624254060025458,
-0.016549055996950651,
-0.016470443288393269,
-0.016388425132677371,
-0.01630301142026034,
-0.016214212733052843,
-0.016122040343601075,
-0.016026506214130029,
-0.015927622995448074,
-0.015825404025712874,
-0.015719863329058441,
-0.015611015614083614,
-0.015498876272201671,
-0.015383461375851488,
-0.015264787676570113,
-0.015142872602926847,
-0.015017734258319652,
-0.014889391418632271,
-0.014757863529755449,
-0.01462317070496829,
-0.014485333722184567,
-0.01434437402106019,
-0.014200313699964977,
-0.01405317551281786,
-0.013902982865785982,
-0.01374975981384844,
-0.013593531057224689,
-0.013434321937668806,
-0.013272158434628336,
-0.013107067161271543,
-0.012939075360379061,
-0.012768210900105548,
-0.012594502269607248,
-0.012417978574539629,
-0.012238669532423774,
-0.012056605467883012,
-0.011871817307750195,
-0.011684336576046464,
-0.011494195388832342,
-0.01130142644893172,
-0.01110606304052982,
-0.010908139023645772,
-0.010707688828480642,
-0.010504747449642594,
-0.010299350440247712,
-0.010091533905901796,
-0.0098813344985588247,
-0.0096687894102611711,
-0.009453936366761187,
-0.009236813621024513,
-0.0090174599466168511,
-0.0087959146309762801,
-0.00857221746856969,
-0.0083464087539377018,
-0.008118529274626151,
-0.0078886203040076791,
-0.0076567235939933474,
-0.0074228813676363503,
-0.00718713631162769,
-0.0069495315686876006,
-0.0067101107298510451,
-0.006468917826651043,
-0.0062259973231999308,
-0.0059813941081703209,
-0.0057351534866770396,
-0.0054873211720619765,
-0.0052379432775818309,
-0.0049870663080028846,
-0.0047347371511010962,
-0.0044810030690716641,
-0.0042259116898481037,
-0.0039695109983333083,
-0.0037118493275427144,
-0.0034529753496638374,
-0.003192938067030159,
-0.0029317868030149254,
-0.002669571192843273,
-0.0024063411743256826,
-0.0021421469785156727,
-0.0018770391202906462,
-0.0016110683888602509,
-0.001344285838202472,
-0.0010767427774301878,
-0.00080849076108838549,
-0.00053958157938671766,
-0.00027006724836532313,
--2.3604630592482906e-017,
--0.00027056772775546845,
--0.00054158330098461342,
--0.00081299389988171854,
--0.0010847465288797143,
--0.0013567880268326969,
--0.0016290650772481695,
--0.0019015242185705104,
--0.0021741118545109289,
--0.0024467742644234229,
--0.0027194576137243112,
--0.0029921079643534711,
--0.0032646712852747936,
--0.0035370934630153924,
--0.0038093203122387368,
--0.0040812975863526941,
--0.0043529709881490724,
--0.0046242861804713393,
--0.0048951887969114274,
--0.0051656244525307149,
--0.0054355387546047469,
--0.0057048773133889985,
--0.0059735857529037905,
--0.0062416097217357835,
--0.0065088949038553572,
--0.0067753870294450817,
--0.0070410318857404329,
--0.0073057753278779501,
--0.0075695632897501549,
--0.0078323417948642175,
--0.0080940569672037586,
--0.0083546550420887638,
--0.0086140823770353443,
--0.0088722854626090159,
--0.0091292109332730687,
--0.0093848055782272469,
--0.0096390163522358345,
--0.0098917903864423617,
--0.010143074999169971,
--0.010392817706702888,
--0.010640966234049521,
--0.010887468525683766,
--0.011132272756261184,
--0.011375327341310892,
--0.011616580947897292,
--0.011855982505253004,
--0.012093481215378156,
--0.012329026563605426,
--0.012562568329127664,
--0.012794056595487463,
--0.013023441761024023,
--0.013250674549278047,
--0.013475706019350289,
--0.013698487576212748,
--0.013918970980970044,
--0.01413710836106895,
--0.014352852220453531,
--0.014566155449665113,
--0.01477697133588254,
--0.014985253572903567,
--0.015190956271062895,
--0.01539403396708605,
--0.015594441633876462,
--0.015792134690234553,
--0.015987069010504947,
--0.016179200934152486,
--0.016368487275261929,
--0.016554885331962005,
--0.016738352895770459,
--0.0169188482608577,
--0.01709633023322852,
--0.017270758139818591,
--0.017442091837504437,
--0.017610291722024503,
--0.017775318736810427,
--0.017937134381724656,
--0.018095700721704841,
--0.018250980395311266,
--0.018402936623176387,
--0.018551533216354398,
--0.018696734584568935,
--0.018838505744357081,
--0.018976812327108329,
--0.019111620586995549,
--0.019242897408797883,
--0.019370610315612206,
--0.019494727476452558,
--0.019615217713734999,
--0.019732050510647216,
--0.019845196018399857,
--0.019954625063359377,
--0.020060309154059534,
--0.020162220488090746,
--0.020260331958865636,
--0.020354617162258431,
--0.020445050403117813,
--0.020531606701650929,
--0.020614261799677205,
--0.020692992166750641,
--0.020767775006149181,
--0.020838588260729221,
--0.020905410618644846,
--0.020968221518929079,
--0.021027001156937199,
--0.021081730489649682,
--0.021132391240834037,
--0.021178965906064134,
--0.021221437757595808,
--0.021259790849097293,
--0.021294010020233699,
--0.021324080901103899,
--0.021349989916529036,
--0.021371724290191376,
--0.021389272048622461,
--0.02140262202503937,
--0.021411763863028333,
--0.021416688020074418,
--0.021417385770936419,
--0.021413849210866059,
--0.021406071258670504,
--0.021394045659617313,
--0.021377766988180995,
--0.021357230650630325,
--0.021332432887455607,
--0.021303370775635152,
--0.021270042230740253,
--0.021232446008877741,
--0.021190581708469852,
--0.021144449771870313,
--0.021094051486816312,
--0.021039388987715749,
--0.020980465256769137,
--0.020917284124925439,
--0.020849850272672107,
--0.020778169230657593,
--0.020702247380147403,
--0.020622091953311952,
--0.020537711033346812,
--0.020449113554424508,
--0.020356309301477873,
--0.020259308909814255,
--0.020158123864561135,
--0.020052766499942136,
--0.019943249998383494,
--0.019829588389451515,
--0.019711796548619698,
--0.019589890195866828,
--0.019463885894104728,
--0.01933380104743675,
--0.01919965389924622,
--0.01906146353011573,
--0.018919249855576109,
--0.018773033623687166,
--0.018622836412448159,
--0.01846868062703989,
--0.018310589496897973,
--0.018148587072617434,
--0.01798269822268939,
--0.017812948630069932,
--0.017639364788581011,
--0.017461973999145421,
--0.017280804365853945,
--0.017095884791867324,
--0.016907244975152124,
--0.01671491540405207,
--0.016518927352694033,
--0.016319312876231475,
--0.016116104805923199,
--0.015909336744051004,
--0.015699043058674682,
--0.015485258878225727,
--0.015268020085941967,
--0.015047363314141414,
--0.014823325938338251,
--0.014595946071200872,
--0.014365262556353403,
--0.014131314962020377,
--0.013894143574518205,
--0.013653789391590692,
--0.013410294115593807,
--0.013163700146526914,
--0.012914050574914441,
--0.012661389174537501,
--0.012405760395017727,
--0.012147209354252762,
--0.011885781830707591,
--0.011621524255559531,
--0.011354483704700892,
--0.011084707890599206,
--0.010812245154016903,
--0.010537144455591538,
--0.010259455367278632,
--0.0099792280636569058,
--0.0096965133131002631,
--0.0094113624688149985,
--0.0091238274597450642,
--0.0088339607813483351,
--0.0085418154862424139,
--0.0082474451747244007,
--0.0079509039851647922,
--0.0076522465842775575,
--0.0073515281572680983,
--0.0070488043978612028,
--0.0067441314982092096,
--0.0064375661386852035,
--0.0061291654775592307,
--0.0058189871405626165,
--0.0055070892103403178,
--0.0051935302157944301,
--0.0048783691213188617,
--0.0045616653159304636,
--0.0042434786022940586,
--0.0039238691856482676,
--0.003602897662629632,
--0.0032806250100003674,
--0.0029571125732799973,
--0.0026324220552840939,
--0.0023066155045702737,
--0.0019797553037969435,
--0.0016519041579933251,
--0.0013231250827445257,
--0.00099348139229550082,
--0.00066303668757192852,
--0.000331854844125343,
-2.6104283963309635e-017,
-0.00033246345647290675,
-0.00066547089895279017,
-0.00099895747543640289,
-0.0013328581206724756,
-0.0016671075686390052,
-0.0020016403650848901,
-0.0023363908801300941,
-0.0026712933209238274,
-0.003006281744357749,
-0.00334129006983193,
-0.0036762520920705834,
-0.0040111014939869542,
-0.0043457718595914484,
-0.0046801966869447816,
-0.0050143094011501398,
-0.0053480433673838831,
-0.0056813319039610271,
-0.0060141082954349463,
-0.0063463058057252582,
-0.0066778576912760986,
-0.007008697214237157,
-0.0073387576556690473,
-0.0076679723287688345,
-0.007996274592111512,
-0.0083235978629084117,
-0.0086498756302767002,
-0.008975041468519164,
-0.0092990290504106309,
-0.0096217721604901999,
-0.0099432047083532864,
-0.0102632607419455,
-0.010581874460850675,
-0.010898980229575051,
-0.01121451259082154,
-0.011528406278753334,
-0.01184059623224311,
-0.012151017608106897,
-0.012459605794316923,
-0.012766296423194495,
-0.013071025384577262,
-0.013373728838959795,
-0.013674343230604317,
-0.013972805300619201,
-0.01426905210000187,
-0.014563021002645327,
-0.014854649718302511,
-0.015143876305509099,
-0.015430639184460828,
-0.015714877149841086,
-0.015996529383599564,
-0.016275535467676204,
-0.016551835396669531,
-0.016825369590446376,
-0.017096078906690237,
-0.01736390465338556,
-0.017628788601236567,
-0.01789067299601545,
-0.018149500570840728,
-0.018405214558380293,
-0.018657758702978457,
-0.018907077272703156,
-0.019153115071312635,
-0.019395817450136212,
-0.019635130319870134,
-0.019871000162282618,
-0.020103374041828454,
-0.02033219961716877,
-0.020557425152594542,
-0.02077899952935065,
-0.020996872256859516,
-0.021210993483839476,
-0.021421314009318151,
-0.021627785293537056,
-0.021830359468744374,
-0.022028989349876026,
-0.022223628445119537,
-0.022414230966361463,
-0.022600751839513773,
-0.022783146714718292,
-0.022961371976426236,
-0.023135384753351446,
-0.023305142928293787,
-0.023470605147832144,
-0.023631730831883652,
-0.023788480183127562,
-0.023940814196291491,
-0.024088694667298162,
-0.024232084202270139,
-0.024370946226391434,
-0.024505244992622435,
-0.024634945590268052,
-0.024760013953395606,
-0.024880416869101276,
-0.024996121985622937,
-0.025107097820297981,
-0.025213313767363167,
-0.025314740105596169,
-0.025411348005795906,
-0.025503109538100081,
-0.025589997679138898,
-0.025671986319022018,
-0.025749050268158387,
-0.025821165263906355,
-0.02588830797705291,
-0.02595045601812012,
-0.026007587943497838,
-0.026059683261400277,
-0.026106722437645734,
-0.026148686901257642,
-0.026185559049885471,
-0.026217322255044355,
-0.026243960867171821,
-0.026265460220500393,
-0.026281806637744896,
-0.026292987434602962,
-0.026298990924067765,
-0.02629980642055163,
-0.026295424243819313,
-0.026285835722730189,
-0.02627103319878769,
-0.026251010029495609,
-0.026225760591519629,
-0.02619528028365356,
-0.026159565529589229,
-0.026118613780488839,
-0.026072423517359541,
-0.026020994253228697,
-0.025964326535119615,
-0.025902421945826655,
-0.025835283105489215,
-0.025762913672963655,
-0.025685318346993002,
-0.025602502867173169,
-0.025514474014715932,
-0.025421239613007289,
-0.025322808527961482,
-0.025219190668169793,
-0.025110396984843908,
-0.02499643947155325,
-0.024877331163756521,
-0.024753086138126379,
-0.024623719511667665,
-0.024489247440628786,
-0.024349687119205935,
-0.024205056778040173,
-0.024055375682507586,
-0.023900664130801445,
-0.023740943451808171,
-0.02357623600277527,
-0.023406565166772121,
-0.023231955349944742,
-0.023052431978562438,
-0.022868021495858856,
-0.022678751358666125,
-0.022484650033843225,
-0.022285746994498465,
-0.022082072716006873,
-0.021873658671821977,
-0.021660537329084292,
-0.021442742144024585,
-0.02122030755716452,
-0.020993268988314072,
-0.020761662831367208,
-0.020525526448894899,
-0.020284898166538973,
-0.020039817267203896,
-0.019790323985051119,
-0.019536459499293408,
-0.019278265927792363,
-0.019015786320458999,
-0.018749064652458739,
-0.018478145817220824,
-0.01820307561925533,
-0.017923900766776364,
-0.017640668864133617,
-0.017353428404054856,
-0.017062228759697051,
-0.016767120176511757,
-0.016468153763921724,
-0.016165381486813402,
-0.015858856156844618,
-0.015548631423570275,
-0.015234761765385298,
-0.014917302480289848,
-0.014596309676474125,
-0.014271840262727667,
-0.013943951938672931,
-0.013612703184825289,
-0.013278153252480978,
-0.012940362153435287,
-0.012599390649530721,
-0.012255300242040601,
-0.011908153160885329,
-0.011558012353686996,
-0.01120494147466191,
-0.010849004873354383,
-0.010490267583211534,
-0.010128795310004931,
-0.0097646544200958533,
-0.0093979119285518241,
-0.0090286354871118163,
-0.0086568933720042075,
-0.008282754471621228,
-0.0079062882740481982,
-0.0075275648544534104,
-0.0071466548623387348,
-0.0067636295086546229,
-0.0063785605527794517,
-0.0059915202893697185,
-0.0056025815350778429,
-0.005211817615145998,
-0.0048193023498728539,
-0.0044251100409597342,
-0.0040293154577364576,
-0.0036319938232706813,
-0.0032332208003610381,
-0.0028330724774206849,
-0.0024316253542488232,
-0.0020289563276969552,
-0.0016251426772302471,
-0.0012202620503873837,
-0.00081439244814139481,
-0.00040761221016485938,
--2.8501070131180604e-017,
--0.00040836520985967542,
--0.00081740415297723188,
--0.0012270372840659208,
--0.0016371847941627523,
--0.0020477666258842523,
--0.0024587024887571768,
--0.0028699118746236501,
--0.0032813140731170541,
--0.0036928281872060024,
--0.0041043731488026921,
--0.0045158677344350057,
--0.0049272305809751008,
--0.0053383802014266837,
--0.005749235000763752,
--0.0061597132918201096,
--0.0065697333112251979,
--0.0069792132353855953,
--0.0073880711965047001,
--0.0077962252986435087,
--0.0082035936338128845,
--0.0086100942981002168,
--0.009015645407822891,
--0.0094201651157079097,
--0.0098235716270930716,
--0.010225783216148872,
--0.010626718242113888,
--0.011026295165544965,
--0.011424432564576904,
--0.011821049151186671,
--0.012216063787463779,
--0.012609395501877646,
--0.013000963505544427,
--0.013390687208485814,
--0.013778486235879043,
--0.014164280444293362,
--0.014547989937912115,
--0.014929535084733131,
--0.015308836532749085,
--0.015685815226100706,
--0.016060392421201591,
--0.016432489702830864,
--0.01680202900019058,
--0.017168932602923952,
--0.01753312317709339,
--0.017894523781111119,
--0.018253057881623923,
--0.018608649369345056,
--0.018961222574832029,
--0.019310702284206081,
--0.019657013754811891,
--0.020000082730810928,
--0.020339835458709984,
--0.020676198702816583,
--0.021009099760622377,
--0.021338466478109601,
--0.021664227264975904,
--0.021986311109777962,
--0.022304647594987456,
--0.022619166911958258,
--0.022929799875800374,
--0.023236477940159671,
--0.02353913321189673,
--0.023837698465666451,
--0.024132107158390363,
--0.024422293443623039,
--0.024708192185806558,
--0.024989738974411424,
--0.025266870137960286,
--0.025539522757932816,
--0.025807634682546154,
--0.026071144540411328,
--0.026329991754059909,
--0.026584116553339681,
--0.026833459988675697,
--0.027077963944194233,
--0.027317571150706418,
--0.027552225198549669,
--0.027781870550282431,
--0.02800645255323124,
--0.028225917451886955,
--0.028440212400145812,
--0.028649285473395437,
--0.028853085680440763,
--0.029051562975268307,
--0.0292446682686462,
--0.029432353439557017,
--0.029614571346460901,
--0.029791275838387345,
--0.029962421765851184,
--0.030127964991592801,
--0.030287862401138056,
--0.030442071913176685,
--0.030590552489756253,
--0.030733264146290053,
--0.030870167961375292,
--0.031001226086421162,
--0.031126401755082408,
--0.031245659292498403,
--0.031358964124333699,
--0.031466282785619103,
--0.031567582929390443,
--0.03166283333512384,
--0.031752003916964179,
--0.031835065731746076,
--0.031911990986804729,
--0.031982753047574551,
--0.032047326444974468,
--0.032105686882577117,
--0.032157811243560902,
--0.032203677597442755,
--0.032243265206589974,
--0.032276554532509459,
--0.032303527241912766,
--0.03232416621255519,
--0.032338455538847684,
--0.032346380537239615,
--0.032347927751371346,
--0.032343084956994901,
--0.032331841166661483,
--0.032314186634174465,
--0.032290112858806411,
--0.032259612589279327,
--0.032222679827506151,
--0.03217930983209321,
--0.032129499121601797,
--0.032073245477568228,
--0.032010547947281018,
--0.031941406846314739,
--0.031865823760818653,
--0.031783801549560571,
--0.031695344345723686,
--0.031600457558456495,
--0.031499147874174994,
--0.031391423257615896,
--0.031277292952640798,
--0.031156767482790278,
--0.031029858651587909,
--0.03089657954259253,
--0.03075694451920016,
--0.030610969224193006,
--0.030458670579036867,
--0.03030006678292587,
--0.030135177311574241,
--0.029964022915755149,
--0.029786625619586476,
--0.02960300871856263,
--0.029413196777334043,
--0.029217215627231979,
--0.029015092363540891,
--0.028806855342516816,
--0.028592534178153217,
--0.028372159738692625,
--0.028145764142887109,
--0.027913380756004399,
--0.027675044185583367,
--0.027430790276936748,
--0.027180656108402163,
--0.0269246799863435,
--0.026662901439900365,
--0.026395361215488598,
--0.026122101271051225,
--0.025843164770061249,
--0.025558596075275407,
--0.02526844074224292,
--0.02497274551256554,
--0.024671558306914695,
--0.024364928217802027,
--0.024052905502107924,
--0.023735541573366836,
--0.023412888993811838,
--0.023085001466177726,
--0.022751933825266871,
--0.022413742029275353,
--0.022070483150883599,
--0.021722215368111364,
--0.021368997954938806,
--0.021010891271694948,
--0.020647956755215663,
--0.020280256908770587,
--0.019907855291764209,
--0.019530816509208973,
--0.019149206200973358,
--0.018763091030808976,
--0.018372538675153906,
--0.017977617811718034,
--0.017578398107850297,
--0.017174950208689997,
--0.016767345725104348,
--0.01635565722141457,
--0.015939958202910585,
--0.015520323103160401,
--0.015096827271111181,
--0.014669546957988491,
--0.014238559303993347,
--0.013803942324800991,
--0.013365774897860993,
--0.01292413674850571,
--0.012479108435863182,
--0.012030771338583697,
--0.011579207640376154,
--0.011124500315361437,
--0.010666733113242658,
--0.01020599054429659,
--0.0097423578641860319,
--0.009275921058600629,
--0.008806766827723668,
--0.0083349825705297861,
--0.0078606563689188926,
--0.0073838769716829582,
--0.0069047337783159669,
--0.0064233168226629335,
--0.0059397167564160689,
--0.0054540248324581918,
--0.0049663328880580884,
--0.0044767333279180435,
--0.0039853191070815999,
--0.0034921837136985046,
--0.0029974211516549886,
--0.0025011259230698279,
--0.0020033930106602513,
--0.0015043178599806126,
--0.0010039963615380075,
--0.00050252483278528405,
-3.0746207324051335e-017,
-0.00050348101995390448,
-0.001007820737972511,
-0.0015129213111670084,
-0.0020186845614211892,
-0.0025250119940514919,
-0.0030318048165605478,
-0.0035389639574880463,
-0.0040463900853476139,
-0.0045539836276525395,
-0.0050616447900242558,
-0.0055692735753775187,
-0.0060767698031842067,
-0.0065840331288069898,
-0.0070909630629021336,
-0.0075974589908860083,
-0.008103420192464553,
-0.0086087458612165487,
-0.0091133351242343938,
-0.0096170870618105652,
-0.010119900727173396,
-0.010621675166262976,
-0.011122309437546328,
-0.011621702631866281,
-0.012119753892323148,
-0.012616362434180146,
-0.013111427564795086,
-0.013604848703569228,
-0.014096525401912311,
-0.014586357363218904,
-0.015074244462852517,
-0.015560086768132602,
-0.016043784558323421,
-0.016525238344615799,
-0.017004348890103181,
-0.017481017229745762,
-0.017955144690316466,
-0.018426632910329928,
-0.018895383859945953,
-0.019361299860845897,
-0.019824283606077409,
-0.020284238179863676,
-0.020741067077372558,
-0.021194674224444092,
-0.021644963997267751,
-0.022091841242011332,
-0.022535211294392732,
-0.022974979999193363,
-0.023411053729707802,
-0.023843339407128007,
-0.024271744519854029,
-0.024696177142733023,
-0.025116545956216405,
-0.025532760265437018,
-0.025944730019198264,
-0.026352365828873466,
-0.026755578987210368,
-0.02715428148703921,
-0.027548386039876371,
-0.027937806094424325,
-0.028322455854961893,
-0.0287022502996193,
-0.029077105198539024,
-0.029446937131912654,
-0.029811663507895752,
-0.030171202580392735,
-0.030525473466710296,
-0.03087439616507455,
-0.031217891572009968,
-0.031555881499573252,
-0.031888288692442313,
-0.032215036844853898,
-0.032536050617387485,
-0.032851255653591718,
-0.033160578596449983,
-0.03346394710468073,
-0.033761289868871149,
-0.034052536627437444,
-0.034337618182411836,
-0.034616466415050368,
-0.034889014301259118,
-0.035155195926835088,
-0.035414946502519744,
-0.035668202378858961,
-0.035914901060870245,
-0.036154981222509722,
-0.036388382720939104,
-0.036615046610588023,
-0.036834915157007563,
-0.037047931850514609,
-0.03725404141962118,
-0.037453189844247621,
-0.037645324368715441,
-0.037830393514518154,
-0.038008347092865387,
-0.038179136216999671,
-0.038342713314280623,
-0.038499032138036023,
-0.038648047779175368,
-0.038789716677564028,
-0.03892399663315485,
-0.039050846816875477,
-0.039170227781267275,
-0.039282101470875096,
-0.039386431232383945,
-0.039483181824500828,
-0.039572319427579369,
-0.039653811652984462,
-0.039727627552194909,
-0.039793737625642034,
-0.039852113831281205,
-0.039902729592895175,
-0.03994555980812628,
-0.039980580856235876,
-0.040007770605588695,
-0.040027108420860484,
-0.040038575169966686,
-0.040042153230710371,
-0.040037826497147835,
-0.040025580385669689,
-0.04000540184079595,
-0.039977279340683743,
-0.039941202902345173,
-0.039897164086574899,
-0.039845156002584842,
-0.039785173312345566,
-0.039717212234631899,
-0.03964127054877252,
-0.039557347598101263,
-0.039465444293109726,
-0.039365563114299278,
-0.039257708114731872,
-0.039141884922278339,
-0.03901810074156354,
-0.038886364355606329,
-0.038746686127155303,
-0.03859907799971761,
-0.038443553498280936,
-0.038280127729728552,
-0.038108817382944915,
-0.037929640728613732,
-0.037742617618705371,
-0.03754776948565524,
-0.03734511934123122,
-0.037134691775091121,
-0.03691651295302803,
-0.036690610614905812,
-0.036457014072281906,
-0.03621575420571934,
-0.035966863461786819,
-0.035710375849747317,
-0.035446326937934924,
-0.035174753849820745,
-0.034895695259766359,
-0.034609191388468012,
-0.034315283998088343,
-0.034014016387078808,
-0.033705433384691758,
-0.033389581345183425,
-0.033066508141706884,
-0.03273626315989854,
-0.03239889729115536,
-0.03205446292560532,
-0.031703013944773227,
-0.031344605713938829,
-0.03097929507419318,
-0.030607140334189212,
-0.030228201261591529,
-0.029842539074224097,
-0.029450216430918635,
-0.029051297422062382,
-0.028645847559850696,
-0.028233933768240939,
-0.027815624372612906,
-0.02739098908913529,
-0.026960099013840211,
-0.026523026611407253,
-0.026079845703659447,
-0.02563063145777034,
-0.0251754603741886,
-0.024714410274276219,
-0.024247560287666999,
-0.023774990839344364,
-0.023296783636442372,
-0.022813021654769037,
-0.022323789125059244,
-0.021829171518952362,
-0.021329255534704397,
-0.020824129082630576,
-0.020313881270283371,
-0.019798602387370592,
-0.01927838389041062,
-0.018753318387132321,
-0.018223499620619192,
-0.017689022453202374,
-0.017149982850101747,
-0.016606477862823876,
-0.016058605612311514,
-0.015506465271856099,
-0.014950157049768261,
-0.014389782171814983,
-0.013825442863423302,
-0.013257242331655379,
-0.012685284746954888,
-0.012109675224673612,
-0.01153051980637421,
-0.010947925440918391,
-0.010361999965340405,
-0.009772852085510356,
-0.0091805913565902592,
-0.0085853281632873382,
-0.0079871736999047472,
-0.007386239950199147,
-0.0067826396670422843,
-0.0061764863518929082,
-0.005567894234085667,
-0.0049569782499339953,
-0.0043438540216568641,
-0.0037286378361297769,
-0.0031114466234648474,
-0.0024923979354235068,
-0.0018716099236668132,
-0.001249201317843787,
-0.00062529140352821002,
--3.2794000280400689e-017,
--0.00062655256211855987,
--0.0012542454633706326,
--0.0018829574181115063,
--0.002512566697292527,
--0.0031429511513721203,
--0.003773988233358561,
--0.0044055550219704092,
--0.005037528244919434,
--0.0056697843023050584,
--0.0063021992901196398,
--0.006934649023858026,
--0.0075670090622306741,
--0.0081991547309695281,
--0.0088309611467291028,
--0.0094623032410752553,
--0.010093055784554003,
--0.01072309341084382,
--0.011352290640977173,
--0.011980521907635806,
--0.012607661579508513,
--0.013233583985710501,
--0.013858163440257377,
--0.014481274266592936,
--0.015102790822159467,
--0.015722587523013823,
--0.016340538868478197,
--0.016956519465824167,
--0.017570404054984421,
--0.018182067533287515,
--0.01879138498020998,
--0.019398231682144329,
--0.020002483157171905,
--0.02060401517984348,
--0.021202703805956472,
--0.021798425397327525,
--0.022391056646553546,
--0.02298047460175974,
--0.023566556691323667,
--0.024149180748578844,
--0.024728225036484065,
--0.025303568272261209,
--0.025875089651992554,
--0.026442668875173242,
--0.027006186169214984,
--0.027565522313895731,
--0.028120558665750306,
--0.02867117718239736,
--0.02921726044679792,
--0.029758691691439756,
--0.030295354822444973,
--0.030827134443593161,
--0.031353915880257252,
--0.031875585203246702,
--0.032392029252553078,
--0.032903135660993593,
--0.033408792877746882,
--0.033908890191778208,
--0.034403317755147003,
--0.03489196660619346,
--0.035374728692599187,
--0.035851496894317034,
--0.036322165046365353,
--0.036786627961482528,
--0.037244781452635788,
--0.037696522355382088,
--0.038141748550073629,
--0.038580358983905001,
--0.039012253692797823,
--0.039437333823116719,
--0.039855501653213464,
--0.040266660614794128,
--0.040670715314105037,
--0.041067571552932954,
--0.041457136349415023,
--0.041839317958653949,
--0.042214025893134825,
--0.042581170942938042,
--0.042940665195744847,
--0.043292422056630996,
--0.043636356267644345,
--0.043972383927162038,
--0.044300422509022976,
--0.044620390881432243,
--0.044932209325632057,
--0.045235799554336355,
--0.045531084729924225,
--0.045817989482388799,
--0.046096439927037082,
--0.046366363681936966,
--0.04662768988510823,
--0.046880349211452385,
--0.047124273889418873,
--0.047359397717402822,
--0.047585656079871787,
--0.047802985963216638,
--0.048011325971323703,
--0.04821061634086464,
--0.048400798956300034,
--0.048581817364593854,
--0.048753616789634635,
--0.04891614414636096,
--0.049069348054587077,
--0.049213178852525637,
--0.049347588610004732,
--0.049472531141375474,
--0.049587962018107459,
--0.049693838581068871,
--0.049790119952488124,
--0.049876767047594556,
--0.049953742585934602,
--0.050021011102361276,
--0.050078538957693708,
--0.050126294349044288,
--0.050164247319810819,
--0.050192369769330704,
--0.050210635462195119,
--0.050219020037220383,
--0.050217501016074084,
--0.050206057811553975,
--0.050184671735516828,
--0.050153326006455536,
--0.050112005756721811,
--0.050060698039392837,
--0.049999391834779507,
--0.049928078056574364,
--0.049846749557637626,
--0.049755401135418875,
--0.049654029537013068,
--0.049542633463849281,
--0.049421213576010065,
--0.049289772496180245,
--0.049148314813223445,
--0.048996847085385258,
--0.048835377843120961,
--0.048663917591547333,
--0.048482478812516883,
--0.048291075966313254,
--0.048089725492967181,
--0.047878445813191339,
--0.047657257328933902,
--0.047426182423549068,
--0.047185245461584507,
--0.046934472788184661,
--0.046673892728109546,
--0.046403535584367453,
--0.046123433636462728,
--0.045833621138256668,
--0.045534134315442003,
--0.045225011362630504,
--0.044906292440053078,
--0.04457801966987341,
--0.04424023713211294,
--0.043892990860189815,
--0.04353632883606972,
--0.043170300985029976,
--0.042794959170036617,
--0.042410357185734895,
--0.042016550752053537,
--0.041613597507423702,
--0.041201557001611773,
--0.04078049068816849,
--0.040350461916493607,
--0.039911535923517615,
--0.039463779825000919,
--0.039007262606451612,
--0.038542055113663279,
--0.038068230042872152,
--0.037585861930537347,
--0.037095027142743021,
--0.036595803864225729,
--0.036088272087025856,
--0.035572513598767404,
--0.035048611970565552,
--0.034516652544564361,
--0.033976722421106297,
--0.033428910445534803,
--0.032873307194632995,
--0.032310004962697883,
--0.031739097747255092,
--0.031160681234413873,
--0.030574852783865347,
--0.029981711413526128,
--0.02938135778382921,
--0.028773894181665434,
--0.02815942450397568,
--0.027538054240999185,
--0.026909890459178243,
--0.026275041783722846,
--0.025633618380837653,
--0.024985731939614193,
--0.024331495653590687,
--0.023671024201983686,
--0.023004433730591606,
--0.022331841832376541,
--0.021653367527725977,
--0.020969131244395811,
--0.02027925479714127,
--0.019583861367036406,
--0.018883075480486514,
--0.018177022987936692,
--0.017465831042280059,
--0.016749628076968923,
--0.016028543783833667,
--0.015302709090610267,
--0.014572256138183165,
--0.013837318257546945,
--0.013098029946487271,
--0.012354526845989715,
--0.01160694571637718,
--0.010855424413181616,
--0.010100101862752517,
--0.0093411180376083026,
--0.0085786139315331567,
--0.0078127315344248497,
--0.0070436138068962059,
--0.0062714046546364843,
--0.0054962489025362138,
--0.0047182922685790624,
--0.0039376813375071491,
--0.0031545635342627941,
--0.0023690870972125429,
--0.0015814010511565431,
--0.00079165518013000959,
-3.4602770284567654e-017,
-0.00079341326913671246,
-0.0015884327307506615,
-0.0023849058398659889,
-0.0031826794312307372,
-0.0039815997476677564,
-0.0047815124685989946,
-0.0055822627387398394,
-0.0063836951969565041,
-0.0071856540052844531,
-0.0079879828780985481,
-0.0087905251114328009,
-0.0095931236124426073,
-0.010395620929005835,
-0.011197859279455415,
-0.011999680582439026,
-0.012800926486901204,
-0.0136014384021806,
-0.014401057528218322,
-0.015199624885870799,
-0.015996981347322969,
-0.016792967666594355,
-0.017587424510133884,
-0.018380192487496574,
-0.019171112182098125,
-0.019960024182039529,
-0.020746769110997123,
-0.021531187659173064,
-0.022313120614298531,
-0.023092408892685466,
-0.023868893570319856,
-0.024642415913992161,
-0.025412817412457177,
-0.02617993980761902,
-0.026943625125733582,
-0.027703715708625589,
-0.02846005424491042,
-0.029212483801217218,
-0.029960847853407434,
-0.030704990317781317,
-0.031444755582267642,
-0.032179988537589709,
-0.032910534608403125,
-0.033636239784397427,
-0.034356950651356508,
-0.03507251442217265,
-0.035782778967806315,
-0.036487592848187179,
-0.037186805343049259,
-0.03788026648269565,
-0.038567827078684919,
-0.039249338754434593,
-0.039924653975734865,
-0.040593626081167407,
-0.041256109312422309,
-0.041911958844507283,
-0.042561030815844378,
-0.0432031823582463,
-0.043838271626767927,
-0.044466157829425722,
-0.045086701256781131,
-0.045699763311379468,
-0.046305206537040323,
-0.046902894647992355,
-0.047492692557848007,
-0.048074466408410579,
-0.048648083598308751,
-0.049213412811453243,
-0.049770324045308373,
-0.050318688638974159,
-0.050858379301071885,
-0.051389270137429097,
-0.051911236678556377,
-0.052424155906911761,
-0.052927906283946134,
-0.053422367776924898,
-0.053907421885519537,
-0.054382951668163593,
-0.054848841768168455,
-0.055304978439592124,
-0.055751249572856473,
-0.056187544720107084,
-0.056613755120310832,
-0.057029773724085207,
-0.05743549521825448,
-0.057830816050127049,
-0.058215634451489987,
-0.058589850462313679,
-0.058953365954162798,
-0.059306084653308444,
-0.059647912163535828,
-0.059978755988642843,
-0.060298525554624643,
-0.060607132231539323,
-0.060904489355049551,
-0.06119051224763597,
-0.061465118239476695,
-0.061728226688989432,
-0.06197975900303053,
-0.062219638656746692,
-0.062447791213075518,
-0.062664144341889147,
-0.062868627838777696,
-0.063061173643467514,
-0.063241715857870487,
-0.063410190763759505,
-0.063566536840066468,
-0.063710694779798599,
-0.063842607506568963,
-0.063962220190737079,
-0.064069480265156076,
-0.064164337440522246,
-0.064246743720323546,
-0.064316653415382771,
-0.064374023157992372,
-0.064418811915637086,
-0.064450981004300814,
-0.064470494101354525,
-0.064477317258021624,
-0.064471418911417583,
-0.064452769896160708,
-0.064421343455550908,
-0.064377115252313044,
-0.064320063378902712,
-0.064250168367370339,
-0.064167413198782192,
-0.064071783312194056,
-0.063963266613176306,
-0.063841853481886687,
-0.063707536780688967,
-0.063560311861314805,
-0.063400176571566158,
-0.063227131261556851,
-0.063041178789489893,
-0.062842324526969626,
-0.06263057636384585,
-0.062405944712588424,
-0.062168442512190177,
-0.061918085231596726,
-0.061654890872661142,
-0.06137887997262241,
-0.061090075606105194,
-0.060788503386640706,
-0.06047419146770646,
-0.060147170543283862,
-0.059807473847932731,
-0.05945513715638135,
-0.059090198782631512,
-0.058712699578576812,
-0.058322682932134454,
-0.057920194764889084,
-0.057505283529248497,
-0.057078000205109988,
-0.056638398296037902,
-0.056186533824951396,
-0.055722465329321832,
-0.055246253855880681,
-0.054757962954836738,
-0.054257658673603638,
-0.053745409550036712,
-0.05322128660518028,
-0.052685363335525974,
-0.052137715704780353,
-0.05157842213514522,
-0.051007563498109081,
-0.050425223104751525,
-0.049831486695560187,
-0.049226442429762429,
-0.0486101808741718,
-0.047982794991550864,
-0.047344380128490494,
-0.046695034002808278,
-0.046034856690466669,
-0.045363950612011511,
-0.044682420518533987,
-0.043990373477156265,
-0.043287918856043633,
-0.042575168308943249,
-0.041852235759253488,
-0.041119237383624094,
-0.040376291595090444,
-0.039623519025742605,
-0.038861042508933012,
-0.038088987061024558,
-0.037307479862680279,
-0.036516650239699175,
-0.035716629643399202,
-0.034907551630551661,
-0.0340895518428668,
-0.033262767986037479,
-0.03242733980834081,
-0.031583409078802471,
-0.03073111956492516,
-0.0298706170099865,
-0.029002049109908539,
-0.028125565489701417,
-0.027241317679486718,
-0.026349459090102237,
-0.025450144988293295,
-0.024543532471492376,
-0.023629780442193257,
-0.022709049581921752,
-0.021781502324808296,
-0.020847302830764757,
-0.01990661695827169,
-0.018959612236779333,
-0.018006457838725502,
-0.017047324551177096,
-0.016082384747097778,
-0.015111812356247749,
-0.014135782835718457,
-0.013154473140109217,
-0.01216806169134857,
-0.011176728348167429,
-0.010180654375225083,
-0.0091800224118979562,
-0.0081750164407331967,
-0.0071658217555718787,
-0.0061526249293493342,
-0.0051356137815758551,
-0.0041149773455047391,
-0.0030909058349909771,
-0.0020635906110487651,
-0.0010332241481112773,
--3.6135703453358591e-017,
--0.0010358872343930268,
--0.0020742419457010397,
--0.0031148675489530383,
--0.0041575665187129412,
--0.0052021404244797136,
--0.0062483899663442746,
--0.0072961150108955481,
--0.0083451146273716276,
--0.009395187124047185,
--0.010446130084853006,
--0.011497740406219681,
--0.012549814334141247,
--0.013602147501449972,
--0.014654534965296085,
--0.015706771244829266,
--0.016758650359069968,
--0.017809965864968164,
--0.018860510895640382,
--0.019910078198780549,
--0.020958460175235248,
--0.02200544891773866,
--0.023050836249798673,
--0.0240944137647295,
--0.025135972864821179,
--0.026175304800640276,
--0.02721220071045587,
--0.028246451659781215,
--0.02927784868102622,
--0.030306182813251824,
--0.031331245142021368,
--0.032352826839338947,
--0.033370719203669824,
--0.034384713700033806,
--0.035394602000166496,
--0.036400176022738727,
--0.037401227973627701,
--0.038397550386233874,
--0.039388936161833567,
--0.040375178609962162,
--0.041356071488818091,
--0.042331409045683936,
--0.043300986057352442,
--0.044264597870553431,
--0.045222040442372088,
--0.046173110380653179,
--0.047117604984381119,
--0.048055322284029665,
--0.048986061081874623,
--0.04990962099225961,
--0.050825802481809415,
--0.051734406909581712,
--0.052635236567151529,
--0.053528094718618482,
--0.054412785640531043,
--0.055289114661718784,
--0.056156888203026875,
--0.057015913816943063,
--0.057866000227110526,
--0.058706957367719921,
--0.059538596422771171,
--0.06036072986519872,
--0.061173171495851948,
--0.061975736482324274,
--0.062768241397621827,
--0.063550504258665499,
--0.064322344564617162,
--0.065083583335025799,
--0.065834043147781823,
--0.066573548176874858,
--0.067301924229947421,
--0.068018998785635693,
--0.068724601030691237,
--0.069418561896875258,
--0.070100714097619504,
--0.070770892164444543,
--0.07142893248312944,
--0.072074673329625596,
--0.072707954905706612,
--0.073328619374347551,
--0.073936510894826196,
--0.074531475657539967,
--0.0751133619185297,
--0.075682020033704875,
--0.076237302492762227,
--0.076779063952791493,
--0.077307161271560662,
--0.077821453540473928,
--0.078321802117196235,
--0.07880807065793663,
--0.079280125149384095,
--0.079737833940288869,
--0.080181067772683703,
--0.08060969981273633,
--0.081023605681228822,
--0.081422663483655386,
--0.081806753839934035,
--0.082175759913723917,
--0.082529567441343196,
--0.082868064760280719,
--0.083191142837295368,
--0.083498695296096881,
--0.083790618444601811,
--0.084066811301759387,
--0.084327175623940195,
--0.084571615930882735,
--0.084800039531191251,
--0.08501235654737993,
--0.085208479940456883,
--0.085388325534042825,
--0.085551812038018871,
--0.085698861071697746,
--0.08582939718651314,
--0.085943347888222055,
--0.086040643658614427,
--0.086121217976725381,
--0.086185007339544761,
--0.086231951282218763,
--0.086261992397739254,
--0.086275076356115282,
--0.086271151923022649,
--0.086250170977926283,
--0.086212088531671269,
--0.086156862743537899,
--0.086084454937756072,
--0.085994829619475133,
--0.085887954490184673,
--0.085763800462581974,
--0.085622341674882654,
--0.085463555504569591,
--0.085287422581577177,
--0.085093926800906772,
--0.08488305533466925,
--0.084654798643551826,
--0.084409150487705142,
--0.084146107937047424,
--0.083865671380982137,
--0.083567844537526359,
--0.083252634461846692,
--0.082920051554199251,
--0.082570109567271427,
--0.082202825612922206,
--0.081818220168319036,
--0.081416317081467321,
--0.08099714357613147,
--0.080560730256144478,
--0.080107111109103887,
--0.079636323509451531,
--0.079148408220935718,
--0.078643409398453573,
--0.078121374589271708,
--0.077582354733622919,
--0.077026404164678597,
--0.076453580607894284,
--0.075863945179726833,
--0.075257562385722898,
--0.074634500117976468,
--0.073994829651955404,
--0.073338625642694694,
--0.072665966120357001,
--0.071976932485158754,
--0.071271609501661948,
--0.07055008529242987,
--0.069812451331047895,
--0.069058802434508446,
--0.06828923675495896,
--0.067503855770814566,
--0.066702764277234067,
--0.065886070375961073,
--0.065053885464527395,
--0.064206324224823225,
--0.063343504611031415,
--0.062465547836928467,
--0.061572578362550992,
--0.06066472388023067,
--0.05974211529999765,
--0.058804886734352517,
--0.057853175482410139,
--0.05688712201341492,
--0.05590686994963031,
--0.054912566048602146,
--0.053904360184799965,
--0.052882405330636137,
--0.051846857536866124,
--0.050797875912370047,
--0.04973562260331979,
--0.048660262771733132,
--0.047571964573415733,
--0.04647089913529618,
--0.045357240532154425,
--0.044231165762748055,
--0.043092854725336985,
--0.041942490192611766,
--0.04078025778602859,
--0.039606345949550356,
--0.038420945922802797,
--0.037224251713644553,
--0.036016460070157422,
--0.034797770452057598,
--0.033568385001534959,
--0.032328508513521446,
--0.031078348405394751,
--0.029818114686118356,
--0.028548019924825495,
--0.027268279218849664,
--0.025979110161204615,
--0.024680732807521484,
--0.023373369642444929,
--0.022057245545494972,
--0.020732587756396782,
--0.019399625839886411,
--0.018058591649995116,
--0.01670971929381912,
--0.0153532450947775,
--0.013989407555366637,
--0.01261844731941519,
--0.011240607133843524,
--0.0098561318099364571,
--0.0084652681841321797,
--0.0070682650783362323,
--0.0056653732597610317,
--0.00425684540030401,
--0.0028429360354649811,
--0.0014239015228121456,
-3.7361600008753361e-017,
-0.0014285086576512971,
-0.0028613628800094621,
-0.0042982994454128908,
-0.005739053524371345,
-0.0071833587236814263,
-0.0086309471309475808,
-0.010081549359504678,
-0.011534894593731464,
-0.01299071063475077,
-0.014448723946507066,
-0.015908659702217075,
-0.017370241831182541,
-0.018833193065959507,
-0.020297234989878132,
-0.021762088084902074,
-0.023227471779822664,
-0.024693104498777971,
-0.026158703710091873,
-0.027623985975421601,
-0.029088666999208927,
-0.030552461678423657,
-0.03201508415259708,
-0.033476247854129733,
-0.034935665558871211,
-0.036393049436960152,
-0.037848111103919342,
-0.039300561671993764,
-0.040750111801726135,
-0.042196471753759138,
-0.043639351440858648,
-0.045078460480145764,
-0.046513508245531715,
-0.047944203920345041,
-0.049370256550143883,
-0.050791375095703722,
-0.052207268486170702,
-0.053617645672373433,
-0.055022215680282191,
-0.056420687664609448,
-0.057812770962538895,
-0.059198175147576887,
-0.060576610083514788,
-0.061947785978495949,
-0.063311413439174638,
-0.064667203524959374,
-0.066014867802332719,
-0.067354118399234317,
-0.068684668059502491,
-0.070006230197360853,
-0.071318518951943202,
-0.072621249241845265,
-0.073914136819696385,
-0.075196898326738454,
-0.07646925134740494,
-0.077730914463888842,
-0.078981607310692106,
-0.080221050629144197,
-0.081448966321881727,
-0.082665077507280429,
-0.083869108573826998,
-0.085060785234424674,
-0.086239834580619568,
-0.087405985136740749,
-0.088558966913941869,
-0.089698511464138042,
-0.090824351933824557,
-0.091936223117769722,
-0.093033861512573063,
-0.094117005370076653,
-0.095185394750622279,
-0.096238771576142731,
-0.097276879683080242,
-0.09829946487511898,
-0.09930627497572532,
-0.10029705988048386,
-0.10127157160922029,
-0.10222956435790288,
-0.10317079455031046,
-0.1040950208894596,
-0.10500200440877976,
-0.10589150852302896,
-0.10676329907893796,
-0.10761714440557563,
-0.10845281536442443,
-0.10927008539915871,
-0.11006873058511356,
-0.110848529678438,
-0.11160926416492076,
-0.11235071830848027,
-0.11307267919931077,
-0.1137749368016731,
-0.11445728400132313,
-0.11511951665256705,
-0.11576143362493639,
-0.11638283684947157,
-0.1169835313646069,
-0.11756332536164689,
-0.11812203022982572,
-0.11865946060094119,
-0.11917543439355351,
-0.11966977285674101,
-0.12014230061340411,
-0.12059284570310912,
-0.12102123962446219,
-0.12142731737700713,
-0.1218109175026362,
-0.1221718821265082,
-0.12251005699746292,
-0.12282529152792628,
-0.12311743883329634,
-0.12338635577080283,
-0.12363190297783225,
-0.12385394490971066,
-0.1240523498769362,
-0.12422699008185362,
-0.12437774165476359,
-0.12450448468945864,
-0.12460710327817875,
-0.12468548554597891,
-0.12473952368450143,
-0.12476911398514597,
-0.12477415687162977,
-0.12475455693193147,
-0.12471022294961133,
-0.12464106793450087,
-0.12454700915275588,
-0.1244279681562649,
-0.12428387081140801,
-0.12411464732715827,
-0.1239202322825203,
-0.12370056465329937,
-0.12345558783819445,
-0.12318524968421028,
-0.12288950251138119,
-0.12256830313680171,
-0.12222161289795797,
-0.12184939767535409,
-0.12145162791442821,
-0.12102827864675307,
-0.12057932951051487,
-0.12010476477026619,
-0.11960457333594778,
-0.11907874878117335,
-0.11852728936077388,
-0.11795019802759542,
-0.11734748244854708,
-0.11671915501989298,
-0.11606523288178608,
-0.11538573793203706,
-0.11468069683911655,
-0.11395014105438499,
-0.11319410682354659,
-0.11241263519732475,
-0.1116057720413534,
-0.11077356804528271,
-0.10991607873109388,
-0.10903336446062165,
-0.10812549044227969,
-0.1071925267369875,
-0.10623454826329407,
-0.10525163480169768,
-0.10424387099815739,
-0.10321134636679469,
-0.10215415529178323,
-0.10107239702842322,
-0.099966175703400106,
-0.098835600314223504,
-0.097680784727847428,
-0.09650184767846634,
-0.095298912764489763,
-0.094072108444690078,
-0.092821568033525606,
-0.091547429695635341,
-0.090249836439505376,
-0.088928936110307111,
-0.087584881381904026,
-0.086217829748029592,
-0.084827943512632911,
-0.083415389779394319,
-0.0819803404404085,
-0.080522972164037809,
-0.079043466381932298,
-0.077542009275220897,
-0.076018791759870877,
-0.074474009471217115,
-0.072907862747663407,
-0.07132055661355359,
-0.069712300761216983,
-0.068083309532185651,
-0.066433801897588407,
-0.064764001437719335,
-0.063074136320785706,
-0.061364439280834911,
-0.059635147594861493,
-0.057886503059099939,
-0.056118751964500481,
-0.054332145071394583,
-0.052526937583348678,
-0.050703389120212196,
-0.04886176369035921,
-0.047002329662129826,
-0.045125359734470821,
-0.0432311309067821,
-0.04131992444796935,
-0.039392025864707199,
-0.037447724868918467,
-0.035487315344468147,
-0.033511095313082308,
-0.031519366899489823,
-0.029512436295795891,
-0.027490613725087369,
-0.025454213404278198,
-0.023403553506195378,
-0.021338956120914118,
-0.019260747216343556,
-0.017169256598069272,
-0.015064817868458936,
-0.012947768385032704,
-0.010818449218108652,
-0.008677205107722295,
-0.0065243844198326741,
-0.0043603391018144071,
-0.0021854246372465876,
--3.8255509286768224e-017,
--0.0021955723923673459,
--0.0044009267259028,
--0.006615693838233472,
--0.0088395012672132754,
--0.011071973300240385,
--0.013312731024233823,
--0.015561392376267044,
--0.017817572194846309,
--0.020080882271833387,
--0.022350931404998154,
--0.024627325451200395,
--0.026909667380188282,
--0.029197557329009631,
--0.031490592657026965,
--0.033788368001527139,
--0.036090475333921415,
--0.03839650401652344,
--0.040706040859901725,
--0.04301867018079384,
--0.045333973860578858,
--0.047651531404294054,
--0.049970920000194249,
--0.052291714579837834,
--0.054613487878696527,
--0.056935810497277708,
--0.059258250962749268,
--0.061580375791061369,
--0.063901749549551773,
--0.066221934920030062,
--0.068540492762326655,
--0.07085698217830233,
--0.073170960576303568,
--0.075481983736059508,
--0.077789605874004894,
--0.080093379709025747,
--0.082392856528612946,
--0.084687586255414962,
--0.086977117514182245,
--0.08926099769908917,
--0.091538773041427463,
--0.093809988677656955,
--0.096074188717807388,
--0.09833091631421656,
--0.10057971373059826,
--0.10282012241142774,
--0.10505168305163207,
--0.10727393566658044,
--0.10948641966235623,
--0.11168867390630688,
--0.11388023679785526,
--0.11606064633956631,
--0.11822944020845334,
--0.12038615582751762,
--0.12253033043750568,
--0.12466150116887664,
--0.12677920511396709,
--0.12888297939934087,
--0.13097236125831582,
--0.13304688810365137,
--0.13510609760039161,
--0.13714952773884592,
--0.1391767169077012,
--0.14118720396724999,
--0.14318052832272646,
--0.14515622999773511,
--0.14711384970776392,
--0.14905292893376812,
--0.15097300999581301,
--0.15287363612676574,
--0.15475435154602166,
--0.15661470153325666,
--0.15845423250218987,
--0.16027249207434965,
--0.16206902915282576,
--0.16384339399600037,
--0.16559513829124287,
--0.16732381522855885,
--0.16902897957417995,
--0.17071018774408273,
--0.1723669978774259,
--0.17399896990989186,
--0.17560566564692334,
--0.17718664883684032,
--0.17874148524382794,
--0.18026974272078086,
--0.18177099128199542,
--0.18324480317569403,
--0.18469075295637263,
--0.18610841755695848,
--0.18749737636076547,
--0.18885721127323704,
--0.19018750679346264,
--0.19148785008545804,
--0.1927578310491955,
--0.1939970423913745,
--0.19520507969591869,
--0.19638154149418888,
--0.19752602933490115,
--0.19863814785373529,
--0.19971750484262582,
--0.20076371131872076,
--0.20177638159299885,
--0.20275513333853187,
--0.20369958765838225,
--0.20460936915312317,
--0.2054841059879704,
--0.20632342995951453,
--0.20712697656204193,
--0.20789438505343363,
--0.20862529852063016,
--0.20931936394465242,
--0.20997623226516599,
--0.21059555844457933,
--0.21117700153166327,
--0.21172022472468263,
--0.21222489543402753,
--0.2126906853443345,
--0.21311727047608678,
--0.21350433124668197,
--0.21385155253095828,
--0.2141586237211669,
--0.21442523878638189,
--0.2146510963313355,
--0.2148358996546699,
--0.21497935680659475,
--0.21508118064594031,
--0.21514108889659578,
--0.21515880420332384,
--0.21513405418694043,
--0.21506657149885089,
--0.21495609387493222,
--0.21480236418875184,
--0.2146051305041137,
--0.21436414612692212,
--0.21407916965635404,
--0.21374996503533031,
--0.21337630160027743,
--0.21295795413016991,
--0.21249470289484507,
--0.21198633370258127,
--0.21143263794693043,
--0.21083341265279695,
--0.21018846052175402,
--0.20949758997658918,
--0.20876061520507083,
--0.20797735620292734,
--0.20714763881603129,
--0.20627129478178016,
--0.20534816176966647,
--0.2043780834210287,
--0.20336090938797693,
--0.20229649537148381,
--0.20118470315863554,
--0.2000254006590341,
--0.19881846194034486,
--0.19756376726298158,
--0.19626120311392301,
--0.19491066223965339,
--0.19351204367822172,
--0.19206525279041153,
--0.19057020129001676,
--0.18902680727321644,
--0.18743499524704191,
--0.18579469615693256,
--0.1841058474133721,
--0.18236839291760096,
--0.18058228308639965,
--0.17874747487593684,
--0.17686393180467774,
--0.17493162397534767,
--0.1729505280959456,
--0.17092062749980327,
--0.16884191216468519,
--0.16671437873092501,
--0.16453803051859453,
--0.16231287754370022,
--0.1600389365334039,
--0.15771623094026474,
--0.15534479095549586,
--0.15292465352123585,
--0.15045586234182917,
--0.14793846789411313,
--0.14537252743670831,
--0.14275810501830979,
--0.14009527148497558,
--0.13738410448641084,
--0.13462468848124437,
--0.13181711474129623,
--0.12896148135483282,
--0.12605789322880923,
--0.12310646209009551,
--0.12010730648568645,
--0.11706055178189236,
--0.11396633016251051,
--0.11082478062597502,
--0.1076360489814851,
--0.1044002878441108,
--0.10111765662887398,
--0.097788321543807066,
--0.094412455581985646,
--0.09099023851253786,
--0.087521856870628356,
--0.084007503946418594,
--0.080447379773001898,
--0.076841691113315833,
--0.073190651446030985,
--0.069494480950417728,
--0.065753406490191249,
--0.061967661596337618,
--0.058137486448918661,
--0.054263127857861596,
--0.05034483924273165,
--0.046382880611490859,
--0.042377518538244653,
--0.038329026139978219,
--0.034237683052285736,
--0.030103775404092894,
--0.025927595791377829,
--0.021709443249891311,
--0.017449623226880446,
--0.013148447551816897,
--0.0088062344061361122,
--0.0044233082919871497,
-3.8799237558144785e-017,
-0.0044633534239282109,
-0.0089664087128227005,
-0.01350881641379364,
-0.018090220924166515,
-0.022710260528575804,
-0.027368567437019611,
-0.03206476782386676,
-0.036798481867816007,
-0.041569323792798527,
-0.046376901909821133,
-0.051220818659743088,
-0.056100670656983591,
-0.06101604873415125,
-0.065966537987592153,
-0.070951717823849639,
-0.075971162007030232,
-0.081024438707069199,
-0.086111110548888314,
-0.091230734662443635,
-0.096382862733650251,
-0.10156704105618243,
-0.10678281058413981,
-0.11202970698557381,
-0.11730726069686508,
-0.12261499697794796,
-0.12795243596837114,
-0.13331909274418871,
-0.13871447737567291,
-0.14413809498584298,
-0.1495894458097978,
-0.15506802525484908,
-0.16057332396144289,
-0.16610482786486325,
-0.17166201825770855,
-0.17724437185313213,
-0.18285136084883868,
-0.18848245299182598,
-0.19413711164386607,
-0.19981479584771211,
-0.20551496039402692,
-0.21123705588901848,
-0.21698052882277755,
-0.22274482163830306,
-0.22852937280121127,
-0.23433361687011262,
-0.24015698456765072,
-0.2459989028521912,
-0.25185879499015151,
-0.25773608062895859,
-0.26363017587062959,
-0.26954049334595787,
-0.27546644228929923,
-0.28140742861394474,
-0.28736285498807085,
-0.29333212091125432,
-0.29931462279154203,
-0.30530975402306471,
-0.31131690506418214,
-0.31733546351614944,
-0.32336481420229202,
-0.32940433924768003,
-0.33545341815928698,
-0.34151142790662475,
-0.34757774300284,
-0.35365173558626223,
-0.35973277550239002,
-0.36582023038630573,
-0.37191346574550255,
-0.37801184504311691,
-0.38411472978154987,
-0.39022147958646652,
-0.39633145229116107,
-0.40244400402127672,
-0.40855848927986438,
-0.41467426103277022,
-0.42079067079433974,
-0.42690706871342377,
-0.43302280365967455,
-0.43913722331011878,
-0.44524967423599771,
-0.45135950198985531,
-0.45746605119286715,
-0.46356866562239446,
-0.46966668829975083,
-0.47575946157816845,
-0.4818463272309505,
-0.48792662653979701,
-0.49399970038329072,
-0.50006488932553006,
-0.50612153370489399,
-0.51216897372293035,
-0.51820654953334833,
-0.52423360133110464,
-0.53024946944157192,
-0.53625349440977244,
-0.54224501708966499,
-0.54822337873347315,
-0.55418792108103898,
-0.56013798644918966,
-0.56607291782110536,
-0.57199205893567162,
-0.57789475437680504,
-0.58378034966273884,
-0.58964819133525304,
-0.59549762704883813,
-0.60132800565977607,
-0.60713867731512894,
-0.61292899354161656,
-0.61869830733437547,
-0.6244459732455806,
-0.6301713474729197,
-0.63587378794790561,
-0.64155265442401355,
-0.6472073085646296,
-0.65283711403079669,
-0.65844143656874676,
-0.66401964409720282,
-0.66957110679443932,
-0.67509519718508904,
-0.68059129022667986,
-0.68605876339589056,
-0.69149699677451182,
-0.69690537313510115,
-0.70228327802631474,
-0.70763009985790626,
-0.71294522998538068,
-0.71822806279428542,
-0.72347799578413141,
-0.72869442965192843,
-0.73387676837532079,
-0.73902441929531393,
-0.74413679319857784,
-0.74921330439931222,
-0.75425337082066535,
-0.75925641407569089,
-0.7642218595478325,
-0.76914913647091965,
-0.77403767800866996,
-0.77888692133367776,
-0.78369630770588161,
-0.78846528255049797,
-0.79319329553540896,
-0.79787980064798969,
-0.8025242562713687,
-0.80712612526010452,
-0.81168487501527131,
-0.81619997755893625,
-0.82067090960802491,
-0.82509715264755579,
-0.82947819300323733,
-0.83381352191341551,
-0.83810263560035958,
-0.8423450353408759,
-0.84654022753623903,
-0.85068772378142954,
-0.85478704093366698,
-0.85883770118022873,
-0.86283923210554236,
-0.86679116675754397,
-0.8706930437132897,
-0.87454440714381054,
-0.8783448068782046,
-0.88209379846694769,
-0.88579094324442531,
-0.88943580839066294,
-0.89302796699225606,
-0.89656699810248497,
-0.90005248680060324,
-0.90348402425029883,
-0.90686120775730961,
-0.91018364082618852,
-0.91345093321621251,
-0.91666270099642011,
-0.91981856659977479,
-0.92291815887644235,
-0.9259611131461758,
-0.92894707124980036,
-0.93187568159978584,
-0.93474659922990611,
-0.93755948584397231,
-0.94031400986363323,
-0.94300984647523711,
-0.9456466776757475,
-0.94822419231770327,
-0.95074208615321865,
-0.95320006187701778,
-0.95559782916849056,
-0.95793510473277232,
-0.96021161234083285,
-0.96242708286857459,
-0.96458125433492947,
-0.96667387193895227,
-0.96870468809590071,
-0.9706734624723018,
-0.97257996201999319,
-0.9744239610091382,
-0.976205241060211,
-0.97792359117493888,
-0.9795788077662082,
-0.9811706946869192,
-0.98269906325779144,
-0.98416373229411358,
-0.98556452813143247,
-0.98690128465018023,
-0.98817384329923108,
-0.98938205311838934,
-0.99052577075980208,
-0.99160486050829288,
-0.99261919430061529,
-0.99356865174362197,
-0.99445312013134657,
-0.99527249446099619,
-0.99602667744785145,
-0.99671557953907319,
-0.99733911892641036,
-0.99789722155781213,
-0.99838982114793695,
-0.99881685918756213,
-0.99917828495188832,
-0.99947405550773982,
-0.99970413571965877,
-0.99986849825489321,
-0.99996712358727635,
-1.0,
-0.99996712358727635,
-0.99986849825489321,
-0.99970413571965877,
-0.99947405550773982,
-0.99917828495188832,
-0.99881685918756213,
-0.99838982114793695,
-0.99789722155781213,
-0.99733911892641036,
-0.99671557953907319,
-0.99602667744785145,
-0.99527249446099619,
-0.99445312013134657,
-0.99356865174362197,
-0.99261919430061529,
-0.99160486050829288,
-0.99052577075980208,
-0.98938205311838934,
-0.98817384329923108,
-0.98690128465018023,
-0.98556452813143247,
-0.98416373229411358,
-0.98269906325779144,
-0.9811706946869192,
-0.9795788077662082,
-0.97792359117493888,
-0.976205241060211,
-0.9744239610091382,
-0.97257996201999319,
-0.9706734624723018,
-0.96870468809590071,
-0.96667387193895227,
-0.96458125433492947,
-0.96242708286857459,
-0.96021161234083285,
-0.95793510473277232,
-0.95559782916849056,
-0.95320006187701778,
-0.95074208615321865,
-0.94822419231770327,
-0.9456466776757475,
-0.94300984647523711,
-0.94031400986363323,
-0.93755948584397231,
-0.93474659922990611,
-0.93187568159978584,
-0.92894707124980036,
-0.9259611131461758,
-0.92291815887644235,
-0.91981856659977479,
-0.91666270099642011,
-0.91345093321621251,
-0.91018364082618852,
-0.90686120775730961,
-0.90348402425029883,
-0.90005248680060324,
-0.89656699810248497,
-0.89302796699225606,
-0.88943580839066294,
-0.88579094324442531,
-0.88209379846694769,
-0.8783448068782046,
-0.87454440714381054,
-0.8706930437132897,
-0.86679116675754397,
-0.86283923210554236,
-0.85883770118022873,
-0.85478704093366698,
-0.85068772378142954,
-0.84654022753623903,
-0.8423450353408759,
-0.83810263560035958,
-0.83381352191341551,
-0.82947819300323733,
-0.82509715264755579,
-0.82067090960802491,
-0.81619997755893625,
-0.81168487501527131,
-0.80712612526010452,
-0.8025242562713687,
-0.79787980064798969,
-0.79319329553540896,
-0.78846528255049797,
-0.78369630770588161,
-0.77888692133367776,
-0.77403767800866996,
-0.76914913647091965,
-0.7642218595478325,
-0.75925641407569089,
-0.75425337082066535,
-0.74921330439931222,
-0.74413679319857784,
-0.73902441929531393,
-0.73387676837532079,
-0.72869442965192843,
-0.72347799578413141,
-0.71822806279428542,
-0.71294522998538068,
-0.70763009985790626,
-0.70228327802631474,
-0.69690537313510115,
-0.69149699677451182,
-0.68605876339589056,
-0.68059129022667986,
-0.67509519718508904,
-0.66957110679443932,
-0.66401964409720282,
-0.65844143656874676,
-0.65283711403079669,
-0.6472073085646296,
-0.64155265442401355,
-0.63587378794790561,
-0.6301713474729197,
-0.6244459732455806,
-0.61869830733437547,
-0.61292899354161656,
-0.60713867731512894,
-0.60132800565977607,
-0.59549762704883813,
-0.58964819133525304,
-0.58378034966273884,
-0.57789475437680504,
-0.57199205893567162,
-0.56607291782110536,
-0.56013798644918966,
-0.55418792108103898,
-0.54822337873347315,
-0.54224501708966499,
-0.53625349440977244,
-0.53024946944157192,
-0.52423360133110464,
-0.51820654953334833,
-0.51216897372293035,
-0.50612153370489399,
-0.50006488932553006,
-0.49399970038329072,
-0.48792662653979701,
-0.4818463272309505,
-0.47575946157816845,
-0.46966668829975083,
-0.46356866562239446,
-0.45746605119286715,
-0.45135950198985531,
-0.44524967423599771,
-0.43913722331011878,
-0.43302280365967455,
-0.42690706871342377,
-0.42079067079433974,
-0.41467426103277022,
-0.40855848927986438,
-0.40244400402127672,
-0.39633145229116107,
-0.39022147958646652,
-0.38411472978154987,
-0.37801184504311691,
-0.37191346574550255,
-0.36582023038630573,
-0.35973277550239002,
-0.35365173558626223,
-0.34757774300284,
-0.34151142790662475,
-0.33545341815928698,
-0.32940433924768003,
-0.32336481420229202,
-0.31733546351614944,
-0.31131690506418214,
-0.30530975402306471,
-0.29931462279154203,
-0.29333212091125432,
-0.28736285498807085,
-0.28140742861394474,
-0.27546644228929923,
-0.26954049334595787,
-0.26363017587062959,
-0.25773608062895859,
-0.25185879499015151,
-0.2459989028521912,
-0.24015698456765072,
-0.23433361687011262,
-0.22852937280121127,
-0.22274482163830306,
-0.21698052882277755,
-0.21123705588901848,
-0.20551496039402692,
-0.19981479584771211,
-0.19413711164386607,
-0.18848245299182598,
-0.18285136084883868,
-0.17724437185313213,
-0.17166201825770855,
-0.16610482786486325,
-0.16057332396144289,
-0.15506802525484908,
-0.1495894458097978,
-0.14413809498584298,
-0.13871447737567291,
-0.13331909274418871,
-0.12795243596837114,
-0.12261499697794796,
-0.11730726069686508,
-0.11202970698557381,
-0.10678281058413981,
-0.10156704105618243,
-0.096382862733650251,
-0.091230734662443635,
-0.086111110548888314,
-0.081024438707069199,
-0.075971162007030232,
-0.070951717823849639,
-0.065966537987592153,
-0.06101604873415125,
-0.056100670656983591,
-0.051220818659743088,
-0.046376901909821133,
-0.041569323792798527,
-0.036798481867816007,
-0.03206476782386676,
-0.027368567437019611,
-0.022710260528575804,
-0.018090220924166515,
-0.01350881641379364,
-0.0089664087128227005,
-0.0044633534239282109,
-3.8799237558144785e-017,
--0.0044233082919871497,
--0.0088062344061361122,
--0.013148447551816897,
--0.017449623226880446,
--0.021709443249891311,
--0.025927595791377829,
--0.030103775404092894,
--0.034237683052285736,
--0.038329026139978219,
--0.042377518538244653,
--0.046382880611490859,
--0.05034483924273165,
--0.054263127857861596,
--0.058137486448918661,
--0.061967661596337618,
--0.065753406490191249,
--0.069494480950417728,
--0.073190651446030985,
--0.076841691113315833,
--0.080447379773001898,
--0.084007503946418594,
--0.087521856870628356,
--0.09099023851253786,
--0.094412455581985646,
--0.097788321543807066,
--0.10111765662887398,
--0.1044002878441108,
--0.1076360489814851,
--0.11082478062597502,
--0.11396633016251051,
--0.11706055178189236,
--0.12010730648568645,
--0.12310646209009551,
--0.12605789322880923,
--0.12896148135483282,
--0.13181711474129623,
--0.13462468848124437,
--0.13738410448641084,
--0.14009527148497558,
--0.14275810501830979,
--0.14537252743670831,
--0.14793846789411313,
--0.15045586234182917,
--0.15292465352123585,
--0.15534479095549586,
--0.15771623094026474,
--0.1600389365334039,
--0.16231287754370022,
--0.16453803051859453,
--0.16671437873092501,
--0.16884191216468519,
--0.17092062749980327,
--0.1729505280959456,
--0.17493162397534767,
--0.17686393180467774,
--0.17874747487593684,
--0.18058228308639965,
--0.18236839291760096,
--0.1841058474133721,
--0.18579469615693256,
--0.18743499524704191,
--0.18902680727321644,
--0.19057020129001676,
--0.19206525279041153,
--0.19351204367822172,
--0.19491066223965339,
--0.19626120311392301,
--0.19756376726298158,
--0.19881846194034486,
--0.2000254006590341,
--0.20118470315863554,
--0.20229649537148381,
--0.20336090938797693,
--0.2043780834210287,
--0.20534816176966647,
--0.20627129478178016,
--0.20714763881603129,
--0.20797735620292734,
--0.20876061520507083,
--0.20949758997658918,
--0.21018846052175402,
--0.21083341265279695,
--0.21143263794693043,
--0.21198633370258127,
--0.21249470289484507,
--0.21295795413016991,
--0.21337630160027743,
--0.21374996503533031,
--0.21407916965635404,
--0.21436414612692212,
--0.2146051305041137,
--0.21480236418875184,
--0.21495609387493222,
--0.21506657149885089,
--0.21513405418694043,
--0.21515880420332384,
--0.21514108889659578,
--0.21508118064594031,
--0.21497935680659475,
--0.2148358996546699,
--0.2146510963313355,
--0.21442523878638189,
--0.2141586237211669,
--0.21385155253095828,
--0.21350433124668197,
--0.21311727047608678,
--0.2126906853443345,
--0.21222489543402753,
--0.21172022472468263,
--0.21117700153166327,
--0.21059555844457933,
--0.20997623226516599,
--0.20931936394465242,
--0.20862529852063016,
--0.20789438505343363,
--0.20712697656204193,
--0.20632342995951453,
--0.2054841059879704,
--0.20460936915312317,
--0.20369958765838225,
--0.20275513333853187,
--0.20177638159299885,
--0.20076371131872076,
--0.19971750484262582,
--0.19863814785373529,
--0.19752602933490115,
--0.19638154149418888,
--0.19520507969591869,
--0.1939970423913745,
--0.1927578310491955,
--0.19148785008545804,
--0.19018750679346264,
--0.18885721127323704,
--0.18749737636076547,
--0.18610841755695848,
--0.18469075295637263,
--0.18324480317569403,
--0.18177099128199542,
--0.18026974272078086,
--0.17874148524382794,
--0.17718664883684032,
--0.17560566564692334,
--0.17399896990989186,
--0.1723669978774259,
--0.17071018774408273,
--0.16902897957417995,
--0.16732381522855885,
--0.16559513829124287,
--0.16384339399600037,
--0.16206902915282576,
--0.16027249207434965,
--0.15845423250218987,
--0.15661470153325666,
--0.15475435154602166,
--0.15287363612676574,
--0.15097300999581301,
--0.14905292893376812,
--0.14711384970776392,
--0.14515622999773511,
--0.14318052832272646,
--0.14118720396724999,
--0.1391767169077012,
--0.13714952773884592,
--0.13510609760039161,
--0.13304688810365137,
--0.13097236125831582,
--0.12888297939934087,
--0.12677920511396709,
--0.12466150116887664,
--0.12253033043750568,
--0.12038615582751762,
--0.11822944020845334,
--0.11606064633956631,
--0.11388023679785526,
--0.11168867390630688,
--0.10948641966235623,
--0.10727393566658044,
--0.10505168305163207,
--0.10282012241142774,
--0.10057971373059826,
--0.09833091631421656,
--0.096074188717807388,
--0.093809988677656955,
--0.091538773041427463,
--0.08926099769908917,
--0.086977117514182245,
--0.084687586255414962,
--0.082392856528612946,
--0.080093379709025747,
--0.077789605874004894,
--0.075481983736059508,
--0.073170960576303568,
--0.07085698217830233,
--0.068540492762326655,
--0.066221934920030062,
--0.063901749549551773,
--0.061580375791061369,
--0.059258250962749268,
--0.056935810497277708,
--0.054613487878696527,
--0.052291714579837834,
--0.049970920000194249,
--0.047651531404294054,
--0.045333973860578858,
--0.04301867018079384,
--0.040706040859901725,
--0.03839650401652344,
--0.036090475333921415,
--0.033788368001527139,
--0.031490592657026965,
--0.029197557329009631,
--0.026909667380188282,
--0.024627325451200395,
--0.022350931404998154,
--0.020080882271833387,
--0.017817572194846309,
--0.015561392376267044,
--0.013312731024233823,
--0.011071973300240385,
--0.0088395012672132754,
--0.006615693838233472,
--0.0044009267259028,
--0.0021955723923673459,
--3.8255509286768224e-017,
-0.0021854246372465876,
-0.0043603391018144071,
-0.0065243844198326741,
-0.008677205107722295,
-0.010818449218108652,
-0.012947768385032704,
-0.015064817868458936,
-0.017169256598069272,
-0.019260747216343556,
-0.021338956120914118,
-0.023403553506195378,
-0.025454213404278198,
-0.027490613725087369,
-0.029512436295795891,
-0.031519366899489823,
-0.033511095313082308,
-0.035487315344468147,
-0.037447724868918467,
-0.039392025864707199,
-0.04131992444796935,
-0.0432311309067821,
-0.045125359734470821,
-0.047002329662129826,
-0.04886176369035921,
-0.050703389120212196,
-0.052526937583348678,
-0.054332145071394583,
-0.056118751964500481,
-0.057886503059099939,
-0.059635147594861493,
-0.061364439280834911,
-0.063074136320785706,
-0.064764001437719335,
-0.066433801897588407,
-0.068083309532185651,
-0.069712300761216983,
-0.07132055661355359,
-0.072907862747663407,
-0.074474009471217115,
-0.076018791759870877,
-0.077542009275220897,
-0.079043466381932298,
-0.080522972164037809,
-0.0819803404404085,
-0.083415389779394319,
-0.084827943512632911,
-0.086217829748029592,
-0.087584881381904026,
-0.088928936110307111,
-0.090249836439505376,
-0.091547429695635341,
-0.092821568033525606,
-0.094072108444690078,
-0.095298912764489763,
-0.09650184767846634,
-0.097680784727847428,
-0.098835600314223504,
-0.099966175703400106,
-0.10107239702842322,
-0.10215415529178323,
-0.10321134636679469,
-0.10424387099815739,
-0.10525163480169768,
-0.10623454826329407,
-0.1071925267369875,
-0.10812549044227969,
-0.10903336446062165,
-0.10991607873109388,
-0.11077356804528271,
-0.1116057720413534,
-0.11241263519732475,
-0.11319410682354659,
-0.11395014105438499,
-0.11468069683911655,
-0.11538573793203706,
-0.11606523288178608,
-0.11671915501989298,
-0.11734748244854708,
-0.11795019802759542,
-0.11852728936077388,
-0.11907874878117335,
-0.11960457333594778,
-0.12010476477026619,
-0.12057932951051487,
-0.12102827864675307,
-0.12145162791442821,
-0.12184939767535409,
-0.12222161289795797,
-0.12256830313680171,
-0.12288950251138119,
-0.12318524968421028,
-0.12345558783819445,
-0.12370056465329937,
-0.1239202322825203,
-0.12411464732715827,
-0.12428387081140801,
-0.1244279681562649,
-0.12454700915275588,
-0.12464106793450087,
-0.12471022294961133,
-0.12475455693193147,
-0.12477415687162977,
-0.12476911398514597,
-0.12473952368450143,
-0.12468548554597891,
-0.12460710327817875,
-0.12450448468945864,
-0.12437774165476359,
-0.12422699008185362,
-0.1240523498769362,
-0.12385394490971066,
-0.12363190297783225,
-0.12338635577080283,
-0.12311743883329634,
-0.12282529152792628,
-0.12251005699746292,
-0.1221718821265082,
-0.1218109175026362,
-0.12142731737700713,
-0.12102123962446219,
-0.12059284570310912,
-0.12014230061340411,
-0.11966977285674101,
-0.11917543439355351,
-0.11865946060094119,
-0.11812203022982572,
-0.11756332536164689,
-0.1169835313646069,
-0.11638283684947157,
-0.11576143362493639,
-0.11511951665256705,
-0.11445728400132313,
-0.1137749368016731,
-0.11307267919931077,
-0.11235071830848027,
-0.11160926416492076,
-0.110848529678438,
-0.11006873058511356,
-0.10927008539915871,
-0.10845281536442443,
-0.10761714440557563,
-0.10676329907893796,
-0.10589150852302896,
-0.10500200440877976,
-0.1040950208894596,
-0.10317079455031046,
-0.10222956435790288,
-0.10127157160922029,
-0.10029705988048386,
-0.09930627497572532,
-0.09829946487511898,
-0.097276879683080242,
-0.096238771576142731,
-0.095185394750622279,
-0.094117005370076653,
-0.093033861512573063,
-0.091936223117769722,
-0.090824351933824557,
-0.089698511464138042,
-0.088558966913941869,
-0.087405985136740749,
-0.086239834580619568,
-0.085060785234424674,
-0.083869108573826998,
-0.082665077507280429,
-0.081448966321881727,
-0.080221050629144197,
-0.078981607310692106,
-0.077730914463888842,
-0.07646925134740494,
-0.075196898326738454,
-0.073914136819696385,
-0.072621249241845265,
-0.071318518951943202,
-0.070006230197360853,
-0.068684668059502491,
-0.067354118399234317,
-0.066014867802332719,
-0.064667203524959374,
-0.063311413439174638,
-0.061947785978495949,
-0.060576610083514788,
-0.059198175147576887,
-0.057812770962538895,
-0.056420687664609448,
-0.055022215680282191,
-0.053617645672373433,
-0.052207268486170702,
-0.050791375095703722,
-0.049370256550143883,
-0.047944203920345041,
-0.046513508245531715,
-0.045078460480145764,
-0.043639351440858648,
-0.042196471753759138,
-0.040750111801726135,
-0.039300561671993764,
-0.037848111103919342,
-0.036393049436960152,
-0.034935665558871211,
-0.033476247854129733,
-0.03201508415259708,
-0.030552461678423657,
-0.029088666999208927,
-0.027623985975421601,
-0.026158703710091873,
-0.024693104498777971,
-0.023227471779822664,
-0.021762088084902074,
-0.020297234989878132,
-0.018833193065959507,
-0.017370241831182541,
-0.015908659702217075,
-0.014448723946507066,
-0.01299071063475077,
-0.011534894593731464,
-0.010081549359504678,
-0.0086309471309475808,
-0.0071833587236814263,
-0.005739053524371345,
-0.0042982994454128908,
-0.0028613628800094621,
-0.0014285086576512971,
-3.7361600008753361e-017,
--0.0014239015228121456,
--0.0028429360354649811,
--0.00425684540030401,
--0.0056653732597610317,
--0.0070682650783362323,
--0.0084652681841321797,
--0.0098561318099364571,
--0.011240607133843524,
--0.01261844731941519,
--0.013989407555366637,
--0.0153532450947775,
--0.01670971929381912,
--0.018058591649995116,
--0.019399625839886411,
--0.020732587756396782,
--0.022057245545494972,
--0.023373369642444929,
--0.024680732807521484,
--0.025979110161204615,
--0.027268279218849664,
--0.028548019924825495,
--0.029818114686118356,
--0.031078348405394751,
--0.032328508513521446,
--0.033568385001534959,
--0.034797770452057598,
--0.036016460070157422,
--0.037224251713644553,
--0.038420945922802797,
--0.039606345949550356,
--0.04078025778602859,
--0.041942490192611766,
--0.043092854725336985,
--0.044231165762748055,
--0.045357240532154425,
--0.04647089913529618,
--0.047571964573415733,
--0.048660262771733132,
--0.04973562260331979,
--0.050797875912370047,
--0.051846857536866124,
--0.052882405330636137,
--0.053904360184799965,
--0.054912566048602146,
--0.05590686994963031,
--0.05688712201341492,
--0.057853175482410139,
--0.058804886734352517,
--0.05974211529999765,
--0.06066472388023067,
--0.061572578362550992,
--0.062465547836928467,
--0.063343504611031415,
--0.064206324224823225,
--0.065053885464527395,
--0.065886070375961073,
--0.066702764277234067,
--0.067503855770814566,
--0.06828923675495896,
--0.069058802434508446,
--0.069812451331047895,
--0.07055008529242987,
--0.071271609501661948,
--0.071976932485158754,
--0.072665966120357001,
--0.073338625642694694,
--0.073994829651955404,
--0.074634500117976468,
--0.075257562385722898,
--0.075863945179726833,
--0.076453580607894284,
--0.077026404164678597,
--0.077582354733622919,
--0.078121374589271708,
--0.078643409398453573,
--0.079148408220935718,
--0.079636323509451531,
--0.080107111109103887,
--0.080560730256144478,
--0.08099714357613147,
--0.081416317081467321,
--0.081818220168319036,
--0.082202825612922206,
--0.082570109567271427,
--0.082920051554199251,
--0.083252634461846692,
--0.083567844537526359,
--0.083865671380982137,
--0.084146107937047424,
--0.084409150487705142,
--0.084654798643551826,
--0.08488305533466925,
--0.085093926800906772,
--0.085287422581577177,
--0.085463555504569591,
--0.085622341674882654,
--0.085763800462581974,
--0.085887954490184673,
--0.085994829619475133,
--0.086084454937756072,
--0.086156862743537899,
--0.086212088531671269,
--0.086250170977926283,
--0.086271151923022649,
--0.086275076356115282,
--0.086261992397739254,
--0.086231951282218763,
--0.086185007339544761,
--0.086121217976725381,
--0.086040643658614427,
--0.085943347888222055,
--0.08582939718651314,
--0.085698861071697746,
--0.085551812038018871,
--0.085388325534042825,
--0.085208479940456883,
--0.08501235654737993,
--0.084800039531191251,
--0.084571615930882735,
--0.084327175623940195,
--0.084066811301759387,
--0.083790618444601811,
--0.083498695296096881,
--0.083191142837295368,
--0.082868064760280719,
--0.082529567441343196,
--0.082175759913723917,
--0.081806753839934035,
--0.081422663483655386,
--0.081023605681228822,
--0.08060969981273633,
--0.080181067772683703,
--0.079737833940288869,
--0.079280125149384095,
--0.07880807065793663,
--0.078321802117196235,
--0.077821453540473928,
--0.077307161271560662,
--0.076779063952791493,
--0.076237302492762227,
--0.075682020033704875,
--0.0751133619185297,
--0.074531475657539967,
--0.073936510894826196,
--0.073328619374347551,
--0.072707954905706612,
--0.072074673329625596,
--0.07142893248312944,
--0.070770892164444543,
--0.070100714097619504,
--0.069418561896875258,
--0.068724601030691237,
--0.068018998785635693,
--0.067301924229947421,
--0.066573548176874858,
--0.065834043147781823,
--0.065083583335025799,
--0.064322344564617162,
--0.063550504258665499,
--0.062768241397621827,
--0.061975736482324274,
--0.061173171495851948,
--0.06036072986519872,
--0.059538596422771171,
--0.058706957367719921,
--0.057866000227110526,
--0.057015913816943063,
--0.056156888203026875,
--0.055289114661718784,
--0.054412785640531043,
--0.053528094718618482,
--0.052635236567151529,
--0.051734406909581712,
--0.050825802481809415,
--0.04990962099225961,
--0.048986061081874623,
--0.048055322284029665,
--0.047117604984381119,
--0.046173110380653179,
--0.045222040442372088,
--0.044264597870553431,
--0.043300986057352442,
--0.042331409045683936,
--0.041356071488818091,
--0.040375178609962162,
--0.039388936161833567,
--0.038397550386233874,
--0.037401227973627701,
--0.036400176022738727,
--0.035394602000166496,
--0.034384713700033806,
--0.033370719203669824,
--0.032352826839338947,
--0.031331245142021368,
--0.030306182813251824,
--0.02927784868102622,
--0.028246451659781215,
--0.02721220071045587,
--0.026175304800640276,
--0.025135972864821179,
--0.0240944137647295,
--0.023050836249798673,
--0.02200544891773866,
--0.020958460175235248,
--0.019910078198780549,
--0.018860510895640382,
--0.017809965864968164,
--0.016758650359069968,
--0.015706771244829266,
--0.014654534965296085,
--0.013602147501449972,
--0.012549814334141247,
--0.011497740406219681,
--0.010446130084853006,
--0.009395187124047185,
--0.0083451146273716276,
--0.0072961150108955481,
--0.0062483899663442746,
--0.0052021404244797136,
--0.0041575665187129412,
--0.0031148675489530383,
--0.0020742419457010397,
--0.0010358872343930268,
--3.6135703453358591e-017,
-0.0010332241481112773,
-0.0020635906110487651,
-0.0030909058349909771,
-0.0041149773455047391,
-0.0051356137815758551,
-0.0061526249293493342,
-0.0071658217555718787,
-0.0081750164407331967,
-0.0091800224118979562,
-0.010180654375225083,
-0.011176728348167429,
-0.01216806169134857,
-0.013154473140109217,
-0.014135782835718457,
-0.015111812356247749,
-0.016082384747097778,
-0.017047324551177096,
-0.018006457838725502,
-0.018959612236779333,
-0.01990661695827169,
-0.020847302830764757,
-0.021781502324808296,
-0.022709049581921752,
-0.023629780442193257,
-0.024543532471492376,
-0.025450144988293295,
-0.026349459090102237,
-0.027241317679486718,
-0.028125565489701417,
-0.029002049109908539,
-0.0298706170099865,
-0.03073111956492516,
-0.031583409078802471,
-0.03242733980834081,
-0.033262767986037479,
-0.0340895518428668,
-0.034907551630551661,
-0.035716629643399202,
-0.036516650239699175,
-0.037307479862680279,
-0.038088987061024558,
-0.038861042508933012,
-0.039623519025742605,
-0.040376291595090444,
-0.041119237383624094,
-0.041852235759253488,
-0.042575168308943249,
-0.043287918856043633,
-0.043990373477156265,
-0.044682420518533987,
-0.045363950612011511,
-0.046034856690466669,
-0.046695034002808278,
-0.047344380128490494,
-0.047982794991550864,
-0.0486101808741718,
-0.049226442429762429,
-0.049831486695560187,
-0.050425223104751525,
-0.051007563498109081,
-0.05157842213514522,
-0.052137715704780353,
-0.052685363335525974,
-0.05322128660518028,
-0.053745409550036712,
-0.054257658673603638,
-0.054757962954836738,
-0.055246253855880681,
-0.055722465329321832,
-0.056186533824951396,
-0.056638398296037902,
-0.057078000205109988,
-0.057505283529248497,
-0.057920194764889084,
-0.058322682932134454,
-0.058712699578576812,
-0.059090198782631512,
-0.05945513715638135,
-0.059807473847932731,
-0.060147170543283862,
-0.06047419146770646,
-0.060788503386640706,
-0.061090075606105194,
-0.06137887997262241,
-0.061654890872661142,
-0.061918085231596726,
-0.062168442512190177,
-0.062405944712588424,
-0.06263057636384585,
-0.062842324526969626,
-0.063041178789489893,
-0.063227131261556851,
-0.063400176571566158,
-0.063560311861314805,
-0.063707536780688967,
-0.063841853481886687,
-0.063963266613176306,
-0.064071783312194056,
-0.064167413198782192,
-0.064250168367370339,
-0.064320063378902712,
-0.064377115252313044,
-0.064421343455550908,
-0.064452769896160708,
-0.064471418911417583,
-0.064477317258021624,
-0.064470494101354525,
-0.064450981004300814,
-0.064418811915637086,
-0.064374023157992372,
-0.064316653415382771,
-0.064246743720323546,
-0.064164337440522246,
-0.064069480265156076,
-0.063962220190737079,
-0.063842607506568963,
-0.063710694779798599,
-0.063566536840066468,
-0.063410190763759505,
-0.063241715857870487,
-0.063061173643467514,
-0.062868627838777696,
-0.062664144341889147,
-0.062447791213075518,
-0.062219638656746692,
-0.06197975900303053,
-0.061728226688989432,
-0.061465118239476695,
-0.06119051224763597,
-0.060904489355049551,
-0.060607132231539323,
-0.060298525554624643,
-0.059978755988642843,
-0.059647912163535828,
-0.059306084653308444,
-0.058953365954162798,
-0.058589850462313679,
-0.058215634451489987,
-0.057830816050127049,
-0.05743549521825448,
-0.057029773724085207,
-0.056613755120310832,
-0.056187544720107084,
-0.055751249572856473,
-0.055304978439592124,
-0.054848841768168455,
-0.054382951668163593,
-0.053907421885519537,
-0.053422367776924898,
-0.052927906283946134,
-0.052424155906911761,
-0.051911236678556377,
-0.051389270137429097,
-0.050858379301071885,
-0.050318688638974159,
-0.049770324045308373,
-0.049213412811453243,
-0.048648083598308751,
-0.048074466408410579,
-0.047492692557848007,
-0.046902894647992355,
-0.046305206537040323,
-0.045699763311379468,
-0.045086701256781131,
-0.044466157829425722,
-0.043838271626767927,
-0.0432031823582463,
-0.042561030815844378,
-0.041911958844507283,
-0.041256109312422309,
-0.040593626081167407,
-0.039924653975734865,
-0.039249338754434593,
-0.038567827078684919,
-0.03788026648269565,
-0.037186805343049259,
-0.036487592848187179,
-0.035782778967806315,
-0.03507251442217265,
-0.034356950651356508,
-0.033636239784397427,
-0.032910534608403125,
-0.032179988537589709,
-0.031444755582267642,
-0.030704990317781317,
-0.029960847853407434,
-0.029212483801217218,
-0.02846005424491042,
-0.027703715708625589,
-0.026943625125733582,
-0.02617993980761902,
-0.025412817412457177,
-0.024642415913992161,
-0.023868893570319856,
-0.023092408892685466,
-0.022313120614298531,
-0.021531187659173064,
-0.020746769110997123,
-0.019960024182039529,
-0.019171112182098125,
-0.018380192487496574,
-0.017587424510133884,
-0.016792967666594355,
-0.015996981347322969,
-0.015199624885870799,
-0.014401057528218322,
-0.0136014384021806,
-0.012800926486901204,
-0.011999680582439026,
-0.011197859279455415,
-0.010395620929005835,
-0.0095931236124426073,
-0.0087905251114328009,
-0.0079879828780985481,
-0.0071856540052844531,
-0.0063836951969565041,
-0.0055822627387398394,
-0.0047815124685989946,
-0.0039815997476677564,
-0.0031826794312307372,
-0.0023849058398659889,
-0.0015884327307506615,
-0.00079341326913671246,
-3.4602770284567654e-017,
--0.00079165518013000959,
--0.0015814010511565431,
--0.0023690870972125429,
--0.0031545635342627941,
--0.0039376813375071491,
--0.0047182922685790624,
--0.0054962489025362138,
--0.0062714046546364843,
--0.0070436138068962059,
--0.0078127315344248497,
--0.0085786139315331567,
--0.0093411180376083026,
--0.010100101862752517,
--0.010855424413181616,
--0.01160694571637718,
--0.012354526845989715,
--0.013098029946487271,
--0.013837318257546945,
--0.014572256138183165,
--0.015302709090610267,
--0.016028543783833667,
--0.016749628076968923,
--0.017465831042280059,
--0.018177022987936692,
--0.018883075480486514,
--0.019583861367036406,
--0.02027925479714127,
--0.020969131244395811,
--0.021653367527725977,
--0.022331841832376541,
--0.023004433730591606,
--0.023671024201983686,
--0.024331495653590687,
--0.024985731939614193,
--0.025633618380837653,
--0.026275041783722846,
--0.026909890459178243,
--0.027538054240999185,
--0.02815942450397568,
--0.028773894181665434,
--0.02938135778382921,
--0.029981711413526128,
--0.030574852783865347,
--0.031160681234413873,
--0.031739097747255092,
--0.032310004962697883,
--0.032873307194632995,
--0.033428910445534803,
--0.033976722421106297,
--0.034516652544564361,
--0.035048611970565552,
--0.035572513598767404,
--0.036088272087025856,
--0.036595803864225729,
--0.037095027142743021,
--0.037585861930537347,
--0.038068230042872152,
--0.038542055113663279,
--0.039007262606451612,
--0.039463779825000919,
--0.039911535923517615,
--0.040350461916493607,
--0.04078049068816849,
--0.041201557001611773,
--0.041613597507423702,
--0.042016550752053537,
--0.042410357185734895,
--0.042794959170036617,
--0.043170300985029976,
--0.04353632883606972,
--0.043892990860189815,
--0.04424023713211294,
--0.04457801966987341,
--0.044906292440053078,
--0.045225011362630504,
--0.045534134315442003,
--0.045833621138256668,
--0.046123433636462728,
--0.046403535584367453,
--0.046673892728109546,
--0.046934472788184661,
--0.047185245461584507,
--0.047426182423549068,
--0.047657257328933902,
--0.047878445813191339,
--0.048089725492967181,
--0.048291075966313254,
--0.048482478812516883,
--0.048663917591547333,
--0.048835377843120961,
--0.048996847085385258,
--0.049148314813223445,
--0.049289772496180245,
--0.049421213576010065,
--0.049542633463849281,
--0.049654029537013068,
--0.049755401135418875,
--0.049846749557637626,
--0.049928078056574364,
--0.049999391834779507,
--0.050060698039392837,
--0.050112005756721811,
--0.050153326006455536,
--0.050184671735516828,
--0.050206057811553975,
--0.050217501016074084,
--0.050219020037220383,
--0.050210635462195119,
--0.050192369769330704,
--0.050164247319810819,
--0.050126294349044288,
--0.050078538957693708,
--0.050021011102361276,
--0.049953742585934602,
--0.049876767047594556,
--0.049790119952488124,
--0.049693838581068871,
--0.049587962018107459,
--0.049472531141375474,
--0.049347588610004732,
--0.049213178852525637,
--0.049069348054587077,
--0.04891614414636096,
--0.048753616789634635,
--0.048581817364593854,
--0.048400798956300034,
--0.04821061634086464,
--0.048011325971323703,
--0.047802985963216638,
--0.047585656079871787,
--0.047359397717402822,
--0.047124273889418873,
--0.046880349211452385,
--0.04662768988510823,
--0.046366363681936966,
--0.046096439927037082,
--0.045817989482388799,
--0.045531084729924225,
--0.045235799554336355,
--0.044932209325632057,
--0.044620390881432243,
--0.044300422509022976,
--0.043972383927162038,
--0.043636356267644345,
--0.043292422056630996,
--0.042940665195744847,
--0.042581170942938042,
--0.042214025893134825,
--0.041839317958653949,
--0.041457136349415023,
--0.041067571552932954,
--0.040670715314105037,
--0.040266660614794128,
--0.039855501653213464,
--0.039437333823116719,
--0.039012253692797823,
--0.038580358983905001,
--0.038141748550073629,
--0.037696522355382088,
--0.037244781452635788,
--0.036786627961482528,
--0.036322165046365353,
--0.035851496894317034,
--0.035374728692599187,
--0.03489196660619346,
--0.034403317755147003,
--0.033908890191778208,
--0.033408792877746882,
--0.032903135660993593,
--0.032392029252553078,
--0.031875585203246702,
--0.031353915880257252,
--0.030827134443593161,
--0.030295354822444973,
--0.029758691691439756,
--0.02921726044679792,
--0.02867117718239736,
--0.028120558665750306,
--0.027565522313895731,
--0.027006186169214984,
--0.026442668875173242,
--0.025875089651992554,
--0.025303568272261209,
--0.024728225036484065,
--0.024149180748578844,
--0.023566556691323667,
--0.02298047460175974,
--0.022391056646553546,
--0.021798425397327525,
--0.021202703805956472,
--0.02060401517984348,
--0.020002483157171905,
--0.019398231682144329,
--0.01879138498020998,
--0.018182067533287515,
--0.017570404054984421,
--0.016956519465824167,
--0.016340538868478197,
--0.015722587523013823,
--0.015102790822159467,
--0.014481274266592936,
--0.013858163440257377,
--0.013233583985710501,
--0.012607661579508513,
--0.011980521907635806,
--0.011352290640977173,
--0.01072309341084382,
--0.010093055784554003,
--0.0094623032410752553,
--0.0088309611467291028,
--0.0081991547309695281,
--0.0075670090622306741,
--0.006934649023858026,
--0.0063021992901196398,
--0.0056697843023050584,
--0.005037528244919434,
--0.0044055550219704092,
--0.003773988233358561,
--0.0031429511513721203,
--0.002512566697292527,
--0.0018829574181115063,
--0.0012542454633706326,
--0.00062655256211855987,
--3.2794000280400689e-017,
-0.00062529140352821002,
-0.001249201317843787,
-0.0018716099236668132,
-0.0024923979354235068,
-0.0031114466234648474,
-0.0037286378361297769,
-0.0043438540216568641,
-0.0049569782499339953,
-0.005567894234085667,
-0.0061764863518929082,
-0.0067826396670422843,
-0.007386239950199147,
-0.0079871736999047472,
-0.0085853281632873382,
-0.0091805913565902592,
-0.009772852085510356,
-0.010361999965340405,
-0.010947925440918391,
-0.01153051980637421,
-0.012109675224673612,
-0.012685284746954888,
-0.013257242331655379,
-0.013825442863423302,
-0.014389782171814983,
-0.014950157049768261,
-0.015506465271856099,
-0.016058605612311514,
-0.016606477862823876,
-0.017149982850101747,
-0.017689022453202374,
-0.018223499620619192,
-0.018753318387132321,
-0.01927838389041062,
-0.019798602387370592,
-0.020313881270283371,
-0.020824129082630576,
-0.021329255534704397,
-0.021829171518952362,
-0.022323789125059244,
-0.022813021654769037,
-0.023296783636442372,
-0.023774990839344364,
-0.024247560287666999,
-0.024714410274276219,
-0.0251754603741886,
-0.02563063145777034,
-0.026079845703659447,
-0.026523026611407253,
-0.026960099013840211,
-0.02739098908913529,
-0.027815624372612906,
-0.028233933768240939,
-0.028645847559850696,
-0.029051297422062382,
-0.029450216430918635,
-0.029842539074224097,
-0.030228201261591529,
-0.030607140334189212,
-0.03097929507419318,
-0.031344605713938829,
-0.031703013944773227,
-0.03205446292560532,
-0.03239889729115536,
-0.03273626315989854,
-0.033066508141706884,
-0.033389581345183425,
-0.033705433384691758,
-0.034014016387078808,
-0.034315283998088343,
-0.034609191388468012,
-0.034895695259766359,
-0.035174753849820745,
-0.035446326937934924,
-0.035710375849747317,
-0.035966863461786819,
-0.03621575420571934,
-0.036457014072281906,
-0.036690610614905812,
-0.03691651295302803,
-0.037134691775091121,
-0.03734511934123122,
-0.03754776948565524,
-0.037742617618705371,
-0.037929640728613732,
-0.038108817382944915,
-0.038280127729728552,
-0.038443553498280936,
-0.03859907799971761,
-0.038746686127155303,
-0.038886364355606329,
-0.03901810074156354,
-0.039141884922278339,
-0.039257708114731872,
-0.039365563114299278,
-0.039465444293109726,
-0.039557347598101263,
-0.03964127054877252,
-0.039717212234631899,
-0.039785173312345566,
-0.039845156002584842,
-0.039897164086574899,
-0.039941202902345173,
-0.039977279340683743,
-0.04000540184079595,
-0.040025580385669689,
-0.040037826497147835,
-0.040042153230710371,
-0.040038575169966686,
-0.040027108420860484,
-0.040007770605588695,
-0.039980580856235876,
-0.03994555980812628,
-0.039902729592895175,
-0.039852113831281205,
-0.039793737625642034,
-0.039727627552194909,
-0.039653811652984462,
-0.039572319427579369,
-0.039483181824500828,
-0.039386431232383945,
-0.039282101470875096,
-0.039170227781267275,
-0.039050846816875477,
-0.03892399663315485,
-0.038789716677564028,
-0.038648047779175368,
-0.038499032138036023,
-0.038342713314280623,
-0.038179136216999671,
-0.038008347092865387,
-0.037830393514518154,
-0.037645324368715441,
-0.037453189844247621,
-0.03725404141962118,
-0.037047931850514609,
-0.036834915157007563,
-0.036615046610588023,
-0.036388382720939104,
-0.036154981222509722,
-0.035914901060870245,
-0.035668202378858961,
-0.035414946502519744,
-0.035155195926835088,
-0.034889014301259118,
-0.034616466415050368,
-0.034337618182411836,
-0.034052536627437444,
-0.033761289868871149,
-0.03346394710468073,
-0.033160578596449983,
-0.032851255653591718,
-0.032536050617387485,
-0.032215036844853898,
-0.031888288692442313,
-0.031555881499573252,
-0.031217891572009968,
-0.03087439616507455,
-0.030525473466710296,
-0.030171202580392735,
-0.029811663507895752,
-0.029446937131912654,
-0.029077105198539024,
-0.0287022502996193,
-0.028322455854961893,
-0.027937806094424325,
-0.027548386039876371,
-0.02715428148703921,
-0.026755578987210368,
-0.026352365828873466,
-0.025944730019198264,
-0.025532760265437018,
-0.025116545956216405,
-0.024696177142733023,
-0.024271744519854029,
-0.023843339407128007,
-0.023411053729707802,
-0.022974979999193363,
-0.022535211294392732,
-0.022091841242011332,
-0.021644963997267751,
-0.021194674224444092,
-0.020741067077372558,
-0.020284238179863676,
-0.019824283606077409,
-0.019361299860845897,
-0.018895383859945953,
-0.018426632910329928,
-0.017955144690316466,
-0.017481017229745762,
-0.017004348890103181,
-0.016525238344615799,
-0.016043784558323421,
-0.015560086768132602,
-0.015074244462852517,
-0.014586357363218904,
-0.014096525401912311,
-0.013604848703569228,
-0.013111427564795086,
-0.012616362434180146,
-0.012119753892323148,
-0.011621702631866281,
-0.011122309437546328,
-0.010621675166262976,
-0.010119900727173396,
-0.0096170870618105652,
-0.0091133351242343938,
-0.0086087458612165487,
-0.008103420192464553,
-0.0075974589908860083,
-0.0070909630629021336,
-0.0065840331288069898,
-0.0060767698031842067,
-0.0055692735753775187,
-0.0050616447900242558,
-0.0045539836276525395,
-0.0040463900853476139,
-0.0035389639574880463,
-0.0030318048165605478,
-0.0025250119940514919,
-0.0020186845614211892,
-0.0015129213111670084,
-0.001007820737972511,
-0.00050348101995390448,
-3.0746207324051335e-017,
--0.00050252483278528405,
--0.0010039963615380075,
--0.0015043178599806126,
--0.0020033930106602513,
--0.0025011259230698279,
--0.0029974211516549886,
--0.0034921837136985046,
--0.0039853191070815999,
--0.0044767333279180435,
--0.0049663328880580884,
--0.0054540248324581918,
--0.0059397167564160689,
--0.0064233168226629335,
--0.0069047337783159669,
--0.0073838769716829582,
--0.0078606563689188926,
--0.0083349825705297861,
--0.008806766827723668,
--0.009275921058600629,
--0.0097423578641860319,
--0.01020599054429659,
--0.010666733113242658,
--0.011124500315361437,
--0.011579207640376154,
--0.012030771338583697,
--0.012479108435863182,
--0.01292413674850571,
--0.013365774897860993,
--0.013803942324800991,
--0.014238559303993347,
--0.014669546957988491,
--0.015096827271111181,
--0.015520323103160401,
--0.015939958202910585,
--0.01635565722141457,
--0.016767345725104348,
--0.017174950208689997,
--0.017578398107850297,
--0.017977617811718034,
--0.018372538675153906,
--0.018763091030808976,
--0.019149206200973358,
--0.019530816509208973,
--0.019907855291764209,
--0.020280256908770587,
--0.020647956755215663,
--0.021010891271694948,
--0.021368997954938806,
--0.021722215368111364,
--0.022070483150883599,
--0.022413742029275353,
--0.022751933825266871,
--0.023085001466177726,
--0.023412888993811838,
--0.023735541573366836,
--0.024052905502107924,
--0.024364928217802027,
--0.024671558306914695,
--0.02497274551256554,
--0.02526844074224292,
--0.025558596075275407,
--0.025843164770061249,
--0.026122101271051225,
--0.026395361215488598,
--0.026662901439900365,
--0.0269246799863435,
--0.027180656108402163,
--0.027430790276936748,
--0.027675044185583367,
--0.027913380756004399,
--0.028145764142887109,
--0.028372159738692625,
--0.028592534178153217,
--0.028806855342516816,
--0.029015092363540891,
--0.029217215627231979,
--0.029413196777334043,
--0.02960300871856263,
--0.029786625619586476,
--0.029964022915755149,
--0.030135177311574241,
--0.03030006678292587,
--0.030458670579036867,
--0.030610969224193006,
--0.03075694451920016,
--0.03089657954259253,
--0.031029858651587909,
--0.031156767482790278,
--0.031277292952640798,
--0.031391423257615896,
--0.031499147874174994,
--0.031600457558456495,
--0.031695344345723686,
--0.031783801549560571,
--0.031865823760818653,
--0.031941406846314739,
--0.032010547947281018,
--0.032073245477568228,
--0.032129499121601797,
--0.03217930983209321,
--0.032222679827506151,
--0.032259612589279327,
--0.032290112858806411,
--0.032314186634174465,
--0.032331841166661483,
--0.032343084956994901,
--0.032347927751371346,
--0.032346380537239615,
--0.032338455538847684,
--0.03232416621255519,
--0.032303527241912766,
--0.032276554532509459,
--0.032243265206589974,
--0.032203677597442755,
--0.032157811243560902,
--0.032105686882577117,
--0.032047326444974468,
--0.031982753047574551,
--0.031911990986804729,
--0.031835065731746076,
--0.031752003916964179,
--0.03166283333512384,
--0.031567582929390443,
--0.031466282785619103,
--0.031358964124333699,
--0.031245659292498403,
--0.031126401755082408,
--0.031001226086421162,
--0.030870167961375292,
--0.030733264146290053,
--0.030590552489756253,
--0.030442071913176685,
--0.030287862401138056,
--0.030127964991592801,
--0.029962421765851184,
--0.029791275838387345,
--0.029614571346460901,
--0.029432353439557017,
--0.0292446682686462,
--0.029051562975268307,
--0.028853085680440763,
--0.028649285473395437,
--0.028440212400145812,
--0.028225917451886955,
--0.02800645255323124,
--0.027781870550282431,
--0.027552225198549669,
--0.027317571150706418,
--0.027077963944194233,
--0.026833459988675697,
--0.026584116553339681,
--0.026329991754059909,
--0.026071144540411328,
--0.025807634682546154,
--0.025539522757932816,
--0.025266870137960286,
--0.024989738974411424,
--0.024708192185806558,
--0.024422293443623039,
--0.024132107158390363,
--0.023837698465666451,
--0.02353913321189673,
--0.023236477940159671,
--0.022929799875800374,
--0.022619166911958258,
--0.022304647594987456,
--0.021986311109777962,
--0.021664227264975904,
--0.021338466478109601,
--0.021009099760622377,
--0.020676198702816583,
--0.020339835458709984,
--0.020000082730810928,
--0.019657013754811891,
--0.019310702284206081,
--0.018961222574832029,
--0.018608649369345056,
--0.018253057881623923,
--0.017894523781111119,
--0.01753312317709339,
--0.017168932602923952,
--0.01680202900019058,
--0.016432489702830864,
--0.016060392421201591,
--0.015685815226100706,
--0.015308836532749085,
--0.014929535084733131,
--0.014547989937912115,
--0.014164280444293362,
--0.013778486235879043,
--0.013390687208485814,
--0.013000963505544427,
--0.012609395501877646,
--0.012216063787463779,
--0.011821049151186671,
--0.011424432564576904,
--0.011026295165544965,
--0.010626718242113888,
--0.010225783216148872,
--0.0098235716270930716,
--0.0094201651157079097,
--0.009015645407822891,
--0.0086100942981002168,
--0.0082035936338128845,
--0.0077962252986435087,
--0.0073880711965047001,
--0.0069792132353855953,
--0.0065697333112251979,
--0.0061597132918201096,
--0.005749235000763752,
--0.0053383802014266837,
--0.0049272305809751008,
--0.0045158677344350057,
--0.0041043731488026921,
--0.0036928281872060024,
--0.0032813140731170541,
--0.0028699118746236501,
--0.0024587024887571768,
--0.0020477666258842523,
--0.0016371847941627523,
--0.0012270372840659208,
--0.00081740415297723188,
--0.00040836520985967542,
--2.8501070131180604e-017,
-0.00040761221016485938,
-0.00081439244814139481,
-0.0012202620503873837,
-0.0016251426772302471,
-0.0020289563276969552,
-0.0024316253542488232,
-0.0028330724774206849,
-0.0032332208003610381,
-0.0036319938232706813,
-0.0040293154577364576,
-0.0044251100409597342,
-0.0048193023498728539,
-0.005211817615145998,
-0.0056025815350778429,
-0.0059915202893697185,
-0.0063785605527794517,
-0.0067636295086546229,
-0.0071466548623387348,
-0.0075275648544534104,
-0.0079062882740481982,
-0.008282754471621228,
-0.0086568933720042075,
-0.0090286354871118163,
-0.0093979119285518241,
-0.0097646544200958533,
-0.010128795310004931,
-0.010490267583211534,
-0.010849004873354383,
-0.01120494147466191,
-0.011558012353686996,
-0.011908153160885329,
-0.012255300242040601,
-0.012599390649530721,
-0.012940362153435287,
-0.013278153252480978,
-0.013612703184825289,
-0.013943951938672931,
-0.014271840262727667,
-0.014596309676474125,
-0.014917302480289848,
-0.015234761765385298,
-0.015548631423570275,
-0.015858856156844618,
-0.016165381486813402,
-0.016468153763921724,
-0.016767120176511757,
-0.017062228759697051,
-0.017353428404054856,
-0.017640668864133617,
-0.017923900766776364,
-0.01820307561925533,
-0.018478145817220824,
-0.018749064652458739,
-0.019015786320458999,
-0.019278265927792363,
-0.019536459499293408,
-0.019790323985051119,
-0.020039817267203896,
-0.020284898166538973,
-0.020525526448894899,
-0.020761662831367208,
-0.020993268988314072,
-0.02122030755716452,
-0.021442742144024585,
-0.021660537329084292,
-0.021873658671821977,
-0.022082072716006873,
-0.022285746994498465,
-0.022484650033843225,
-0.022678751358666125,
-0.022868021495858856,
-0.023052431978562438,
-0.023231955349944742,
-0.023406565166772121,
-0.02357623600277527,
-0.023740943451808171,
-0.023900664130801445,
-0.024055375682507586,
-0.024205056778040173,
-0.024349687119205935,
-0.024489247440628786,
-0.024623719511667665,
-0.024753086138126379,
-0.024877331163756521,
-0.02499643947155325,
-0.025110396984843908,
-0.025219190668169793,
-0.025322808527961482,
-0.025421239613007289,
-0.025514474014715932,
-0.025602502867173169,
-0.025685318346993002,
-0.025762913672963655,
-0.025835283105489215,
-0.025902421945826655,
-0.025964326535119615,
-0.026020994253228697,
-0.026072423517359541,
-0.026118613780488839,
-0.026159565529589229,
-0.02619528028365356,
-0.026225760591519629,
-0.026251010029495609,
-0.02627103319878769,
-0.026285835722730189,
-0.026295424243819313,
-0.02629980642055163,
-0.026298990924067765,
-0.026292987434602962,
-0.026281806637744896,
-0.026265460220500393,
-0.026243960867171821,
-0.026217322255044355,
-0.026185559049885471,
-0.026148686901257642,
-0.026106722437645734,
-0.026059683261400277,
-0.026007587943497838,
-0.02595045601812012,
-0.02588830797705291,
-0.025821165263906355,
-0.025749050268158387,
-0.025671986319022018,
-0.025589997679138898,
-0.025503109538100081,
-0.025411348005795906,
-0.025314740105596169,
-0.025213313767363167,
-0.025107097820297981,
-0.024996121985622937,
-0.024880416869101276,
-0.024760013953395606,
-0.024634945590268052,
-0.024505244992622435,
-0.024370946226391434,
-0.024232084202270139,
-0.024088694667298162,
-0.023940814196291491,
-0.023788480183127562,
-0.023631730831883652,
-0.023470605147832144,
-0.023305142928293787,
-0.023135384753351446,
-0.022961371976426236,
-0.022783146714718292,
-0.022600751839513773,
-0.022414230966361463,
-0.022223628445119537,
-0.022028989349876026,
-0.021830359468744374,
-0.021627785293537056,
-0.021421314009318151,
-0.021210993483839476,
-0.020996872256859516,
-0.02077899952935065,
-0.020557425152594542,
-0.02033219961716877,
-0.020103374041828454,
-0.019871000162282618,
-0.019635130319870134,
-0.019395817450136212,
-0.019153115071312635,
-0.018907077272703156,
-0.018657758702978457,
-0.018405214558380293,
-0.018149500570840728,
-0.01789067299601545,
-0.017628788601236567,
-0.01736390465338556,
-0.017096078906690237,
-0.016825369590446376,
-0.016551835396669531,
-0.016275535467676204,
-0.015996529383599564,
-0.015714877149841086,
-0.015430639184460828,
-0.015143876305509099,
-0.014854649718302511,
-0.014563021002645327,
-0.01426905210000187,
-0.013972805300619201,
-0.013674343230604317,
-0.013373728838959795,
-0.013071025384577262,
-0.012766296423194495,
-0.012459605794316923,
-0.012151017608106897,
-0.01184059623224311,
-0.011528406278753334,
-0.01121451259082154,
-0.010898980229575051,
-0.010581874460850675,
-0.0102632607419455,
-0.0099432047083532864,
-0.0096217721604901999,
-0.0092990290504106309,
-0.008975041468519164,
-0.0086498756302767002,
-0.0083235978629084117,
-0.007996274592111512,
-0.0076679723287688345,
-0.0073387576556690473,
-0.007008697214237157,
-0.0066778576912760986,
-0.0063463058057252582,
-0.0060141082954349463,
-0.0056813319039610271,
-0.0053480433673838831,
-0.0050143094011501398,
-0.0046801966869447816,
-0.0043457718595914484,
-0.0040111014939869542,
-0.0036762520920705834,
-0.00334129006983193,
-0.003006281744357749,
-0.0026712933209238274,
-0.0023363908801300941,
-0.0020016403650848901,
-0.0016671075686390052,
-0.0013328581206724756,
-0.00099895747543640289,
-0.00066547089895279017,
-0.00033246345647290675,
-2.6104283963309635e-017,
--0.000331854844125343,
--0.00066303668757192852,
--0.00099348139229550082,
--0.0013231250827445257,
--0.0016519041579933251,
--0.0019797553037969435,
--0.0023066155045702737,
--0.0026324220552840939,
--0.0029571125732799973,
--0.0032806250100003674,
--0.003602897662629632,
--0.0039238691856482676,
--0.0042434786022940586,
--0.0045616653159304636,
--0.0048783691213188617,
--0.0051935302157944301,
--0.0055070892103403178,
--0.0058189871405626165,
--0.0061291654775592307,
--0.0064375661386852035,
--0.0067441314982092096,
--0.0070488043978612028,
--0.0073515281572680983,
--0.0076522465842775575,
--0.0079509039851647922,
--0.0082474451747244007,
--0.0085418154862424139,
--0.0088339607813483351,
--0.0091238274597450642,
--0.0094113624688149985,
--0.0096965133131002631,
--0.0099792280636569058,
--0.010259455367278632,
--0.010537144455591538,
--0.010812245154016903,
--0.011084707890599206,
--0.011354483704700892,
--0.011621524255559531,
--0.011885781830707591,
--0.012147209354252762,
--0.012405760395017727,
--0.012661389174537501,
--0.012914050574914441,
--0.013163700146526914,
--0.013410294115593807,
--0.013653789391590692,
--0.013894143574518205,
--0.014131314962020377,
--0.014365262556353403,
--0.014595946071200872,
--0.014823325938338251,
--0.015047363314141414,
--0.015268020085941967,
--0.015485258878225727,
--0.015699043058674682,
--0.015909336744051004,
--0.016116104805923199,
--0.016319312876231475,
--0.016518927352694033,
--0.01671491540405207,
--0.016907244975152124,
--0.017095884791867324,
--0.017280804365853945,
--0.017461973999145421,
--0.017639364788581011,
--0.017812948630069932,
--0.01798269822268939,
--0.018148587072617434,
--0.018310589496897973,
--0.01846868062703989,
--0.018622836412448159,
--0.018773033623687166,
--0.018919249855576109,
--0.01906146353011573,
--0.01919965389924622,
--0.01933380104743675,
--0.019463885894104728,
--0.019589890195866828,
--0.019711796548619698,
--0.019829588389451515,
--0.019943249998383494,
--0.020052766499942136,
--0.020158123864561135,
--0.020259308909814255,
--0.020356309301477873,
--0.020449113554424508,
--0.020537711033346812,
--0.020622091953311952,
--0.020702247380147403,
--0.020778169230657593,
--0.020849850272672107,
--0.020917284124925439,
--0.020980465256769137,
--0.021039388987715749,
--0.021094051486816312,
--0.021144449771870313,
--0.021190581708469852,
--0.021232446008877741,
--0.021270042230740253,
--0.021303370775635152,
--0.021332432887455607,
--0.021357230650630325,
--0.021377766988180995,
--0.021394045659617313,
--0.021406071258670504,
--0.021413849210866059,
--0.021417385770936419,
--0.021416688020074418,
--0.021411763863028333,
--0.02140262202503937,
--0.021389272048622461,
--0.021371724290191376,
--0.021349989916529036,
--0.021324080901103899,
--0.021294010020233699,
--0.021259790849097293,
--0.021221437757595808,
--0.021178965906064134,
--0.021132391240834037,
--0.021081730489649682,
--0.021027001156937199,
--0.020968221518929079,
--0.020905410618644846,
--0.020838588260729221,
--0.020767775006149181,
--0.020692992166750641,
--0.020614261799677205,
--0.020531606701650929,
--0.020445050403117813,
--0.020354617162258431,
--0.020260331958865636,
--0.020162220488090746,
--0.020060309154059534,
--0.019954625063359377,
--0.019845196018399857,
--0.019732050510647216,
--0.019615217713734999,
--0.019494727476452558,
--0.019370610315612206,
--0.019242897408797883,
--0.019111620586995549,
--0.018976812327108329,
--0.018838505744357081,
--0.018696734584568935,
--0.018551533216354398,
--0.018402936623176387,
--0.018250980395311266,
--0.018095700721704841,
--0.017937134381724656,
--0.017775318736810427,
--0.017610291722024503,
--0.017442091837504437,
--0.017270758139818591,
--0.01709633023322852,
--0.0169188482608577,
--0.016738352895770459,
--0.016554885331962005,
--0.016368487275261929,
--0.016179200934152486,
--0.015987069010504947,
--0.015792134690234553,
--0.015594441633876462,
--0.01539403396708605,
--0.015190956271062895,
--0.014985253572903567,
--0.01477697133588254,
--0.014566155449665113,
--0.014352852220453531,
--0.01413710836106895,
--0.013918970980970044,
--0.013698487576212748,
--0.013475706019350289,
--0.013250674549278047,
--0.013023441761024023,
--0.012794056595487463,
--0.012562568329127664,
--0.012329026563605426,
--0.012093481215378156,
--0.011855982505253004,
--0.011616580947897292,
--0.011375327341310892,
--0.011132272756261184,
--0.010887468525683766,
--0.010640966234049521,
--0.010392817706702888,
--0.010143074999169971,
--0.0098917903864423617,
--0.0096390163522358345,
--0.0093848055782272469,
--0.0091292109332730687,
--0.0088722854626090159,
--0.0086140823770353443,
--0.0083546550420887638,
--0.0080940569672037586,
--0.0078323417948642175,
--0.0075695632897501549,
--0.0073057753278779501,
--0.0070410318857404329,
--0.0067753870294450817,
--0.0065088949038553572,
--0.0062416097217357835,
--0.0059735857529037905,
--0.0057048773133889985,
--0.0054355387546047469,
--0.0051656244525307149,
--0.0048951887969114274,
--0.0046242861804713393,
--0.0043529709881490724,
--0.0040812975863526941,
--0.0038093203122387368,
--0.0035370934630153924,
--0.0032646712852747936,
--0.0029921079643534711,
--0.0027194576137243112,
--0.0024467742644234229,
--0.0021741118545109289,
--0.0019015242185705104,
--0.0016290650772481695,
--0.0013567880268326969,
--0.0010847465288797143,
--0.00081299389988171854,
--0.00054158330098461342,
--0.00027056772775546845,
--2.3604630592482906e-017,
-0.00027006724836532313,
-0.00053958157938671766,
-0.00080849076108838549,
-0.0010767427774301878,
-0.001344285838202472,
-0.0016110683888602509,
-0.0018770391202906462,
-0.0021421469785156727,
-0.0024063411743256826,
-0.002669571192843273,
-0.0029317868030149254,
-0.003192938067030159,
-0.0034529753496638374,
-0.0037118493275427144,
-0.0039695109983333083,
-0.0042259116898481037,
-0.0044810030690716641,
-0.0047347371511010962,
-0.0049870663080028846,
-0.0052379432775818309,
-0.0054873211720619765,
-0.0057351534866770396,
-0.0059813941081703209,
-0.0062259973231999308,
-0.006468917826651043,
-0.0067101107298510451,
-0.0069495315686876006,
-0.00718713631162769,
-0.0074228813676363503,
-0.0076567235939933474,
-0.0078886203040076791,
-0.008118529274626151,
-0.0083464087539377018,
-0.00857221746856969,
-0.0087959146309762801,
-0.0090174599466168511,
-0.009236813621024513,
-0.009453936366761187,
-0.0096687894102611711,
-0.0098813344985588247,
-0.010091533905901796,
-0.010299350440247712,
-0.010504747449642594,
-0.010707688828480642,
-0.010908139023645772,
-0.01110606304052982,
-0.01130142644893172,
-0.011494195388832342,
-0.011684336576046464,
-0.011871817307750195,
-0.012056605467883012,
-0.012238669532423774,
-0.012417978574539629,
-0.012594502269607248,
-0.012768210900105548,
-0.012939075360379061,
-0.013107067161271543,
-0.013272158434628336,
-0.013434321937668806,
-0.013593531057224689,
-0.01374975981384844,
-0.013902982865785982,
-0.01405317551281786,
-0.014200313699964977,
-0.01434437402106019,
-0.014485333722184567,
-0.01462317070496829,
-0.014757863529755449,
-0.014889391418632271,
-0.015017734258319652,
-0.015142872602926847,
-0.015264787676570113,
-0.015383461375851488,
-0.015498876272201671,
-0.015611015614083614,
-0.015719863329058441,
-0.015825404025712874,
-0.015927622995448074,
-0.016026506214130029,
-0.016122040343601075,
-0.016214212733052843,
-0.01630301142026034,
-0.016388425132677371,
-0.016470443288393269,
-0.016549055996950651,
-0.016624254060025458,
-0.016696028971967401,
-0.016764372920203132,
-0.016829278785500799,
-0.016890740142096714,
-0.016948751257684507,
-0.017003307093266674,
-0.017054403302869121,
-0.017102036233118709,
-0.017146202922684473,
-0.017186901101582434,
-0.01722412919034506,
-0.017257886299054788,
-0.017288172226243279,
-0.017314987457655726,
-0.017338333164881505,
-0.017358211203851229,
-0.017374624113200975,
-0.017387575112504241,
-0.017397068100372007,
-0.017403107652421864,
-0.017405699019116573,
-0.017404848123472788,
-0.017400561558640813,
-0.017392846585355753,
-0.017381711129261262,
-0.017367163778106154,
-0.017349213778815129,
-0.017327871034434054,
-0.017303146100950871,
-0.017275050183992953,
-0.017243595135401607,
-0.017208793449684959,
-0.017170658260349827,
-0.017129203336113657,
-0.017084443076997729,
-0.017036392510301944,
-0.01698506728646329,
-0.016930483674797794,
-0.016872658559127989,
-0.016811609433296553,
-0.016747354396567125,
-0.016679912148913806,
-0.016609301986199972,
-0.016535543795248096,
-0.016458658048801318,
-0.016378665800378181,
-0.016295588679021804,
-0.016209448883944419,
-0.016120269179069165,
-0.0160280728874692,
-0.015932883885707339,
-0.01583472659807517,
-0.015733625990735339,
-0.015629607565766319,
-0.015522697355112389,
-0.015412921914439656,
-0.015300308316899503,
-0.015184884146800963,
-0.015066677493193469,
-0.014945716943361576,
-0.014822031576232107,
-0.0146956509556975,
-0.014566605123853415,
-0.014434924594156023,
-0.014300640344496752,
-0.014163783810198843,
-0.01402438687693576,
-0.013882481873573412,
-0.013738101564937795,
-0.013591279144509517,
-0.013442048227046907,
-0.013290442841139168,
-0.013136497421691309,
-0.012980246802342423,
-0.012821726207818782,
-0.012660971246224121,
-0.012498017901266836,
-0.012332902524429085,
-0.012165661827075562,
-0.011996332872506692,
-0.011824953067956362,
-0.011651560156536312,
-0.011476192209128889,
-0.011298887616229871,
-0.011119685079742907,
-0.0109386236047275,
-0.010755742491102579,
-0.010571081325305621,
-0.010384679971912718,
-0.010196578565216659,
-0.010006817500768758,
-0.0098154374268839047,
-0.0096224792361114513,
-0.0094279840566734094,
-0.0092319932438718905,
-0.0090345483714674799,
-0.0088356912230302172,
-0.008635463783265164,
-0.0084339082293141097,
-0.0082310669220352333,
-0.0080269823972631531,
-0.0078216973570488825,
-0.0076152546608856796,
-0.0074076973169174606,
-0.0071990684731356716,
-0.0069894114085642762,
-0.0067787695244351884,
-0.0065671863353559835,
-0.0063547054604714799,
-0.0061413706146211233,
-0.0059272255994937476,
-0.0057123142947821809,
-0.0054966806493372449,
-0.0052803686723271103,
-0.0050634224243985733,
-0.0048458860088462785,
-0.0046278035627893045,
-0.0044092192483576528,
-0.0041901772438901726,
-0.0039707217351457463,
-0.0037508969065293634,
-0.0035307469323348816,
-0.0033103159680061495,
-0.0030896481414181549,
-0.0028687875441798702,
-0.0026477782229611686,
-0.0024266641708431246,
-0.0022054893186978695,
-0.0019842975265941271,
-0.0017631325752346765,
-0.0015420381574248706,
-0.001321057869574699,
-0.0011002352032358619,
-0.00087961353667548726,
-0.00065923612648810851,
-0.00043914609924736571,
-0.00021938644319981665,
--3.4469686980574571e-017,
--0.00021897054350735343,
--0.00043748266346125734,
--0.00065549400710965538,
--0.00087296240088557682,
--0.0010898458584326848,
--0.0013061025885785925,
--0.0015216910032544979,
--0.0017365697253596451,
--0.0019506975965691796,
--0.0021640336850839176,
--0.0023765372933206288,
--0.0025881679655415028,
--0.002798885495420643,
--0.0030086499335485826,
--0.0032174215948689031,
--0.0034251610660517595,
--0.0036318292127963002,
--0.0038373871870667365,
--0.0040417964342563222,
--0.0042450187002802181,
--0.0044470160385953151,
--0.0046477508171457538,
--0.0048471857252330988,
--0.0050452837803091769,
--0.0052420083346926116,
--0.0054373230822036189,
--0.0056311920647216318,
--0.005823579678658394,
--0.0060144506813510938,
--0.0062037701973701566,
--0.0063915037247429208,
--0.006577617141091281,
--0.0067620767096824444,
--0.0069448490853917227,
--0.007125901320576296,
--0.0073052008708590355,
--0.0074827156008213181,
--0.0076584137896039224,
--0.0078322641364151242,
--0.008004235765944466,
--0.0081742982336832897,
--0.008342421531147377,
--0.0085085760910054639,
--0.0086727327921089937,
--0.0088348629644243257,
--0.0089949383938659772,
--0.0091529313270301543,
--0.0093088144758278948,
--0.0094625610220170405,
--0.0096141446216323721,
--0.009763539409312811,
--0.0099107200025265307,
--0.010055661505690329,
--0.010198339514186383,
--0.010338730118272682,
--0.010476809906888269,
--0.010612555971352083,
--0.010745945908955111,
--0.010876957826445146,
--0.011005570343403886,
--0.01113176259551564,
--0.011255514237727405,
--0.011376805447299831,
--0.011495616926748638,
--0.011611929906675863,
--0.011725726148491704,
--0.011836987947024317,
--0.011945698133020219,
--0.012051840075532446,
--0.012155397684197709,
--0.01225635541140167,
--0.012354698254332393,
--0.012450411756921582,
--0.012543482011673528,
--0.012633895661381711,
--0.012721639900732398,
--0.012806702477796439,
--0.012889071695407046,
--0.012968736412425845,
--0.01304568604489542,
--0.013119910567079099,
--0.013191400512387947,
--0.013260146974194732,
--0.013326141606535238,
--0.013389376624696709,
--0.013449844805693688,
--0.013507539488631381,
--0.013562454574956527,
--0.013614584528596145,
--0.01366392437598408,
--0.01371046970597605,
--0.013754216669652529,
--0.013795161980010939,
--0.013833302911546047,
--0.013868637299720222,
--0.013901163540322763,
--0.013930880588719262,
--0.013957787958991129,
--0.013981885722965728,
--0.014003174509137552,
--0.01402165550148061,
--0.014037330438153051,
--0.014050201610093552,
--0.014060271859511128,
--0.01406754457826765,
--0.014072023706154617,
--0.014073713729064113,
--0.014072619677054693,
--0.014068747122312802,
--0.014062102177010363,
--0.014052691491058991,
--0.014040522249761744,
--0.014025602171362747,
--0.01400793950449571,
--0.013987543025531719,
--0.013964422035827262,
--0.013938586358873174,
--0.013910046337345012,
--0.013878812830056158,
--0.013844897208813826,
--0.013808311355179206,
--0.013769067657132509,
--0.01372717900564353,
--0.013682658791148938,
--0.013635520899936797,
--0.013585779710439588,
--0.013533450089436282,
--0.013478547388164784,
--0.013421087438345141,
--0.013361086548115289,
--0.013298561497879363,
--0.013233529536070295,
--0.01316600837482745,
--0.013096016185590236,
--0.013023571594608785,
--0.012948693678372938,
--0.012871401958960247,
--0.012791716399304395,
--0.012709657398385006,
--0.012625245786339818,
--0.012538502819500622,
--0.012449450175354005,
--0.012358109947427481,
--0.012264504640103632,
--0.012168657163361277,
--0.012070590827447302,
--0.011970329337477959,
--0.011867896787972732,
--0.011763317657321104,
--0.011656616802183032,
--0.011547819451825847,
--0.011436951202397076,
--0.011324038011135931,
--0.011209106190523451,
--0.011092182402373528,
--0.010973293651866023,
--0.010852467281522775,
--0.010729730965127813,
--0.010605112701593828,
--0.010478640808775502,
--0.010350343917231336,
--0.010220250963935175,
--0.010088391185938985,
--0.0099547941139879262,
--0.0098194895660897279,
--0.0096825076410383196,
--0.0095438787118952654,
--0.0094036334194282263,
--0.0092618026655094474,
--0.0091184176064742738,
--0.0089735096464425412,
--0.0088271104306027869,
--0.0086792518384625639,
--0.0085299659770636284,
--0.0083792851741660186,
--0.0082272419714012456,
--0.0080738691173951535,
--0.0079191995608643047,
--0.0077632664436846138,
--0.0076061030939357987,
--0.007447743018921287,
--0.0072882198981667574,
--0.0071275675763971102,
--0.00696582005649526,
--0.0068030114924415687,
--0.0066391761822379011,
--0.006474348560816261,
--0.0063085631929339289,
--0.0061418547660564244,
--0.0059742580832298523,
--0.0058058080559438329,
--0.0056365396969871254,
--0.0054664881132960776,
--0.0052956884987985595,
--0.0051241761272547868,
--0.0049519863450956806,
--0.0047791545642602408,
--0.004605716255034498,
--0.0044317069388917904,
--0.0042571621813380688,
--0.004082117584760501,
--0.0039066087812838117,
--0.0037306714256343885,
--0.0035543411880130261,
--0.00337765374697878,
--0.0032006447823452753,
--0.0030233499680901808,
--0.0028458049652790814,
--0.0026680454150065261,
--0.0024901069313537257,
--0.0023120250943666747,
--0.002133835443052878,
--0.0019555734684011134,
--0.0017772746064236814,
--0.0015989742312236619,
--0.0014207076480866137,
--0.0012425100866011226,
--0.0010644166938063259,
--0.00088646252737013755,
--0.00070868254879757962,
--0.00053111161667188024,
--0.00035378447992952033,
--0.00017673577116978688,
--1.8501282140218453e-017,
-0.0001763884535810419,
-0.00035239534576116501,
-0.00052798657545392934,
-0.00070312819079512354,
-0.00087778639559825975,
-0.001051927555765582,
-0.0012255182056552436,
-0.0013985250544021428,
-0.0015709149921913214,
-0.0017426550964835033,
-0.0019137126381916683,
-0.0020840550878063377,
-0.0022536501214696432,
-0.0024224656269965614,
-0.0025904697098423062,
-0.0027576306990147689,
-0.002923917152931047,
-0.0030892978652163798,
-0.0032537418704462612,
-0.0034172184498277038,
-0.0035796971368216727,
-0.003741147722703465,
-0.0039015402620617948,
-0.0040608450782338695,
-0.0042190327686772652,
-0.0043760742102754227,
-0.0045319405645788376,
-0.0046866032829781887,
-0.0048400341118096683,
-0.0049922050973927878,
-0.0051430885909969793,
-0.0052926572537391157,
-0.0054408840614088546,
-0.0055877423092228285,
-0.0057332056165050396,
-0.005877247931294456,
-0.00601984353487696,
-0.0061609670462435349,
-0.0063005934264714529,
-0.0064386979830291695,
-0.0065752563740037505,
-0.0067102446122503032,
-0.0068436390694625211,
-0.0069754164801640048,
-0.0071055539456190897,
-0.0072340289376636516,
-0.0073608193024542953,
-0.0074859032641353311,
-0.0076092594284236561,
-0.0077308667861108737,
-0.0078507047164812858,
-0.007968752990646491,
-0.0080849917747944002,
-0.0081994016333545063,
-0.0083119635320767025,
-0.0084226588410242914,
-0.0085314693374809927,
-0.0086383772087709042,
-0.0087433650549910598,
-0.0088464158916565592,
-0.0089475131522581894,
-0.0090466406907310625,
-0.0091437827838354128,
-0.009238924133447575,
-0.0093320498687628275,
-0.0094231455484081236,
-0.0095121971624653467,
-0.0095991911344044459,
-0.0096841143229271197,
-0.0097669540237191807,
-0.0098476979711133103,
-0.009926334339660536,
-0.01000285174561146,
-0.010077239248306374,
-0.010149486351474137,
-0.010219583004440249,
-0.010287519603243875,
-0.010353286991663491,
-0.010416876462151163,
-0.010478279756676223,
-0.010537489067476985,
-0.010594497037721789,
-0.01064929676207867,
-0.010701881787194141,
-0.010752246112080928,
-0.010800384188414688,
-0.010846290920740057,
-0.010889961666586243,
-0.010931392236491854,
-0.010970578893939606,
-0.011007518355200922,
-0.011042207789090505,
-0.011074644816631427,
-0.011104827510630607,
-0.011132754395165142,
-0.01115842444498001,
-0.011181837084796694,
-0.011202992188533973,
-0.011221890078440452,
-0.011238531524139691,
-0.011252917741587907,
-0.011265050391944966,
-0.01127493158035877,
-0.011282563854663663,
-0.011287950203993235,
-0.011291094057307794,
-0.011291999281837314,
-0.01129067018144001,
-0.011287111494877145,
-0.01128132839400472,
-0.011273326481882324,
-0.011263111790799845,
-0.011250690780222611,
-0.0112360703346554,
-0.011219257761426078,
-0.011200260788389272,
-0.011179087561550878,
-0.011155746642613972,
-0.011130247006446626,
-0.011102598038472595,
-0.011072809531985171,
-0.011040891685385308,
-0.011006855099344308,
-0.010970710773892009,
-0.010932470105431328,
-0.010892144883679577,
-0.010849747288537513,
-0.010805289886886888,
-0.010758785629317126,
-0.010710247846782373,
-0.010659690247188871,
-0.010607126911914443,
-0.010552572292260292,
-0.010496041205836094,
-0.010437548832879312,
-0.010377110712509645,
-0.010314742738919424,
-0.010250461157500558,
-0.010184282560909523,
-0.010116223885070852,
-0.010046302405120097,
-0.0099745357312874278,
-0.0099009418047224795,
-0.0098255388932616834,
-0.009748345587139013,
-0.0096693807946406068,
-0.0095886637377052882,
-0.0095062139474708027,
-0.0094220512597677723,
-0.0093361958105614082,
-0.0092486680313429836,
-0.0091594886444711834,
-0.0090686786584653484,
-0.0089762593632503936,
-0.0088822523253555725,
-0.0087866793830678226,
-0.0086895626415399788,
-0.008590924467856453,
-0.0084907874860558202,
-0.0083891745721127627,
-0.0082861088488791687,
-0.0081816136809868076,
-0.0080757126697113459,
-0.0079684296478004096,
-0.0078597886742647182,
-0.007749814029135437,
-0.0076385302081875672,
-0.0075259619176310105,
-0.0074121340687703314,
-0.007297071772634306,
-0.0071808003345763755,
-0.0070633452488475289,
-0.0069447321931418136,
-0.0068249870231166139,
-0.00670413576688857,
-0.0065822046195060466,
-0.0064592199373990382,
-0.0063352082328086944,
-0.0062101961681963122,
-0.0060842105506345402,
-0.0059572783261798868,
-0.0058294265742295983,
-0.0057006825018633377,
-0.0055710734381702147,
-0.0054406268285632454,
-0.0053093702290823381,
-0.0051773313006863893,
-0.005044537803535698,
-0.0049110175912666842,
-0.0047767986052588444,
-0.004641908868896814,
-0.0045063764818262745,
-0.0043702296142072942,
-0.0042334965009646723,
-0.0040962054360374834,
-0.0039583847666274175,
-0.0038200628874494498,
-0.0036812682349835965,
-0.0035420292817306487,
-0.0034023745304716723,
-0.0032623325085334009,
-0.0031219317620605749,
-0.0029812008502958709,
-0.0028401683398683797,
-0.002698862799092757,
-0.0025573127922796294,
-0.0024155468740573098,
-0.0022735935837083533,
-0.0021314814395194978,
-0.0019892389331480267,
-0.0018468945240041096,
-0.0017044766336513312,
-0.0015620136402263876,
-0.0014195338728784604,
-0.0012770656062292857,
-0.0011346370548559568,
-0.00099227636779654588,
-0.00085001162308000677,
-0.00070787082228133502,
-0.00056588188510302913,
-0.00042407264398380568,
-0.00028247083873609658,
-0.00014110411121183623,
-5.1709452627355769e-017,
--0.00014081406484531882,
--0.00028131076704446137,
--0.00042146290929816112,
--0.00056124341845917758,
--0.00070062535066911589,
--0.00083958189645793062,
--0.00097808638580765945,
--0.0011161122931770441,
--0.001253633242487103,
--0.0013906230120677226,
--0.0015270555395619741,
--0.0016629049267897628,
--0.0017981454445680745,
--0.0019327515374884191,
--0.0020666978286491256,
--0.0021999591243431339,
--0.0023325104186985605,
--0.0024643268982737256,
--0.0025953839466033575,
--0.0027256571486966412,
--0.0028551222954858279,
--0.0029837553882246554,
--0.0031115326428358529,
--0.0032384304942069614,
--0.00336442560043339,
--0.003489494847008852,
--0.0036136153509615009,
--0.0037367644649352071,
--0.0038589197812156735,
--0.0039800591357008717,
--0.0041001606118140728,
--0.0042192025443601629,
--0.0043371635233229499,
--0.0044540223976049587,
--0.0045697582787070879,
--0.0046843505443483376,
--0.0047977788420255239,
--0.0049100230925115422,
--0.0050210634932916637,
--0.0051308805219378558,
--0.0052394549394205094,
--0.0053467677933563074,
--0.0054528004211927888,
--0.0055575344533276517,
--0.005660951816164347,
--0.0057630347351014114,
--0.0058637657374564361,
--0.0059631276553233784,
--0.0060611036283639303,
--0.0061576771065307862,
--0.0062528318527241191,
--0.006346551945379671,
--0.0064388217809889488,
--0.0065296260765505777,
--0.0066189498719523947,
--0.0067067785322843772,
--0.006793097750082213,
--0.0068778935475003978,
--0.0069611522784150939,
--0.0070428606304570821,
--0.0071230056269729353,
--0.0072015746289159251,
--0.0072785553366650933,
--0.0073539357917732683,
--0.00742770437864319,
--0.0074998498261314881,
--0.0075703612090808441,
--0.00763922794978003,
--0.0077064398193512776,
--0.0077719869390653427,
--0.007835859781583833,
--0.0078980491721289178,
--0.0079585462895801345,
--0.0080173426674984526,
--0.0080744301950771164,
--0.0081298011180200632,
--0.0081834480393467041,
--0.0082353639201241651,
--0.0082855420801262337,
--0.0083339761984195845,
--0.0083806603138767977,
--0.0084255888256167706,
--0.0084687564933717836,
--0.008510158437782453,
--0.0085497901406194985,
--0.0085876474449330699,
--0.008623726555129909,
--0.0086580240369776833,
--0.0086905368175375936,
--0.0087212621850247026,
--0.0087501977885966128,
--0.0087773416380703927,
--0.008802692103568141,
--0.0088262479150911979,
--0.0088480081620235553,
--0.0088679722925644484,
--0.0088861401130903937,
--0.0089025117874471336,
--0.0089170878361716395,
--0.008929869135644402,
--0.0089408569171725745,
--0.0089500527660039807,
--0.0089574586202725761,
--0.0089630767698756567,
--0.0089669098552829993,
--0.0089689608662786302,
--0.008969233140635342,
--0.0089677303627224911,
--0.008964456562047524,
--0.0089594161117314535,
--0.0089526137269191047,
--0.0089440544631241188,
--0.0089337437145096156,
--0.0089216872121046994,
--0.0089078910219573676,
--0.008892361543224472,
--0.0088751055061990058,
--0.0088561299702754424,
--0.0088354423218535288,
--0.008813050272181126,
--0.0087889618551368048,
--0.0087631854249523751,
--0.0087357296538764177,
--0.0087066035297789866,
--0.0086758163536984675,
--0.0086433777373307336,
--0.0086092976004617482,
--0.0085735861683438573,
--0.0085362539690166037,
--0.0084973118305725522,
--0.0084567708783690118,
--0.0084146425321861649,
--0.0083709385033323928,
--0.0083256707916971977,
--0.0082788516827529222,
--0.0082304937445055858,
--0.0081806098243955103,
--0.0081292130461489264,
--0.0080763168065806721,
--0.0080219347723493265,
--0.007966080876664932,
--0.007908769315950517,
--0.0078500145464581641,
--0.0077898312808401008,
--0.0077282344846757089,
--0.0076652393729554425,
--0.0076008614065222234,
--0.0075351162884712284,
--0.0074680199605087691,
--0.0073995885992712189,
--0.0073298386126046415,
--0.0072587866358062919,
--0.0071864495278280843,
--0.0071128443674439382,
--0.0070379884493808496,
--0.0069618992804152116,
--0.0068845945754347085,
--0.0068060922534671966,
--0.0067264104336768361,
--0.0066455674313292421,
--0.0065635817537251801,
--0.0064804720961050095,
--0.0063962573375241707,
--0.0063109565367001474,
--0.0062245889278330409,
--0.0061371739163992326,
--0.0060487310749202045,
--0.0059592801387063901,
--0.005868841001577964,
--0.0057774337115625548,
--0.0056850784665718425,
--0.0055917956100565514,
--0.0054976056266421445,
--0.0054025291377452506,
--0.005306586897172139,
--0.005209799786699945,
--0.00511218881164176,
--0.0050137750963962962,
--0.004914579879983459,
--0.0048146245115659953,
--0.0047139304459588608,
--0.0046125192391271996,
--0.0045104125436733989,
--0.004407632104314209,
--0.0043041997533494834,
--0.0042001374061224712,
--0.0040954670564739967,
--0.0039902107721894982,
--0.0038843906904417439,
--0.0037780290132292133,
--0.0036711480028108635,
--0.0035637699771387688,
--0.0034559173052895148,
--0.0033476124028949282,
--0.0032388777275728798,
--0.0031297357743599848,
--0.0030202090711459167,
--0.0029103201741117234,
--0.0028000916631711363,
--0.0026895461374176043,
--0.0025787062105768438,
--0.0024675945064664881,
--0.0023562336544625836,
--0.0022446462849757339,
--0.0021328550249357608,
--0.0020208824932873293,
--0.0019087512964961752,
--0.001796484024067716,
--0.0016841032440788012,
--0.0015716314987230793,
--0.001459091299870745,
--0.0013465051246442682,
--0.0012338954110105835,
--0.0011212845533897225,
--0.0010086948982826463,
--0.00089614873991711275,
--0.00078366831591389905,
--0.00067127580297305094,
--0.00055899331258180954,
--0.00044684288674497836,
--0.00033484649373808636,
--0.00022302602388409804,
--0.00011140328535524955,
--1.3604384402114805e-017,
-0.00011116220080368507,
-0.00022206178026828763,
-0.0003326773002886811,
-0.00044298742550583867,
-0.00055297092734086942,
-0.00066260668799991089,
-0.00077187370444716929,
-0.00088075109234737805,
-0.00098921808997546289,
-0.0010972540620939044,
-0.0012048385037958769,
-0.0013119510443146928,
-0.0014185714507973491,
-0.0015246796320435071,
-0.0016302556422073283,
-0.0017352796844623021,
-0.0018397321146291592,
-0.001943593444764359,
-0.0020468443467105066,
-0.0021494656556065627,
-0.0022514383733584537,
-0.0023527436720682678,
-0.0024533628974226004,
-0.0025532775720380867,
-0.0026524693987653464,
-0.0027509202639490241,
-0.0028486122406443846,
-0.0029455275917896076,
-0.0030416487733332664,
-0.0031369584373164357,
-0.0032314394349090203,
-0.0033250748193994228,
-0.0034178478491378107,
-0.003509741990431749,
-0.0036007409203937918,
-0.0036908285297409861,
-0.0037799889255458029,
-0.0038682064339373959,
-0.0039554656027537402,
-0.0040417512041429019,
-0.0041270482371147978,
-0.004211341930041356,
-0.0042946177431055065,
-0.0043768613706987808,
-0.0044580587437667313,
-0.0045381960321017253,
-0.0046172596465831805,
-0.0046952362413649777,
-0.0047721127160089806,
-0.0048478762175653452,
-0.0049225141425981609,
-0.0049960141391575518,
-0.005068364108696659,
-0.0051395522079339725,
-0.0052095668506603457,
-0.0052783967094912239,
-0.005346030717562505,
-0.0054124580701712353,
-0.0054776682263598551,
-0.0055416509104446315,
-0.0056043961134875225,
-0.0056658940947112808,
-0.0057261353828580702,
-0.0057851107774912645,
-0.0058428113502400686,
-0.0058992284459868805,
-0.0059543536839979077,
-0.0060081789589957867,
-0.00606069644217522,
-0.0061118985821607989,
-0.0061617781059074821,
-0.0062103280195433073,
-0.0062575416091543079,
-0.0063034124415117772,
-0.0063479343647419749,
-0.0063911015089377649,
-0.006432908286712705,
-0.0064733493936973505,
-0.0065124198089778025,
-0.006550114795476656,
-0.0065864299002762906,
-0.0066213609548844672,
-0.0066549040754428045,
-0.0066870556628773363,
-0.006717812402992197,
-0.006747171266505759,
-0.0067751295090300052,
-0.0068016846709926292,
-0.0068268345775025739,
-0.0068505773381586366,
-0.006872911346801811,
-0.0068938352812111751,
-0.0069133481027435616,
-0.0069314490559174487,
-0.006948137667940924,
-0.0069634137481841916,
-0.0069772773875967659,
-0.0069897289580696043,
-0.0070007691117423684,
-0.0070103987802562339,
-0.0070186191739521836,
-0.0070254317810155842,
-0.0070308383665667632,
-0.0070348409716983525,
-0.0070374419124594181,
-0.0070386437787867944,
-0.007038449433384034,
-0.0070368620105481202,
-0.0070338849149445158,
-0.0070295218203306978,
-0.0070237766682287065,
-0.0070166536665470331,
-0.0070081572881521498,
-0.0069982922693902693,
-0.0069870636085595031,
-0.0069744765643330632,
-0.0069605366541337903,
-0.0069452496524604109,
-0.006928621589166151,
-0.0069106587476899448,
-0.0068913676632408136,
-0.0068707551209358812,
-0.0068488281538924304,
-0.0068255940412746364,
-0.0068010603062951995,
-0.006775234714172686,
-0.0067481252700448673,
-0.0067197402168387415,
-0.006690088033097512,
-0.0066591774307653128,
-0.0066270173529301346,
-0.0065936169715254426,
-0.0065589856849909639,
-0.006523133115893566,
-0.0064860691085082628,
-0.0064478037263604555,
-0.0064083472497294741,
-0.006367710173114393,
-0.0063259032026626713,
-0.0062829372535619975,
-0.0062388234473960422,
-0.0061935731094648373,
-0.0061471977660704086,
-0.0060997091417679056,
-0.0060511191565834821,
-0.0060014399231990154,
-0.0059506837441046113,
-0.005898863108719306,
-0.0058459906904808666,
-0.005792079343905205,
-0.0057371421016161371,
-0.0056811921713458445,
-0.0056242429329072512,
-0.0055663079351384983,
-0.0055074008928204694,
-0.0054475356835679382,
-0.005386726344694984,
-0.0053249870700554933,
-0.0052623322068594252,
-0.0051987762524651022,
-0.0051343338511491794,
-0.00506901979085386,
-0.0050028489999130264,
-0.004935836543757172,
-0.0048679976215985615,
-0.0047993475630967418,
-0.0047299018250057867,
-0.0046596759878030428,
-0.004588685752300997,
-0.0045169469362426789,
-0.004444475470880802,
-0.0043712873975424327,
-0.0042973988641788509,
-0.0042228261219020707,
-0.0041475855215081471,
-0.0040716935099886385,
-0.0039951666270302347,
-0.0039180215015042832,
-0.0038402748479455218,
-0.0037619434630221794,
-0.0036830442219972404,
-0.003603594075182002,
-0.0035236100443825375,
-0.0034431092193397956,
-0.0033621087541640779,
-0.0032806258637647925,
-0.0031986778202757198,
-0.003116281949477032,
-0.0030334556272147502,
-0.0029502162758181004,
-0.0028665813605153667,
-0.002782568385849562,
-0.0026981948920943286,
-0.002613478451670139,
-0.0025284366655629904,
-0.0024430871597447279,
-0.0023574475815969285,
-0.0022715355963380838,
-0.0021853688834555063,
-0.0020989651331425577,
-0.0020123420427415988,
-0.0019255173131933305,
-0.0018385086454937674,
-0.0017513337371590104,
-0.0016640102786987228,
-0.0015765559500989486,
-0.001488988417315008,
-0.0014013253287750488,
-0.001313584311895282,
-0.0012257829696066382,
-0.0011379388768950449,
-0.0010500695773544252,
-0.00096219257975425096,
-0.00087432535462135866,
-0.00078648533083763362,
-0.00069868989225324509,
-0.00061095637431727939,
-0.00052330206072480107,
-0.00043574418008249943,
-0.00034829990259291224,
-0.00026098633675724616,
-0.0001738205260989093,
-8.6819445906775801e-005,
--1.0609254296283521e-017,
--8.6620982486066483e-005,
--0.0001730267502910639,
--0.00025920063319867016,
--0.0003451260451813591,
--0.00043078648752209805,
--0.00051616555191079643,
--0.00060124692351587775,
--0.00068601438403010522,
--0.00077045181469014414,
--0.00085454319926933045,
--0.00093827262704312964,
--0.0010216242957265015,
--0.0011045825143832589,
--0.0011871317063062638,
--0.0012692564118680428,
--0.0013509412913416021,
--0.0014321711276910338,
--0.0015129308293307467,
--0.0015932054328537497,
--0.001672980105727381,
--0.0017522401489574791,
--0.0018309709997191761,
--0.0019091582339544359,
--0.0019867875689361923,
--0.0020638448657981346,
--0.0021403161320297077,
--0.0022161875239362985,
--0.0022914453490641409,
--0.0023660760685890203,
--0.0024400662996691661,
--0.0025134028177608708,
--0.0025860725588979223,
--0.0026580626219330126,
--0.0027293602707417312,
--0.0027999529363881346,
--0.0028698282192524678,
--0.002938973891119326,
--0.0030073778972272694,
--0.0030750283582786473,
--0.0031419135724099516,
--0.0032080220171219736,
--0.0032733423511694558,
--0.0033378634164102018,
--0.0034015742396134919,
--0.0034644640342269464,
--0.0035265222021019977,
--0.003587738335178013,
--0.003648102217123902,
--0.0037076038249379958,
--0.0037662333305051856,
--0.0038239811021117498,
--0.003880837705917206,
--0.0039367939073829605,
--0.0039918406726579337,
--0.0040459691699208725,
--0.0040991707706788515,
--0.004151437051022222,
--0.0042027597928355779,
--0.0042531309849647807,
--0.0043025428243397678,
--0.0043509877170531371,
--0.004398458279394152,
--0.0044449473388386623,
--0.0044904479349939129,
--0.0045349533204990253,
--0.0045784569618805195,
--0.0046209525403631954,
--0.0046624339526359004,
--0.0047028953115726231,
--0.0047423309469081789,
--0.0047807354058694044,
--0.0048181034537609479,
--0.0048544300745060123,
--0.0048897104711423866,
--0.0049239400662729228,
--0.0049571145024713921,
--0.0049892296426430234,
--0.005020281570340325,
--0.0050502665900337409,
--0.0050791812273375614,
--0.0051070222291908132,
--0.0051337865639936075,
--0.0051594714216986462,
--0.0051840742138581529,
--0.0052075925736262641,
--0.0052300243557170858,
--0.0052513676363183373,
--0.0052716207129609406,
--0.0052907821043443864,
--0.0053088505501183731,
--0.0053258250106206079,
--0.0053417046665708619,
--0.0053564889187217588,
--0.0053701773874661905,
--0.0053827699124016394,
--0.0053942665518516286,
--0.0054046675823443014,
--0.0054139734980487332,
--0.0054221850101687135,
--0.0054293030462945497,
--0.0054353287497130431,
--0.0054402634786757595,
--0.0054441088056259978,
--0.0054468665163845548,
--0.0054485386092947606,
--0.0054491272943267503,
--0.005448634992141565,
--0.0054470643331150977,
--0.0054444181563223434,
--0.005440699508482214,
--0.0054359116428631385,
--0.0054300580181498746,
--0.0054231422972718154,
--0.0054151683461930149,
--0.0054061402326644765,
--0.0053960622249387977,
--0.0053849387904477105,
--0.0053727745944427818,
--0.0053595744985996405,
--0.0053453435595861264,
--0.0053300870275946521,
--0.0053138103448392843,
--0.005296519144017884,
--0.0052782192467395097,
--0.0052589166619178961,
--0.0052386175841309104,
--0.0052173283919468719,
--0.0051950556462177127,
--0.0051718060883397289,
--0.0051475866384822601,
--0.0051224043937846252,
--0.0050962666265218079,
--0.0050691807822394064,
--0.0050411544778582234,
--0.0050121954997489736,
--0.0049823118017774896,
--0.0049515115033210641,
--0.0049198028872561575,
--0.004887194397918228,
--0.0048536946390337994,
--0.0048193123716256453,
--0.0047840565118912638,
--0.0047479361290553405,
--0.0047109604431964233,
--0.004673138823048725,
--0.0046344807837790389,
--0.0045949959847399156,
--0.0045546942271988012,
--0.0045135854520444198,
--0.0044716797374705066,
--0.0044289872966372908,
--0.0043855184753118035,
--0.0043412837494868428,
--0.00429629372297974,
--0.004250559125010908,
--0.0042040908077632024,
--0.0041568997439222271,
--0.0041089970241985803,
--0.0040603938548319316,
--0.004011101555078121,
--0.0039611315546794635,
--0.0039104953913189199,
--0.0038592047080586037,
--0.0038072712507633225,
--0.0037547068655095031,
--0.0037015234959803722,
--0.0036477331808474813,
--0.0035933480511395098,
--0.0035383803275989625,
--0.0034828423180269805,
--0.0034267464146169424,
--0.0033701050912776777,
--0.0033129309009464025,
--0.003255236472892636,
--0.0031970345100126351,
--0.0031383377861159373,
--0.0030791591432040555,
--0.0030195114887418143,
--0.002959407792922141,
--0.0028988610859249182,
--0.002837884455170248,
--0.0027764910425666007,
--0.0027146940417548961,
--0.002652506695348473,
--0.0025899422921702529,
--0.0025270141644866771,
--0.0024637356852399237,
--0.0024001202652784125,
--0.0023361813505864823,
--0.0022719324195132106,
--0.0022073869800019502,
--0.0021425585668200485,
--0.0020774607387901772,
--0.0020121070760230966,
--0.001946511177152942,
--0.0018806866565755358,
--0.0018146471416899859,
--0.0017484062701441465,
--0.0016819776870848318,
--0.0016153750424131596,
--0.0015486119880450506,
--0.0014817021751785198,
--0.0014146592515671382,
--0.0013474968588010696,
--0.0012802286295955291,
--0.0012128681850876817,
--0.0011454291321424562,
--0.0010779250606675714,
--0.0010103695409382021,
--0.00094277612093232079,
--0.00087515832367671261,
--0.00080752964460440715,
--0.00073990354892397928,
--0.0006722934690012195,
--0.0006047128017536436,
--0.00053717490605856765,
--0.00046969310017452783,
--0.0004022806591777183,
--0.00033495081241269651,
--0.00026771674095876801,
--0.00020059157511175706,
--0.00013358839188239209,
--6.6720212511018207e-005,
--9.3105749671934523e-018,
-6.6559343336879351e-005,
-0.00013294497830662098,
-0.00019914413125051613,
-0.00026514409643931241,
-0.00033093223844826161,
-0.00039649599451290022,
-0.00046182287686421115,
-0.00052690047504349647,
-0.00059171645819579342,
-0.00065625857734217012,
-0.00072051466762959983,
-0.00078447265055918956,
-0.00084812053619123687,
-0.00091144642532739906,
-0.00097443851166936388,
-0.0010370850839536996,
-0.0010993745280624692,
-0.0011612953291093285,
-0.0012228360735005042,
-0.0012839854509707851,
-0.0013447322565937139,
-0.0014050653927656592,
-0.0014649738711637222,
-0.0015244468146771259,
-0.0015834734593113495,
-0.0016420431560652945,
-0.0017001453727803688,
-0.0017577696959622888,
-0.0018149058325742306,
-0.001871543611801548,
-0.0019276729867879205,
-0.0019832840363423103,
-0.0020383669666164755,
-0.0020929121127529781,
-0.0021469099405035208,
-0.0022003510478168344,
-0.0022532261663965728,
-0.002305526163228132,
-0.0023572420420751995,
-0.0024083649449448642,
-0.0024588861535216034,
-0.0025087970905696296,
-0.0025580893213039448,
-0.0026067545547289448,
-0.0026547846449454186,
-0.0027021715924249422,
-0.0027489075452521239,
-0.0027949848003341053,
-0.0028403958045771682,
-0.0028851331560305342,
-0.00292918960499717,
-0.0029725580551112243,
-0.0030152315643820296,
-0.0030572033462049745,
-0.0030984667703383107,
-0.0031390153638465616,
-0.0031788428120099084,
-0.0032179429591998121,
-0.0032563098097205365,
-0.0032939375286164733,
-0.0033308204424453499,
-0.003366953040017294,
-0.0034023299730993654,
-0.003436946057085841,
-0.0034707962716340299,
-0.0035038757612655936,
-0.0035361798359334058,
-0.0035677039715538124,
-0.0035984438105042937,
-0.0036283951620867841,
-0.0036575540029560212,
-0.0036859164775136523,
-0.0037134788982675147,
-0.003740237746156538,
-0.0037661896708409601,
-0.0037913314909581138,
-0.0038156601943435718,
-0.0038391729382180593,
-0.0038618670493398215,
-0.0038837400241225964,
-0.0039047895287195201,
-0.0039250133990725551,
-0.0039444096409279273,
-0.0039629764298174438,
-0.0039807121110058772,
-0.003997615199404423,
-0.004013684379450439,
-0.0040289185049533485,
-0.0040433165989072406,
-0.0040568778532698059,
-0.0040696016287080803,
-0.0040814874543109855,
-0.0040925350272687875,
-0.0041027442125197494,
-0.0041121150423639504,
-0.0041206477160445881,
-0.0041283425992968371,
-0.0041352002238644941,
-0.0041412212869845018,
-0.0041464066508395906,
-0.0041507573419793196,
-0.0041542745507094784,
-0.0041569596304502935,
-0.0041588140970634868,
-0.0041598396281484588,
-0.0041600380623078529,
-0.0041594113983825917,
-0.0041579617946567926,
-0.0041556915680326725,
-0.0041526031931756963,
-0.0041486993016302673,
-0.0041439826809061544,
-0.0041384562735359582,
-0.0041321231761038612,
-0.0041249866382458769,
-0.0041170500616219911,
-0.0041083169988603181,
-0.0040987911524737047,
-0.0040884763737489473,
-0.0040773766616089661,
-0.0040654961614482767,
-0.0040528391639419598,
-0.0040394101038285207,
-0.0040252135586668738,
-0.0040102542475678373,
-0.0039945370299004669,
-0.0039780669039734262,
-0.0039608490056918704,
-0.0039428886071900555,
-0.0039241911154401562,
-0.0039047620708374088,
-0.0038846071457621632,
-0.0038637321431190348,
-0.0038421429948535739,
-0.0038198457604467139,
-0.00379684662538751,
-0.003773151899624419,
-0.0037487680159955612,
-0.0037237015286381301,
-0.0036979591113776825,
-0.0036715475560973156,
-0.0036444737710873642,
-0.0036167447793758758,
-0.00358836771704025,
-0.0035593498315004911,
-0.0035296984797944797,
-0.0034994211268353833,
-0.0034685253436521476,
-0.0034370188056128412,
-0.003404909290631788,
-0.0033722046773604149,
-0.003338912943362657,
-0.0033050421632749715,
-0.0032706005069517083,
-0.0032355962375958231,
-0.0032000377098757218,
-0.003163933368028581,
-0.0031272917439502225,
-0.0030901214552725379,
-0.0030524312034283531,
-0.0030142297717044957,
-0.0029755260232832243,
-0.0029363288992727116,
-0.0028966474167267152,
-0.0028564906666543027,
-0.0028158678120193638,
-0.0027747880857310809,
-0.0027332607886252618,
-0.0026912952874372405,
-0.0026489010127666228,
-0.0026060874570343817,
-0.0025628641724327211,
-0.0025192407688681916,
-0.0024752269118982696,
-0.002430832320662104,
-0.0023860667658057869,
-0.0023409400674025134,
-0.0022954620928679276,
-0.0022496427548714909,
-0.0022034920092438171,
-0.0021570198528809738,
-0.0021102363216454322,
-0.0020631514882647954,
-0.0020157754602284699,
-0.0019681183776824544,
-0.0019201904113230622,
-0.0018720017602899262,
-0.0018235626500585269,
-0.0017748833303326877,
-0.0017259740729377454,
-0.001676845169714384,
-0.0016275069304141684,
-0.0015779696805963217,
-0.0015282437595270386,
-0.0014783395180811784,
-0.0014282673166471445,
-0.0013780375230347827,
-0.0013276605103875764,
-0.0012771466550986856,
-0.0012265063347318725,
-0.0011757499259472226,
-0.0011248878024324334,
-0.0010739303328400245,
-0.0010228878787307135,
-0.00097177079252328035,
-0.00092058941545167803,
-0.00086935407552958435,
-0.00081807508552241904,
-0.00076676274092806775,
-0.00071542731796577603,
-0.00066407907157430717,
-0.00061272823341917125,
-0.000561385009909717,
-0.0005100595802264217,
-0.00045876209435853366,
-0.00040750267115243031,
-0.00035629139637139914,
-0.00030513832076684483,
-0.00025405345816144538,
-0.00020304678354456844,
-0.00015212823118031634,
-0.00010130769272850601,
-5.0595015379119649e-005,
-2.0301902222768197e-017,
--5.0467600700830633e-005,
--0.00010079808399924414,
--0.00015098179896374123,
--0.0002010091482497964,
--0.00025087058987850112,
--0.00030055663899989017,
--0.0003500578696399368,
--0.00039936491643180895,
--0.00044846847633023268,
--0.00049735931030900446,
--0.00054602824504171278,
--0.00059446617456452547,
--0.00064266406192164157,
--0.00069061294079247252,
--0.00073830391710079076,
--0.00078572817060505349,
--0.00083287695647015034,
--0.0008797416068196559,
--0.00092631353226921233,
--0.00097258422343990977,
--0.0010185452524519418,
--0.0010641882743981181,
--0.0011095050287969871,
--0.0011544873410253766,
--0.0011991271237300882,
--0.0012434163782184303,
--0.0012873471958276372,
--0.0013309117592726792,
--0.0013741023439722334,
--0.0014169113193528088,
--0.0014593311501308547,
--0.0015013543975722697,
--0.0015429737207296389,
--0.0015841818776563829,
--0.0016249717265984192,
--0.0016653362271624433,
--0.0017052684414609394,
--0.001744761535233944,
--0.0017838087789470935,
--0.0018224035488658235,
--0.0018605393281057381,
--0.0018982097076590155,
--0.001935408387396427,
--0.0019721291770451173,
--0.0020083659971418611,
--0.002044112879961753,
--0.0020793639704221236,
--0.0021141135269616773,
--0.0021483559223945143,
--0.0021820856447393984,
--0.0022152972980234889,
--0.0022479856030610916,
--0.0022801453982068715,
--0.0023117716400838139,
--0.0023428594042854923,
--0.002373403886052932,
--0.0024034004009255258,
--0.0024328443853665993,
--0.0024617313973629186,
--0.0024900571169983979,
--0.0025178173470021487,
--0.0025450080132702565,
--0.0025716251653618944,
--0.0025976649769692394,
--0.0026231237463615396,
--0.0026479978968030073,
--0.0026722839769447696,
--0.0026959786611905727,
--0.0027190787500366571,
--0.0027415811703853897,
--0.0027634829758328696,
--0.0027847813469305,
--0.0028054735914205199,
--0.002825557144445481,
--0.0028450295687317906,
--0.0028638885547472119,
--0.0028821319208325235,
--0.002899757613307288,
--0.0029167637065496848,
--0.0029331484030506554,
--0.0029489100334423222,
--0.0029640470565006748,
--0.0029785580591227545,
--0.0029924417562781397,
--0.0030056969909352123,
--0.0030183227339618591,
--0.0030303180840009769,
--0.0030416822673207961,
--0.0030524146376400703,
--0.0030625146759282931,
--0.0030719819901809794,
--0.0030808163151702841,
--0.0030890175121708148,
--0.0030965855686610148,
--0.0031035205980000369,
--0.0031098228390803997,
--0.0031154926559564624,
--0.0031205305374488465,
--0.0031249370967250298,
--0.0031287130708562106,
--0.0031318593203505285,
--0.0031343768286629585,
--0.0031362667016818506,
--0.0031375301671924425,
--0.0031381685743174215,
--0.003138183392934684,
--0.0031375762130725873,
--0.0031363487442827441,
--0.0031345028149906227,
--0.0031320403718241405,
--0.0031289634789203849,
--0.0031252743172107155,
--0.0031209751836844242,
--0.0031160684906311863,
--0.0031105567648624364,
--0.0031044426469119713,
--0.0030977288902159571,
--0.0030904183602725082,
--0.0030825140337811686,
--0.0030740189977624113,
--0.0030649364486574578,
--0.0030552696914086337,
--0.0030450221385204717,
--0.003034197309101806,
--0.0030227988278891528,
--0.0030108304242515531,
--0.0029982959311771365,
--0.0029851992842417139,
--0.0029715445205595972,
--0.0029573357777169166,
--0.0029425772926876797,
--0.0029272734007329158,
--0.0029114285342829991,
--0.0028950472218036904,
--0.0028781340866458204,
--0.0028606938458792105,
--0.0028427313091109493,
--0.0028242513772882001,
--0.0028052590414861457,
--0.0027857593816809629,
--0.0027657575655084476,
--0.0027452588470082777,
--0.0027242685653544882,
--0.0027027921435722113,
--0.0026808350872411842,
--0.0026584029831860949,
--0.0026355014981542446,
--0.0026121363774807707,
--0.0025883134437416819,
--0.0025640385953950603,
--0.0025393178054107404,
--0.0025141571198886905,
--0.0024885626566665555,
--0.0024625406039164668,
--0.0024360972187315606,
--0.0024092388257025777,
--0.0023819718154846803,
--0.0023543026433548624,
--0.0023262378277603673,
--0.0022977839488582579,
--0.0022689476470467186,
--0.0022397356214879679,
--0.0022101546286235852,
--0.0021802114806822809,
--0.0021499130441804274,
--0.00211926623841579,
--0.0020882780339547607,
--0.002056955451113359,
--0.0020253055584322261,
--0.0019933354711462103,
--0.0019610523496485406,
--0.0019284633979502889,
--0.0018955758621349336,
--0.0018623970288088397,
--0.0018289342235476836,
--0.0017951948093393353,
--0.0017611861850231462,
--0.0017269157837265855,
--0.001692391071298899,
--0.0016576195447426049,
--0.0016226087306427531,
--0.001587366183594548,
--0.0015518994846296338,
--0.0015162162396412042,
--0.0014803240778082623,
--0.0014442306500195466,
--0.0014079436272973393,
--0.0013714706992212083,
--0.0013348195723525596,
--0.0012979979686597383,
--0.0012610136239444062,
--0.0012238742862691763,
--0.001186587714387076,
--0.0011491616761730957,
--0.0011116039470580423,
--0.0010739223084649345,
--0.0010361245462485243,
--0.000998218449137998,
--0.00096021180718324059,
--0.00092211241020498467,
--0.00088392804624909849,
--0.0008456665000453361,
--0.00080733555147093625,
--0.00076894297401899577,
--0.00073049653327256193,
--0.0006920039853840407,
--0.00065347307556074268,
--0.00061491153655641691,
--0.00057632708716947635,
--0.0005377274307477955,
--0.00049912025370084736,
--0.00046051322401879696,
--0.00042191398979945138,
--0.00038333017778309459,
--0.00034476939189519504,
--0.00030623921179790488,
--0.00026774719144994193,
--0.00022930085767561403,
--0.00019090770874284355,
--0.00015257521295086084,
--0.00011431080722740326,
--7.6121895736196125e-005,
--3.8015848494264474e-005,
--5.9676426423826825e-018,
-3.7918352128140955e-005,
-7.5731948502053142e-005,
-0.00011343356930308529,
-0.00015101603560980083,
-0.00018847221071405969,
-0.00022579500142511322,
-0.00026297735936175358,
-0.00030001228223201749,
-0.00033689281510024824,
-0.00037361205164145234,
-0.00041016313538274333,
-0.00044653926093139073,
-0.00048273367518965554,
-0.00051873967855569519,
-0.00055455062611102328,
-0.000590159928793672,
-0.00062556105455716419,
-0.00066074752951520723,
-0.00069571293907170443,
-0.00073045092903590073,
-0.00076495520672263044,
-0.00079921954203752271,
-0.00083323776854668757,
-0.00086700378453111919,
-0.00090051155402515789,
-0.00093375510783947051,
-0.0009667285445678005,
-0.00099942603157768023,
-0.0010318418059847506,
-0.0010639701756108859,
-0.0010958055199253866,
-0.0011273422909697272,
-0.001158575014265232,
-0.0011894982897039377,
-0.0012201067924222332,
-0.0012503952736571606,
-0.0012803585615854291,
-0.0013099915621449776,
-0.0013392892598388187,
-0.0013682467185211192,
-0.0013968590821656767,
-0.0014251215756161467,
-0.0014530295053184674,
-0.001480578260034995,
-0.0015077633115405458,
-0.0015345802153000599,
-0.0015610246111278133,
-0.0015870922238281826,
-0.0016127788638179547,
-0.0016380804277298538,
-0.0016629928989974529,
-0.0016875123484213139,
-0.001711634934716283,
-0.001735356905039931,
-0.0017586745955020544,
-0.0017815844316551132,
-0.0018040829289658587,
-0.001826166693267598,
-0.0018478324211935934,
-0.0018690769005911491,
-0.0018898970109166963,
-0.0019102897236115163,
-0.0019302521024583987,
-0.0019497813039188793,
-0.0019688745774514359,
-0.001987529265810297,
-0.0020057428053249652,
-0.0020235127261606163,
-0.0020408366525590553,
-0.0020577123030605282,
-0.0020741374907062185,
-0.0020901101232215758,
-0.0021056282031803328,
-0.0021206898281494317,
-0.0021352931908145936,
-0.0021494365790869648,
-0.0021631183761904619,
-0.0021763370607301284,
-0.0021890912067414211,
-0.0022013794837204732,
-0.0022132006566354633,
-0.002224553585919008,
-0.0022354372274417476,
-0.0022458506324671344,
-0.0022557929475874937,
-0.0022652634146413846,
-0.0022742613706123647,
-0.0022827862475092958,
-0.0022908375722280874,
-0.0022984149663951743,
-0.0023055181461925844,
-0.0023121469221648993,
-0.0023183011990080549,
-0.0023239809753400845,
-0.0023291863434539845,
-0.0023339174890527302,
-0.0023381746909665086,
-0.0023419583208523914,
-0.0023452688428764572,
-0.0023481068133784995,
-0.0023504728805194795,
-0.002352367783911733,
-0.0023537923542322004,
-0.002354747512818662,
-0.0023552342712492278,
-0.0023552537309050854,
-0.002354807082516766,
-0.0023538956056939784,
-0.0023525206684391594,
-0.0023506837266449349,
-0.0023483863235755583,
-0.0023456300893325401,
-0.0023424167403045888,
-0.0023387480786020063,
-0.0023346259914757074,
-0.0023300524507210169,
-0.0023250295120664168,
-0.0023195593145473796,
-0.0023136440798654668,
-0.0023072861117328842,
-0.002300487795202606,
-0.0022932515959842919,
-0.0022855800597461665,
-0.0022774758114029923,
-0.002268941554390403,
-0.002259980069925649,
-0.0022505942162550896,
-0.002240786927888479,
-0.0022305612148203432,
-0.0022199201617385698,
-0.0022088669272204175,
-0.002197404742916157,
-0.0021855369127205346,
-0.0021732668119321904,
-0.0021605978864013935,
-0.0021475336516660706,
-0.0021340776920765608,
-0.0021202336599090818,
-0.002106005274468302,
-0.0020913963211790947,
-0.002076410650667793,
-0.0020610521778330212,
-0.0020453248809064249,
-0.0020292328005035226,
-0.0020127800386647394,
-0.0019959707578870657,
-0.0019788091801463707,
-0.0019612995859106916,
-0.0019434463131446404,
-0.0019252537563052663,
-0.0019067263653294148,
-0.001887868644613088,
-0.0018686851519826486,
-0.001849180497658463,
-0.0018293593432109579,
-0.0018092264005094472,
-0.0017887864306639,
-0.0017680442429598843,
-0.0017470046937869302,
-0.001725672685560567,
-0.0017040531656381595,
-0.0016821511252288804,
-0.0016599715982980499,
-0.0016375196604660348,
-0.00161480042790184,
-0.0015918190562118687,
-0.0015685807393238198,
-0.0015450907083662266,
-0.001521354230543541,
-0.0014973766080072879,
-0.0014731631767234412,
-0.0014487193053360965,
-0.0014240503940278898,
-0.0013991618733773217,
-0.0013740592032131962,
-0.0013487478714663253,
-0.0013232333930189545,
-0.0012975213085518796,
-0.0012716171833898194,
-0.0012455266063448106,
-0.00121925518855833,
-0.0011928085623420599,
-0.001166192380017737,
-0.0011394123127560182,
-0.0011124740494150359,
-0.0010853832953784345,
-0.001058145771393436,
-0.0010307672124089035,
-0.0010032533664138395,
-0.00097560999327649903,
-0.00094784286358428065,
-0.00091995775748455913,
-0.00089196046352691099,
-0.00086385677750680837,
-0.00083565250131084309,
-0.00080735344176414666,
-0.00077896540947972818,
-0.00075049421771033954,
-0.00072194568120277885,
-0.00069332561505506022,
-0.00066463983357666837,
-0.00063589414915197345,
-0.0006070943711070319,
-0.00057824630458016158,
-0.00054935574939631862,
-0.00052042849894556832,
-0.00049147033906583035,
-0.00046248704693012768,
-0.00043348438993850795,
-0.00040446812461495779,
-0.00037544399550920024,
-0.00034641773410408119,
-0.00031739505772823229,
-0.00028838166847458422,
-0.00025938325212462057,
-0.00023040547707887387,
-0.00020145399329354476,
-0.00017253443122382334,
-0.00014365240077357481,
-0.00011481349025207707,
-8.6023265337783916e-005,
-5.7287268049099487e-005,
-2.8611015722833745e-005,
--2.4978016311763453e-018,
--2.8540314180494806e-005,
--5.700448958035948e-005,
--8.5387117652223034e-005,
--0.00011368281952179527,
--0.00014188624696137629,
--0.00016999208335505338,
--0.00019799504465491398,
--0.00022588988032842103,
--0.00025367137429668795,
--0.00028133434586350711,
--0.00030887365063498272,
--0.00033628418142962264,
--0.00036356086917866266,
--0.00039069868381665974,
--0.00041769263516202405,
--0.00044453777378735564,
--0.00047122919187954972,
--0.00049776202408956,
--0.00052413144837146143,
--0.00055033268681097599,
--0.00057636100644296352,
--0.00060221172005822774,
--0.00062788018699906363,
--0.00065336181394361128,
--0.00067865205567900402,
--0.00070374641586300592,
--0.00072864044777403846,
--0.0007533297550496006,
--0.00077780999241296265,
--0.00080207686638784784,
--0.00082612613600126889,
--0.00084995361347404682,
--0.00087355516489940471,
--0.00089692671090906841,
--0.00092006422732706663,
--0.00094296374581096497,
--0.00096562135448070993,
--0.00098803319853458019,
--0.0010101954808525743,
--0.0010321044625868612,
--0.0010537564637394352,
--0.001075147863726733,
--0.0010962751019311704,
--0.0011171346782395805,
--0.0011377231535685405,
--0.0011580371503763435,
--0.001178073353161641,
--0.001197828508948881,
--0.0012172994277600711,
--0.0012364829830732579,
--0.0012553761122673264,
--0.0012739758170533389,
--0.0012922791638921845,
--0.0013102832843985086,
--0.0013279853757309896,
--0.0013453827009688908,
--0.0013624725894747646,
--0.0013792524372433729,
--0.0013957197072367524,
--0.0014118719297054336,
--0.0014277067024957301,
--0.0014432216913431589,
--0.0014584146301518486,
--0.0014732833212601441,
--0.0014878256356920915,
--0.0015020395133950577,
--0.0015159229634633263,
--0.001529474064347765,
--0.0015426909640514519,
--0.0015555718803114016,
--0.0015681151007661755,
--0.0015803189831097146,
--0.0015921819552310668,
--0.0016037025153401992,
--0.0016148792320799686,
--0.0016257107446240246,
--0.0016361957627609616,
--0.0016463330669644837,
--0.0016561215084498397,
--0.0016655600092163275,
--0.001674647562076117,
--0.0016833832306691978,
--0.0016917661494647298,
--0.0016997955237486458,
--0.001707470629597618,
--0.0017147908138394428,
--0.0017217554939998839,
--0.0017283641582359767,
--0.0017346163652559329,
--0.0017405117442255791,
--0.0017460499946615261,
--0.0017512308863110125,
--0.0017560542590185158,
--0.0017605200225792139,
--0.001764628156579362,
--0.0017683787102236244,
--0.0017717718021494422,
--0.0017748076202285371,
--0.00177748642135557,
--0.0017798085312240783,
--0.0017817743440897648,
--0.0017833843225211826,
--0.0017846389971379537,
--0.0017855389663365632,
--0.0017860848960038222,
--0.0017862775192181268,
--0.0017861176359385389,
--0.0017856061126818544,
--0.0017847438821877043,
--0.0017835319430717894,
--0.0017819713594673899,
--0.0017800632606551918,
--0.0017778088406815867,
--0.0017752093579655182,
--0.0017722661348939831,
--0.0017689805574063306,
--0.0017653540745674239,
--0.0017613881981297912,
--0.0017570845020849217,
--0.0017524446222037444,
--0.0017474702555665056,
--0.0017421631600820532,
--0.0017365251539967518,
--0.0017305581153930953,
--0.0017242639816781287,
--0.0017176447490618843,
--0.0017107024720258402,
--0.0017034392627816664,
--0.0016958572907202522,
--0.0016879587818512565,
--0.001679746018233253,
--0.0016712213373946514,
--0.0016623871317454672,
--0.0016532458479801295,
--0.0016437999864714621,
--0.001634052100655961,
--0.0016240047964104984,
--0.00161366073142065,
--0.0016030226145407008,
--0.0015920932051455999,
--0.0015808753124748603,
--0.001569371794968654,
--0.0015575855595962708,
--0.0015455195611769857,
--0.001533176801693561,
--0.0015205603295985273,
--0.0015076732391133484,
--0.0014945186695207605,
--0.0014810998044501901,
--0.0014674198711566748,
--0.0014534821397932853,
--0.001439289922677214,
--0.0014248465735497424,
--0.0014101554868302263,
--0.0013952200968642553,
--0.0013800438771660749,
--0.0013646303396555801,
--0.0013489830338898853,
--0.0013331055462897908,
--0.0013170014993611067,
--0.0013006745509111916,
--0.0012841283932607437,
--0.0012673667524511062,
--0.0012503933874470682,
--0.0012332120893356036,
--0.0012158266805204281,
--0.0011982410139127764,
--0.0011804589721183345,
--0.001162484466620686,
--0.0011443214369613801,
--0.0011259738499167292,
--0.0011074456986715153,
--0.00108874100198984,
--0.0010698638033832682,
--0.0010508181702762603,
--0.0010316081931693877,
--0.0010122379848001568,
--0.00099271167930185182,
--0.00097303343136038642,
--0.00095320741536944454,
--0.0009332378245840773,
--0.0009131288702728537,
--0.00089288478086869071,
--0.00087250980111869985,
--0.00085200819123305068,
--0.00083138422603307226,
--0.00081064219409877469,
--0.00078978639691591225,
--0.00076882114802277583,
--0.00074775077215692438,
--0.00072657960440181547,
--0.00070531198933385087,
--0.00068395228016961867,
--0.00066250483791379028,
--0.00064097403050757747,
--0.00061936423197816071,
--0.00059767982158900478,
--0.00057592518299149915,
--0.00055410470337771526,
--0.00053222277263477739,
--0.00051028378250086764,
--0.00048829212572286602,
--0.00046625219521613851,
--0.00044416838322624988,
--0.00042204508049303109,
--0.00039988667541692423,
--0.0003776975532279922,
--0.00035548209515749501,
--0.00033324467761249282,
--0.00031098967135320579,
--0.00028872144067368518,
--0.0002664443425856903,
--0.00024416272600600528,
--0.00022188093094732363,
--0.00019960328771283979,
--0.00017733411609468486,
--0.00015507772457640432,
--0.00013283840953946856,
--0.00011062045447410491,
--8.8428129194576804e-005,
--6.626568905895958e-005,
--4.4137374193529353e-005,
--2.2047408722072105e-005,
--3.8463573494755484e-018,
-2.2000662146262692e-005,
-4.3950406174980413e-005,
-6.5845079579250867e-005,
-8.7680549631770355e-005,
-0.00010945270412409232,
-0.00013115745210013724,
-0.00015279072458384052,
-0.00017434847530090676,
-0.00019582668139456186,
-0.0002172213441350199,
-0.00023852848962278039,
-0.00025974416948534699,
-0.00028086446156764486,
-0.00030188547061564736,
-0.00032280332895333823,
-0.00034361419715275149,
-0.00036431426469722288,
-0.00038489975063736023,
-0.0004053669042400324,
-0.00042571200562996938,
-0.0004459313664241085,
-0.00046602133035842611,
-0.00048597827390716429,
-0.00050579860689445007,
-0.00052547877309821588,
-0.00054501525084619628,
-0.0005644045536039922,
-0.00058364323055524992,
-0.0006027278671735444,
-0.00062165508578622311,
-0.00064042154612988216,
-0.00065902394589757284,
-0.00067745902127753783,
-0.00069572354748339324,
-0.00071381433927576309,
-0.00073172825147530571,
-0.00074946217946691605,
-0.00076701305969517207,
-0.0007843778701509095,
-0.00080155363084884505,
-0.00081853740429620777,
-0.00083532629595230103,
-0.00085191745467889696,
-0.00086830807318156772,
-0.00088449538844159248,
-0.00090047668213871649,
-0.00091624928106444738,
-0.0009318105575260501,
-0.00094715792974098658,
-0.00096228886222193724,
-0.00097720086615215814,
-0.00099189149975138606,
-0.0010063583686320036,
-0.001020599126145527,
-0.0010346114737194774,
-0.0010483931611843548,
-0.0010619419870909383,
-0.0010752557990176836,
-0.0010883324938683462,
-0.0011011700181596488,
-0.0011137663682991095,
-0.001126119590852821,
-0.0011382277828034261,
-0.001150089091797985,
-0.0011617017163859,
-0.00117306390624681,
-0.0011841739624084491,
-0.001195030237454459,
-0.0012056311357221377,
-0.0012159751134901001,
-0.0012260606791559007,
-0.0012358863934035407,
-0.0012454508693608671,
-0.0012547527727468887,
-0.0012637908220090341,
-0.0012725637884502495,
-0.0012810704963460693,
-0.0012893098230515117,
-0.001297280699097987,
-0.0013049821082800755,
-0.0013124130877322253,
-0.0013195727279954534,
-0.0013264601730739679,
-0.0013330746204817544,
-0.0013394153212791797,
-0.0013454815800996024,
-0.0013512727551659672,
-0.001356788258297572,
-0.0013620275549067451,
-0.0013669901639857623,
-0.0013716756580837957,
-0.0013760836632741187,
-0.0013802138591113961,
-0.0013840659785792897,
-0.0013876398080282194,
-0.0013909351871035181,
-0.001393952008663845,
-0.0013966902186899847,
-0.0013991498161840634,
-0.0014013308530592074,
-0.0014032334340196946,
-0.0014048577164316467,
-0.0014062039101843066,
-0.001407272277541954,
-0.0014080631329865072,
-0.0014085768430508461,
-0.0014088138261429508,
-0.0014087745523608617,
-0.001408459543298548,
-0.0014078693718427434,
-0.0014070046619607788,
-0.0014058660884795162,
-0.0014044543768554007,
-0.0014027703029357368,
-0.0014008146927112102,
-0.0013985884220597546,
-0.0013960924164818313,
-0.0013933276508271628,
-0.0013902951490130044,
-0.00138699598373405,
-0.0013834312761639854,
-0.0013796021956488586,
-0.0013755099593922161,
-0.0013711558321322054,
-0.0013665411258106334,
-0.0013616671992341095,
-0.0013565354577273346,
-0.0013511473527786087,
-0.0013455043816776699,
-0.0013396080871459078,
-0.0013334600569590764,
-0.0013270619235625689,
-0.0013204153636793333,
-0.0013135220979105515,
-0.0013063838903291328,
-0.0012990025480661348,
-0.0012913799208902231,
-0.0012835179007801474,
-0.0012754184214905527,
-0.0012670834581109528,
-0.0012585150266182011,
-0.0012497151834223409,
-0.001240686024906091,
-0.0012314296869580369,
-0.0012219483444995615,
-0.0012122442110056252,
-0.001202319538019576,
-0.0011921766146620162,
-0.0011818177671338427,
-0.0011712453582135727,
-0.0011604617867490624,
-0.0011494694871436975,
-0.0011382709288371982,
-0.0011268686157811111,
-0.0011152650859091091,
-0.001103462910602206,
-0.001091464694148981,
-0.0010792730732009507,
-0.0010668907162231561,
-0.0010543203229401031,
-0.0010415646237771658,
-0.0010286263792975341,
-0.0010155083796348466,
-0.001002213443921671,
-0.00098874441971369235,
-0.00097510418241017775,
-0.00096129563467034051,
-0.00094732170582609721,
-0.00093318535129101928,
-0.00091888955196589149,
-0.00090443731364070272,
-0.00088983166639353844,
-0.00087507566398600594,
-0.00086017238325578169,
-0.00084512492350610714,
-0.00082993640589245276,
-0.00081460997280643458,
-0.00079914878725712208,
-0.00078355603224982751,
-0.00076783491016251318,
-0.00075198864211992178,
-0.00073602046736554816,
-0.00071993364263157216,
-0.00070373144150685763,
-0.00068741715380315224,
-0.00067099408491958239,
-0.00065446555520557912,
-0.00063783489932233838,
-0.00062110546560293516,
-0.00060428061541119619,
-0.00058736372249953864,
-0.00057035817236566111,
-0.00055326736160843924,
-0.0005360946972831199,
-0.00051884359625580163,
-0.00050151748455728898,
-0.00048411979673670269,
-0.00046665397521459195,
-0.00044912346963613581,
-0.00043153173622391926,
-0.00041388223713100859,
-0.00039617843979407688,
-0.00037842381628680846,
-0.00036062184267368315,
-0.00034277599836425631,
-0.00032488976546803588,
-0.00030696662815008326,
-0.000289010071987436,
-0.00027102358332647432,
-0.000253010648641337,
-0.00023497475389349664,
-0.00021691938389260714,
-0.00019884802165871435,
-0.00018076414778606348,
-0.0001626712398082329,
-0.00014457277156533743,
-0.00012647221257275408,
-0.00010837302739196864,
-9.0278675003266232e-005,
-7.2192608180645483e-005,
-5.4118272869043366e-005,
-3.6059107563828837e-005,
-1.8018542692650681e-005,
--1.259430308216258e-018,
--1.7993108065674893e-005,
--3.5957378962063317e-005,
--5.3889420660258145e-005,
--7.1785852249048031e-005,
--8.9643304536163386e-005,
--0.00010745842064636794,
--0.00012522785661629865,
--0.00014294828198595813,
--0.00016061638038676113,
--0.00017822885012604042,
--0.00019578240476791767,
--0.00021327377371044325,
--0.00023069970275891501,
--0.00024805695469527951,
--0.0002653423098435278,
--0.00028255256663100984,
--0.00029968454214545899,
--0.00031673507268800086,
--0.00033370101432144881,
--0.00035057924341442789,
--0.00036736665718077176,
--0.00038406017421448776,
--0.00040065673501982343,
--0.00041715330253673473,
--0.00043354686266121236,
--0.00044983442476099155,
--0.00046601302218597608,
--0.00048207971277365385,
--0.00049803157934930368,
--0.00051386573022093804,
--0.00052957929966889936,
--0.00054516944843004404,
--0.00056063336417642919,
--0.00057596826198843827,
--0.00059117138482227402,
--0.00060624000397173697,
--0.00062117141952423784,
--0.00063596296081095728,
--0.00065061198685109969,
--0.00066511588679016775,
--0.00067947208033219367,
--0.0006936780181658682,
--0.00070773118238450818,
--0.00072162908689972992,
--0.00073536927784895515,
--0.00074894933399649859,
--0.00076236686712819,
--0.00077561952243958981,
--0.00078870497891775219,
--0.0008016209497162778,
--0.00081436518252388658,
--0.0008269354599260984,
--0.0008393295997604467,
--0.00085154545546471975,
--0.00086358091641844544,
--0.00087543390827749109,
--0.00088710239330174866,
--0.00089858437067584116,
--0.00090987787682283408,
--0.00092098098571088505,
--0.00093189180915280825,
--0.00094260849709850629,
--0.0009531292379202326,
--0.00096345225869064427,
--0.00097357582545361493,
--0.00098349824348778502,
--0.00099321785756272918,
--0.0010027330521879495,
--0.0010120422518542784,
--0.0010211439212680505,
--0.0010300365655777309,
--0.0010387187305931876,
--0.0010471890029974216,
--0.0010554460105507654,
--0.0010634884222875873,
--0.0010713149487054791,
--0.0010789243419468001,
--0.0010863153959726696,
--0.0010934869467293465,
--0.0011004378723069729,
--0.0011071670930906902,
--0.0011136735719040856,
--0.0011199563141449825,
--0.0011260143679135465,
--0.0011318468241326969,
--0.0011374528166608329,
--0.0011428315223968376,
--0.0011479821613773857,
--0.0011529039968665193,
--0.0011575963354375095,
--0.0011620585270469973,
--0.0011662899651014064,
--0.0011702900865156309,
--0.0011740583717639796,
--0.0011775943449234636,
--0.0011808975737092749,
--0.0011839676695026289,
--0.0011868042873708546,
--0.0011894071260798189,
--0.0011917759280986357,
--0.001193910479596719,
--0.001195810610433134,
--0.0011974761941383378,
--0.0011989071478882357,
--0.0012001034324706434,
--0.0012010650522441186,
--0.0012017920550892,
--0.001202284532352092,
--0.0012025426187807621,
--0.0012025664924535399,
--0.0012023563747001734,
--0.0012019125300154175,
--0.0012012352659651537,
--0.001200324933085063,
--0.0011991819247719078,
--0.0011978066771674088,
--0.0011961996690347824,
--0.0011943614216279523,
--0.0011922924985534693,
--0.0011899935056251657,
--0.0011874650907116016,
--0.0011847079435762995,
--0.0011817227957108354,
--0.0011785104201608187,
--0.0011750716313447937,
--0.0011714072848660747,
--0.0011675182773176276,
--0.0011634055460799369,
--0.0011590700691120361,
--0.0011545128647355803,
--0.00114973499141215,
--0.0011447375475137573,
--0.0011395216710866109,
--0.0011340885396082091,
--0.0011284393697377807,
--0.0011225754170601468,
--0.0011164979758230436,
--0.0011102083786679589,
--0.0011037079963545355,
--0.0010969982374785961,
--0.001090080548183849,
--0.001082956411867311,
--0.0010756273488785324,
--0.001068094916212689,
--0.0010603607071974826,
--0.0010524263511741464,
--0.0010442935131723546,
--0.0010359638935793045,
--0.0010274392278028573,
--0.0010187212859289398,
--0.0010098118723732335,
--0.0010007128255271973,
--0.00099142601739841485,
--0.00098195335324551794,
--0.00097229677120758357,
--0.00096245824192815017,
--0.00095243976817390721,
--0.00094224338444812313,
--0.00093187115659888525,
--0.00092132518142222497,
--0.00091060758626018874,
--0.00089972052859394868,
--0.00088866619563200049,
--0.00087744680389353815,
--0.0008660645987870791,
--0.00085452185418440736,
--0.00084282087198992058,
--0.00083096398170544349,
--0.00081895353999060267,
--0.00080679193021881296,
--0.00079448156202903116,
--0.00078202487087319732,
--0.00076942431755958453,
--0.00075668238779216595,
--0.00074380159170594486,
--0.00073078446339833614,
--0.00071763356045686231,
--0.00070435146348298287,
--0.00069094077561248463,
--0.00067740412203205118,
--0.00066374414949255274,
--0.00064996352581885811,
--0.00063606493941635795,
--0.00062205109877426154,
--0.00060792473196575431,
--0.00059368858614511171,
--0.00057934542704183385,
--0.00056489803845191774,
--0.00055034922172632762,
--0.00053570179525676352,
--0.00052095859395882263,
--0.00050612246875262148,
--0.00049119628604097439,
--0.0004761829271853088,
--0.00046108528797909399,
--0.00044590627811940357,
--0.00043064882067615453,
--0.00041531585155952112,
--0.00039991031898529918,
--0.00038443518293853409,
--0.00036889341463549387,
--0.00035328799598395241,
--0.00033762191904185941,
--0.00032189818547470307,
--0.00030611980601144263,
--0.0002902897998991963,
--0.00027441119435675612,
--0.00025848702402702793,
--0.00024252033042848322,
--0.00022651416140571804,
--0.00021047157057921278,
--0.00019439561679437814,
--0.00017828936356998961,
--0.00016215587854609415,
--0.0001459982329314864,
--0.00012981950095084692,
--0.00011362275929163097,
--9.7411086550805334e-005,
--8.1187562681522504e-005,
--6.4955268439808662e-005,
--4.8717284831473526e-005,
--3.2476692558989092e-005,
--1.623657146900403e-005,
-5.1059286559943242e-018
-};
-
-// From a DSP perspective, understanding how resampling works is easiest if you consider the windowed sinc filter 
-// to be centered around the y-axis (i.e. value of zero on the x axis).  Having negative indices in an array in code 
-// is something I prefer to avoid.  So this function does the math on the given x position to find the index in the 
-// array above and also interpolates a value when it lands at a fractional index.  For more info on this please see 
-// the document ResamplingUsingWindowedSincFilter.odg in SabbaticalNotes for details.
 double Signal::GetSincValue(double xPosition)
 {
-	// If the x position is 0.0 the y Position on a Sinc Filter is 1.0
-	if(xPosition == 0.0)
+	static const auto table{WindowedSincTable::GetTable(static_cast<std::size_t>(SINC_SAMPLES_PER_X_INTEGER), SINC_ZERO_CROSSINGS_PER_SIDE)};
+	return table->GetValue(xPosition);
+}
+
+template<typename T>
+Signal::BasicWindowedSincTable<T>::BasicWindowedSincTable(std::size_t samplesPerXInteger, std::size_t zeroCrossingsPerSide, SincWindow window) :
+	samplesPerXInteger_{static_cast<double>(samplesPerXInteger)},
+	window_{window}
+{
+	if(samplesPerXInteger == 0 || zeroCrossingsPerSide == 0)
 	{
-		return 1.0;
+		Utilities::ThrowException("A windowed sinc table needs at least one value per zero crossing and one zero crossing per side");
 	}
 
-	// If the x position is so far down the axis its y value is basically zero.
-	if(xPosition > MAX_X_POSITION_POSITIVE || xPosition < MIN_X_POSITION_POSITIVE )
+	const double pi{3.14159265358979323846};
+	std::size_t centerPoint{samplesPerXInteger * zeroCrossingsPerSide};
+	double samplesInSincFilter{static_cast<double>((2 * centerPoint) + 1)};
+	double centerOfSincFilter{samplesInSincFilter / 2.0};
+
+	// Both the sinc and the window are exactly 1.0 at the center
+	std::vector<double> values(centerPoint + 1, 1.0);
+	for(std::size_t i{1}; i <= centerPoint; ++i)
 	{
-		return 0.0;
+		double xPosition{static_cast<double>(i)};
+		double sincValue{std::sin(pi * xPosition / samplesPerXInteger_) / (pi * xPosition / samplesPerXInteger_)};
+
+		// The window is centered on the sinc, so it's evaluated half the filter length along
+		double windowPosition{xPosition + centerOfSincFilter};
+		double windowFactor{(window_ == SincWindow::HAMMING) ? 
+							0.54 - 0.46 * std::cos(2.0 * pi * windowPosition / samplesInSincFilter) : 
+							0.42 - 0.5 * std::cos(2.0 * pi * windowPosition / samplesInSincFilter) + 0.08 * std::cos(4.0 * pi * windowPosition / samplesInSincFilter)};
+
+		values[i] = sincValue * windowFactor;
 	}
 
-	if(xPosition > 0.0)
+	// The last value has no next value, its difference is zero
+	valuesAndDifferences_.resize(2 * values.size());
+	for(std::size_t i{0}; i < values.size(); ++i)
 	{
-		// Find the base index into the SINC_VALUE table
-		int64_t baseIndex = static_cast<int64_t>(xPosition);	
+		valuesAndDifferences_[2 * i] = static_cast<T>(values[i]);
+		valuesAndDifferences_[(2 * i) + 1] = static_cast<T>((i + 1 < values.size()) ? values[i + 1] - values[i] : 0.0);
+	}
 
-		// Get the remainder beyond this base index
-		double remainder = xPosition - static_cast<double>(baseIndex);
+	maxXPosition_ = static_cast<double>(centerPoint);
+}
 
-		baseIndex += SINC_CENTER_POINT ;
+template<typename T>
+std::shared_ptr<const Signal::BasicWindowedSincTable<T>> Signal::BasicWindowedSincTable<T>::GetTable(std::size_t samplesPerXInteger, 
+																									  std::size_t zeroCrossingsPerSide, SincWindow window)
+{
+	static std::mutex mutex;
+	static std::map<std::tuple<std::size_t, std::size_t, SincWindow>, std::weak_ptr<const BasicWindowedSincTable>> tables;
 
-		// Calculate an (interpolated) yet more exact y-value for the given x position
-		return SINC_VALUES[baseIndex] + ((SINC_VALUES[baseIndex + 1] -  SINC_VALUES[baseIndex]) * remainder);
-	}
-	else
+	auto key{std::make_tuple(samplesPerXInteger, zeroCrossingsPerSide, window)};
+	return GetCachedValue(tables, mutex, key, [&]()
 	{
-		// Find the base index into the SINC_VALUE  table
-		int64_t indexAsInt = static_cast<int64_t>(xPosition);	
+		return std::make_shared<const BasicWindowedSincTable>(samplesPerXInteger, zeroCrossingsPerSide, window);
+	});
+}
 
-		// Get the remainder beyond this base index
-		double remainder = (xPosition - static_cast<double>(indexAsInt)) * -1;
+template<typename T>
+double Signal::BasicWindowedSincTable<T>::GetSamplesPerXInteger() const
+{
+	return samplesPerXInteger_;
+}
 
-		int64_t baseIndex = SINC_CENTER_POINT + indexAsInt;
+template<typename T>
+double Signal::BasicWindowedSincTable<T>::GetMaxXPosition() const
+{
+	return maxXPosition_;
+}
 
-		// Calculate an (interpolated) yet more exact y-value for the given x position
-		return SINC_VALUES[baseIndex] + ((SINC_VALUES[baseIndex - 1] -  SINC_VALUES[baseIndex]) * remainder);
-	}
+template<typename T>
+Signal::SincWindow Signal::BasicWindowedSincTable<T>::GetWindow() const
+{
+	return window_;
 }
+
+template class Signal::BasicWindowedSincTable<double>;
+template class Signal::BasicWindowedSincTable<float>;
@@ -25,23 +25,97 @@
  */
 
 //! @file WindowedSincValues.h
-//! @brief Lookup table for windowed sinc values.
+//! @brief Lookup tables for windowed sinc values.
 
 #pragma once
 
+#include <cmath>
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 namespace Signal {
 
+	//! The resolution and extent of the windowed sinc values the resampler has always used.
 	const double SINC_SAMPLES_PER_X_INTEGER{224.0};
-	const std::size_t SINC_VALUE_SIZE{9857};  //4928 on both sides plus 1.0 in the middle
-	const std::size_t SINC_CENTER_POINT{4928};
-	const double MAX_X_POSITION_POSITIVE{4928.0};
-	const double MIN_X_POSITION_POSITIVE{-4928.0};
+	const std::size_t SINC_ZERO_CROSSINGS_PER_SIDE{22};
 
-	//! Get the sinc value for the given x-axis position.
+	//! Get the sinc value for the given x-axis position, from the table with SINC_SAMPLES_PER_X_INTEGER values per 
+	//! zero crossing and SINC_ZERO_CROSSINGS_PER_SIDE zero crossings on each side.
 	//
 	//! See chapter 16 of "The Scientists' and Engineers Guide to DSP" for more on the "Windowed-Sinc Filters"
 	double GetSincValue(double xPosition);
 
+	//! The window applied to the sinc function.
+	enum class SincWindow
+	{
+		HAMMING,	//!< 0.54 - 0.46cos(), the resampler's window
+		BLACKMAN	//!< 0.42 - 0.5cos() + 0.08cos(), a lower sidelobe level for a wider main lobe
+	};
+
+	//! A table of windowed sinc values, calculated from the number of values per zero crossing of the sinc function, 
+	//! the number of zero crossings on each side of the center and the window.
+	//
+	//! The values are stored as the sample type, so float tables take half the memory (and cache) of double tables.  
+	//! Values are looked up in double.
+	//!
+	//! Since the windowed sinc is symmetric only the values for x positions of zero and up are kept, each next to the 
+	//! difference from it to the next value.  A value is then the absolute x position's table value plus the fraction 
+	//! of the difference, with nothing to branch on, so GetValues() vectorizes.
+	template<typename T>
+	class BasicWindowedSincTable
+	{
+		public:
+			//! Calculate a table with samplesPerXInteger values per zero crossing and zeroCrossingsPerSide zero crossings 
+			//! on each side of the center.
+			BasicWindowedSincTable(std::size_t samplesPerXInteger, std::size_t zeroCrossingsPerSide, SincWindow window=SincWindow::HAMMING);
+
+			//! Returns the table for the given parameters.  It's calculated on first use and shared while anything 
+			//! holds it, then freed and calculated again if it's needed after that.
+			static std::shared_ptr<const BasicWindowedSincTable> GetTable(std::size_t samplesPerXInteger, std::size_t zeroCrossingsPerSide, 
+														   SincWindow window=SincWindow::HAMMING);
+
+			//! Returns the number of table values between zero crossings of the sinc function.
+			double GetSamplesPerXInteger() const;
+
+			//! Returns the largest x position the table holds a value for.  Values past it are zero.
+			double GetMaxXPosition() const;
+
+			//! Returns the window applied to the sinc function.
+			SincWindow GetWindow() const;
+
+			//! Get the sinc value for the given x-axis position, in samples of this table.
+			double GetValue(double xPosition) const
+			{
+				double distance{std::fabs(xPosition)};
+				return (distance < maxXPosition_) ? Interpolate(distance) : 0.0;
+			}
+
+			//! Get the sinc values for the given x-axis positions, which must all be within GetMaxXPosition() of zero.
+			void GetValues(const double* xPositions, std::size_t count, double* values) const
+			{
+				for(std::size_t i{0}; i < count; ++i)
+				{
+					values[i] = Interpolate(std::fabs(xPositions[i]));
+				}
+			}
+
+		private:
+			double Interpolate(double distance) const
+			{
+				std::size_t index{static_cast<std::size_t>(distance)};
+				const T* valueAndDifference{valuesAndDifferences_.data() + 2 * index};
+				return valueAndDifference[0] + valueAndDifference[1] * (distance - static_cast<double>(index));
+			}
+
+			// Interleaved pairs of the value at each x position from zero and the difference to the next value
+			std::vector<T> valuesAndDifferences_;
+			double samplesPerXInteger_;
+			double maxXPosition_;
+			SincWindow window_;
+	};
+
+	using WindowedSincTable = BasicWindowedSincTable<double>;
+	using WindowedSincTableFloat = BasicWindowedSincTable<float>;
+
 }
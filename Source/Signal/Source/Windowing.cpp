@@ -31,9 +31,11 @@
 
 namespace Signal {
 
-void BlackmanWindow(std::vector<double>& inputSignal, bool inverse, bool reverse, double startPercent, double endPercent)
+// The output may point to the samples of the input to window in place
+template<typename T>
+void BlackmanWindow(const BasicAudioDataView<T>& inputSignal, T* outputSignal, bool inverse, bool reverse, double startPercent, double endPercent)
 {
-	std::size_t size{inputSignal.size()};
+	std::size_t size{inputSignal.GetSize()};
 
 	double bufferSizeAsDouble{static_cast<double>(size)};
 
@@ -41,7 +43,7 @@ void BlackmanWindow(std::vector<double>& inputSignal, bool inverse, bool reverse
 	std::size_t startIndex = static_cast<std::size_t>(static_cast<double>(newSize) * (startPercent / 100.0) + 0.5);
 	std::size_t endIndex = static_cast<std::size_t>(static_cast<double>(newSize) * (endPercent / 100.0) + 0.5);
 
-	if(inputSignal.size() != (endIndex - startIndex))
+	if(inputSignal.GetSize() != (endIndex - startIndex))
 	{
 		Utilities::Exception("BlackmanWindow: endIndex - startIndex does not match inputSignal size");
 	}
@@ -64,11 +66,11 @@ void BlackmanWindow(std::vector<double>& inputSignal, bool inverse, bool reverse
 
 		if(reverse)
 		{
-			inputSignal[signalIndex] = inputSignal[signalIndex] / amp;
+			outputSignal[signalIndex] = inputSignal[signalIndex] / amp;
 		}
 		else
 		{
-			inputSignal[signalIndex] = inputSignal[signalIndex] * amp;
+			outputSignal[signalIndex] = inputSignal[signalIndex] * amp;
 		}
 
 		++signalIndex;
@@ -77,22 +79,53 @@ void BlackmanWindow(std::vector<double>& inputSignal, bool inverse, bool reverse
 }
 }
 
-void Signal::BlackmanWindow(std::vector<double>& inputSignal, double startPercent, double endPercent)
+template<typename T>
+void Signal::BlackmanWindow(std::vector<T>& inputSignal, double startPercent, double endPercent)
 {
-	Signal::BlackmanWindow(inputSignal, false, false, startPercent, endPercent);
+	Signal::BlackmanWindow(BasicAudioDataView<T>{inputSignal}, inputSignal.data(), false, false, startPercent, endPercent);
 }
 
-void Signal::InverseBlackmanWindow(std::vector<double>& inputSignal, double startPercent, double endPercent)
+template<typename T>
+void Signal::InverseBlackmanWindow(std::vector<T>& inputSignal, double startPercent, double endPercent)
 {
-	Signal::BlackmanWindow(inputSignal, true, false, startPercent, endPercent);
+	Signal::BlackmanWindow(BasicAudioDataView<T>{inputSignal}, inputSignal.data(), true, false, startPercent, endPercent);
 }
 
-void Signal::ReverseBlackmanWindow(std::vector<double>& inputSignal, double startPercent, double endPercent)
+template<typename T>
+void Signal::ReverseBlackmanWindow(std::vector<T>& inputSignal, double startPercent, double endPercent)
 {
-	Signal::BlackmanWindow(inputSignal, false, true, startPercent, endPercent);
+	Signal::BlackmanWindow(BasicAudioDataView<T>{inputSignal}, inputSignal.data(), false, true, startPercent, endPercent);
 }
 
-void Signal::LinearFadeInOut(std::vector<double>& inputSignal)
+template<typename T>
+void Signal::BlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent, double endPercent)
+{
+	outputSignal.resize(inputSignal.GetSize());
+	Signal::BlackmanWindow(inputSignal, outputSignal.data(), false, false, startPercent, endPercent);
+}
+
+template<typename T>
+void Signal::BlackmanWindow(const BasicAudioDataView<T>& inputSignal, T* outputSignal, double startPercent, double endPercent)
+{
+	Signal::BlackmanWindow(inputSignal, outputSignal, false, false, startPercent, endPercent);
+}
+
+template<typename T>
+void Signal::InverseBlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent, double endPercent)
+{
+	outputSignal.resize(inputSignal.GetSize());
+	Signal::BlackmanWindow(inputSignal, outputSignal.data(), true, false, startPercent, endPercent);
+}
+
+template<typename T>
+void Signal::ReverseBlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent, double endPercent)
+{
+	outputSignal.resize(inputSignal.GetSize());
+	Signal::BlackmanWindow(inputSignal, outputSignal.data(), false, true, startPercent, endPercent);
+}
+
+template<typename T>
+void Signal::LinearFadeInOut(std::vector<T>& inputSignal)
 {
 	double halfBufferSizeAsDouble{static_cast<double>(inputSignal.size() - 1) / 2.0};
 	std::size_t inputSignalSize{inputSignal.size()};
@@ -104,3 +137,21 @@ void Signal::LinearFadeInOut(std::vector<double>& inputSignal)
 		inputSignal[inputSignalSize - n - 1] *= ampValue;
 	}
 }
+
+template void Signal::BlackmanWindow(std::vector<double>&, double, double);
+template void Signal::InverseBlackmanWindow(std::vector<double>&, double, double);
+template void Signal::ReverseBlackmanWindow(std::vector<double>&, double, double);
+template void Signal::BlackmanWindow(const BasicAudioDataView<double>&, std::vector<double>&, double, double);
+template void Signal::BlackmanWindow(const BasicAudioDataView<double>&, double*, double, double);
+template void Signal::InverseBlackmanWindow(const BasicAudioDataView<double>&, std::vector<double>&, double, double);
+template void Signal::ReverseBlackmanWindow(const BasicAudioDataView<double>&, std::vector<double>&, double, double);
+template void Signal::LinearFadeInOut(std::vector<double>&);
+
+template void Signal::BlackmanWindow(std::vector<float>&, double, double);
+template void Signal::InverseBlackmanWindow(std::vector<float>&, double, double);
+template void Signal::ReverseBlackmanWindow(std::vector<float>&, double, double);
+template void Signal::BlackmanWindow(const BasicAudioDataView<float>&, std::vector<float>&, double, double);
+template void Signal::BlackmanWindow(const BasicAudioDataView<float>&, float*, double, double);
+template void Signal::InverseBlackmanWindow(const BasicAudioDataView<float>&, std::vector<float>&, double, double);
+template void Signal::ReverseBlackmanWindow(const BasicAudioDataView<float>&, std::vector<float>&, double, double);
+template void Signal::LinearFadeInOut(std::vector<float>&);
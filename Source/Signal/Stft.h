@@ -0,0 +1,114 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//! @file Stft.h
+//! @brief Short-time Fourier transforms of whole signals, computed in parallel.
+
+#pragma once
+
+#include <AudioData/AudioData.h>
+#include <Signal/FrequencyDomain.h>
+#include <Utilities/ThreadPool.h>
+#include <cstddef>
+#include <vector>
+
+namespace Signal {
+
+//! The frames of a short-time Fourier transform.
+
+//! All frames are held in one contiguous allocation.  Each frame holds the real values of its 
+//! GetBinCount() bins followed by their imaginary values, the bins being those of the non-negative 
+//! frequencies (GetFftSize()/2+1 of them) as in a FrequencyDomain.
+
+class StftFrames
+{
+	public:
+		//! Instantiate an empty set of frames.
+		StftFrames();
+
+		//! Instantiate zeroed frames for a signal of the given length.
+		StftFrames(std::size_t frameCount, std::size_t fftSize, std::size_t hopSize, std::size_t signalLength);
+
+		//! Returns the number of frames.
+		std::size_t GetFrameCount() const;
+
+		//! Returns the number of frequency bins in each frame.
+		std::size_t GetBinCount() const;
+
+		//! Returns the size of the FFT each frame was transformed with.
+		std::size_t GetFftSize() const;
+
+		//! Returns the number of samples between the starts of consecutive frames.
+		std::size_t GetHopSize() const;
+
+		//! Returns the length of the signal the frames were calculated from.
+		std::size_t GetSignalLength() const;
+
+		//! Returns the real values of the given frame's bins.
+		const double* GetReal(std::size_t frame) const;
+		double* GetReal(std::size_t frame);
+
+		//! Returns the imaginary values of the given frame's bins.
+		const double* GetImaginary(std::size_t frame) const;
+		double* GetImaginary(std::size_t frame);
+
+		//! Returns a copy of the given frame as a FrequencyDomain.
+		Signal::FrequencyDomain GetFrequencyDomain(std::size_t frame) const;
+
+	private:
+		std::size_t frameCount_{0};
+		std::size_t fftSize_{0};
+		std::size_t hopSize_{0};
+		std::size_t signalLength_{0};
+		std::size_t binCount_{0};
+		std::vector<double> data_;
+};
+
+//! Calculates the short-time Fourier transform of the given signal.
+//
+//! Frame f starts at sample f * hopSize.  The frame's samples are multiplied by the window, zero 
+//! padded to fftSize and transformed.  Frames are added until every sample of the signal is in a 
+//! frame, samples past the end of the signal being taken as silence.  The window may not be longer 
+//! than the FFT, and the FFT may be of any size (see FftPlan.h).
+//!
+//! The frames are split across the threads of the given pool.
+template<typename T>
+StftFrames Stft(const BasicAudioDataView<T>& signal, const std::vector<double>& window, std::size_t hopSize, std::size_t fftSize, 
+				Utilities::ThreadPool& threadPool=Utilities::ThreadPool::GetSharedPool());
+
+//! Resynthesizes a signal from short-time Fourier transform frames by weighted overlap-add.
+//
+//! Each frame is inverse transformed, multiplied by the window (which should be the one the frames 
+//! were calculated with) and added into the output at its position.  The sum is then divided by the 
+//! sum of the squared windows overlapping each sample, so unaltered frames give back the original 
+//! signal wherever the window isn't zero.  The output has GetSignalLength() samples.
+//!
+//! The frames are split across the threads of the given pool.
+template<typename T=double>
+BasicAudioData<T> Istft(const StftFrames& frames, const std::vector<double>& window, 
+						Utilities::ThreadPool& threadPool=Utilities::ThreadPool::GetSharedPool());
+
+}
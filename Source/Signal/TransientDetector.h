@@ -144,11 +144,11 @@ class TransientDetector
 
 		std::size_t FindFirstTransient();
 
-		bool GetPeakAndValley(const AudioData& audioData, std::size_t stepSize, TransientPeakAndValley& peakAndValley);
+		bool GetPeakAndValley(const AudioDataView& audioData, std::size_t stepSize, TransientPeakAndValley& peakAndValley);
 
 		std::size_t FindTransientSamplePosition(const TransientPeakAndValley& firstLevelPeakAndValley);
 	
-		double GetMaxSample(const AudioData& audioData, std::size_t sampleCount);
+		double GetMaxSample(const AudioDataView& audioData, std::size_t sampleCount);
 
 		bool SampleIsPeak(double centerSample, double leftSample, double rightSample);
 
@@ -0,0 +1,126 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Signal/FftPlan.h>
+#include <Signal/Fourier.h>
+#include <Signal/Source/FftKernels.h>
+#include <Utilities/Exception.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Signal::FftKernels::InstructionSet;
+
+	// Restores the instruction set that was in use when the test started
+	class FftKernelsTest : public ::testing::Test
+	{
+		protected:
+			void TearDown() override
+			{
+				Signal::FftKernels::SetInstructionSet(originalInstructionSet_);
+			}
+
+			std::vector<InstructionSet> GetSupportedInstructionSets()
+			{
+				std::vector<InstructionSet> instructionSets;
+				for(auto instructionSet : {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2})
+				{
+					if(Signal::FftKernels::IsInstructionSetSupported(instructionSet))
+					{
+						instructionSets.push_back(instructionSet);
+					}
+				}
+
+				return instructionSets;
+			}
+
+			std::vector<double> CreateValues(std::size_t size, unsigned int seed)
+			{
+				std::mt19937 generator{seed};
+				std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+				std::vector<double> values;
+				for(std::size_t i{0}; i < size; ++i)
+				{
+					values.push_back(distribution(generator));
+				}
+
+				return values;
+			}
+
+			InstructionSet originalInstructionSet_{Signal::FftKernels::GetInstructionSet()};
+	};
+}
+
+TEST_F(FftKernelsTest, ScalarIsAlwaysSupported)
+{
+	EXPECT_TRUE(Signal::FftKernels::IsInstructionSetSupported(InstructionSet::SCALAR));
+	EXPECT_TRUE(Signal::FftKernels::IsInstructionSetSupported(Signal::FftKernels::GetBestInstructionSet()));
+}
+
+TEST_F(FftKernelsTest, InstructionSetsMatchScalar)
+{
+	// Even and odd powers of two cover both the all radix-4 and the leading radix-2 stage layouts
+	for(std::size_t size : {2, 4, 8, 32, 64, 512, 2048, 4096})
+	{
+		auto plan{Signal::Fourier::FftPlan::GetPlan(size)};
+		auto inputReal{CreateValues(size, 1)};
+		auto inputImaginary{CreateValues(size, 2)};
+
+		Signal::FftKernels::SetInstructionSet(InstructionSet::SCALAR);
+		auto expectedReal{inputReal};
+		auto expectedImaginary{inputImaginary};
+		plan->Forward(expectedReal.data(), expectedImaginary.data());
+
+		for(auto instructionSet : GetSupportedInstructionSets())
+		{
+			Signal::FftKernels::SetInstructionSet(instructionSet);
+			auto real{inputReal};
+			auto imaginary{inputImaginary};
+			plan->Forward(real.data(), imaginary.data());
+
+			EXPECT_EQ(expectedReal, real);
+			EXPECT_EQ(expectedImaginary, imaginary);
+		}
+	}
+}
+
+TEST_F(FftKernelsTest, RoundTripWithEachInstructionSet)
+{
+	auto input{CreateValues(4096, 3)};
+	for(auto instructionSet : GetSupportedInstructionSets())
+	{
+		Signal::FftKernels::SetInstructionSet(instructionSet);
+		auto output{Signal::Fourier::ApplyInverseFFT(Signal::Fourier::ApplyFFT(AudioData{input}))};
+
+		ASSERT_EQ(input.size(), output.GetSize());
+		for(std::size_t i{0}; i < input.size(); ++i)
+		{
+			EXPECT_NEAR(input[i], output.GetData()[i], 1e-12);
+		}
+	}
+}
@@ -0,0 +1,121 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Signal/Source/FilterKernelCache.h>
+#include <Signal/LowPassFilter.h>
+#include <numeric>
+#include <vector>
+
+TEST(FilterKernelCacheTests, SameParametersShareKernel)
+{
+	auto kernel{Signal::GetLowPassFilterKernel<double>(0.25, 100, Signal::SincWindow::HAMMING)};
+	EXPECT_EQ(kernel, Signal::GetLowPassFilterKernel<double>(0.25, 100, Signal::SincWindow::HAMMING));
+	EXPECT_NE(kernel, Signal::GetLowPassFilterKernel<double>(0.2, 100, Signal::SincWindow::HAMMING));
+	EXPECT_NE(kernel, Signal::GetLowPassFilterKernel<double>(0.25, 101, Signal::SincWindow::HAMMING));
+	EXPECT_NE(kernel, Signal::GetLowPassFilterKernel<double>(0.25, 100, Signal::SincWindow::BLACKMAN));
+}
+
+TEST(FilterKernelCacheTests, LowPassFiltersShareKernel)
+{
+	Signal::LowPassFilter firstFilter{0.3, 300};
+	Signal::LowPassFilter secondFilter{0.3, 300, Utilities::Synchronization::SINGLE_THREADED};
+	EXPECT_EQ(&firstFilter.GetFilterKernel(), &secondFilter.GetFilterKernel());
+	EXPECT_EQ(Signal::GetLowPassFilterKernel<double>(0.3, 300, Signal::SincWindow::HAMMING).get(), &firstFilter.GetFilterKernel());
+}
+
+TEST(FilterKernelCacheTests, FloatKernelIsDoubleKernelRounded)
+{
+	for(auto window : {Signal::SincWindow::HAMMING, Signal::SincWindow::BLACKMAN})
+	{
+		auto kernel{Signal::GetLowPassFilterKernel<double>(0.1, 64, window)};
+		auto floatKernel{Signal::GetLowPassFilterKernel<float>(0.1, 64, window)};
+		EXPECT_EQ(std::vector<float>(kernel->begin(), kernel->end()), *floatKernel);
+
+		// Both kernels have unity gain at DC
+		EXPECT_NEAR(1.0, std::accumulate(kernel->begin(), kernel->end(), 0.0), 1e-12);
+	}
+}
+
+TEST(FilterKernelCacheTests, UnusedValuesAreFreed)
+{
+	std::weak_ptr<const std::vector<double>> kernel{Signal::GetLowPassFilterKernel<double>(0.123, 50, Signal::SincWindow::BLACKMAN)};
+	EXPECT_TRUE(kernel.expired());
+
+	auto sincTable{Signal::WindowedSincTable::GetTable(64, 11)};
+	std::weak_ptr<const std::vector<double>> polyphaseBanks{Signal::GetPolyphaseBanks(*sincTable, 7, false, 8)};
+	EXPECT_TRUE(polyphaseBanks.expired());
+
+	// And calculated the same when needed again
+	auto recalculatedKernel{Signal::GetLowPassFilterKernel<double>(0.123, 50, Signal::SincWindow::BLACKMAN)};
+	EXPECT_EQ(*recalculatedKernel, *Signal::GetLowPassFilterKernel<double>(0.123, 50, Signal::SincWindow::BLACKMAN));
+}
+
+TEST(FilterKernelCacheTests, PolyphaseBanksHoldSincValues)
+{
+	auto sincTable{Signal::WindowedSincTable::GetTable(224, 22)};
+	const std::size_t phases{160};
+	const std::size_t samplesPerSide{19};
+	const std::size_t bankSize{2 * samplesPerSide + 1};
+
+	for(bool downsampling : {false, true})
+	{
+		auto polyphaseBanks{Signal::GetPolyphaseBanks(*sincTable, phases, downsampling, samplesPerSide)};
+		EXPECT_EQ(polyphaseBanks, Signal::GetPolyphaseBanks(*sincTable, phases, downsampling, samplesPerSide));
+		ASSERT_EQ((phases + 2) * bankSize, polyphaseBanks->size());
+
+		// Bank 1 is the first phase past zero when upsampling, and the position of a whole input sample when downsampling
+		double xSincPosition{downsampling ? 224.0 : 224.0 / static_cast<double>(phases)};
+		for(std::size_t i{0}; i < bankSize; ++i)
+		{
+			double offset{static_cast<double>(i) - static_cast<double>(samplesPerSide)};
+			EXPECT_EQ(sincTable->GetValue(xSincPosition + offset * 224.0), (*polyphaseBanks)[bankSize + i]);
+		}
+	}
+
+	EXPECT_NE(Signal::GetPolyphaseBanks(*sincTable, phases, false, samplesPerSide), Signal::GetPolyphaseBanks(*sincTable, phases, true, samplesPerSide));
+}
+
+TEST(FilterKernelCacheTests, PolyphaseBanksMovedByPhaseOffset)
+{
+	auto sincTable{Signal::WindowedSincTable::GetTable(224, 22)};
+	const std::size_t phases{4};
+	const std::size_t samplesPerSide{19};
+	const std::size_t bankSize{2 * samplesPerSide + 1};
+	const double phaseOffset{13.5};
+
+	auto polyphaseBanks{Signal::GetPolyphaseBanks(*sincTable, phases, true, samplesPerSide, phaseOffset)};
+	EXPECT_NE(polyphaseBanks, Signal::GetPolyphaseBanks(*sincTable, phases, true, samplesPerSide));
+	ASSERT_EQ((phases + 2) * bankSize, polyphaseBanks->size());
+
+	// Bank 2 is the phase after a whole input sample when downsampling
+	double xSincPosition{224.0 + 224.0 / static_cast<double>(phases) + phaseOffset};
+	for(std::size_t i{0}; i < bankSize; ++i)
+	{
+		double offset{static_cast<double>(i) - static_cast<double>(samplesPerSide)};
+		EXPECT_EQ(sincTable->GetValue(xSincPosition + offset * 224.0), (*polyphaseBanks)[2 * bankSize + i]);
+	}
+}
@@ -0,0 +1,158 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Signal/Source/FirKernels.h>
+#include <Utilities/Exception.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using Signal::FirKernels::InstructionSet;
+
+	// Restores the instruction set that was in use when the test started
+	class FirKernelsTest : public ::testing::Test
+	{
+		protected:
+			void TearDown() override
+			{
+				Signal::FirKernels::SetInstructionSet(originalInstructionSet_);
+			}
+
+			std::vector<InstructionSet> GetSupportedInstructionSets()
+			{
+				std::vector<InstructionSet> instructionSets;
+				for(auto instructionSet : {InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2})
+				{
+					if(Signal::FirKernels::IsInstructionSetSupported(instructionSet))
+					{
+						instructionSets.push_back(instructionSet);
+					}
+				}
+
+				return instructionSets;
+			}
+
+			template<typename T>
+			std::vector<T> CreateValues(std::size_t size, unsigned int seed, double range)
+			{
+				std::mt19937 generator{seed};
+				std::uniform_real_distribution<double> distribution{-range, range};
+				std::vector<T> values;
+				for(std::size_t i{0}; i < size; ++i)
+				{
+					values.push_back(static_cast<T>(distribution(generator)));
+				}
+
+				return values;
+			}
+
+			template<typename T>
+			void CheckInstructionSetsMatchScalar()
+			{
+				// Sample counts around the vector and block widths exercise every tail loop
+				for(std::size_t kernelLength : {1, 7, 100})
+				{
+					for(std::size_t samples : {1, 3, 4, 15, 16, 33, 1000})
+					{
+						// Kernels large enough to need clamping some of the time
+						auto kernel{CreateValues<T>(kernelLength, 1, 0.2)};
+						auto input{CreateValues<T>(samples + kernelLength - 1, 2, 1.0)};
+
+						Signal::FirKernels::SetInstructionSet(InstructionSet::SCALAR);
+						std::vector<T> expected(samples);
+						Signal::FirKernels::Filter(input.data(), kernel.data(), kernelLength, expected.data(), samples);
+
+						for(auto instructionSet : GetSupportedInstructionSets())
+						{
+							Signal::FirKernels::SetInstructionSet(instructionSet);
+							std::vector<T> output(samples);
+							Signal::FirKernels::Filter(input.data(), kernel.data(), kernelLength, output.data(), samples);
+							EXPECT_EQ(expected, output);
+						}
+					}
+				}
+			}
+
+			InstructionSet originalInstructionSet_{Signal::FirKernels::GetInstructionSet()};
+	};
+}
+
+TEST_F(FirKernelsTest, ScalarIsAlwaysSupported)
+{
+	EXPECT_TRUE(Signal::FirKernels::IsInstructionSetSupported(InstructionSet::SCALAR));
+	EXPECT_TRUE(Signal::FirKernels::IsInstructionSetSupported(Signal::FirKernels::GetBestInstructionSet()));
+}
+
+TEST_F(FirKernelsTest, InstructionSetsMatchScalar)
+{
+	CheckInstructionSetsMatchScalar<double>();
+	CheckInstructionSetsMatchScalar<float>();
+}
+
+TEST_F(FirKernelsTest, ScalarMatchesDirectConvolution)
+{
+	auto kernel{CreateValues<double>(5, 3, 0.2)};
+	auto input{CreateValues<double>(24, 4, 1.0)};
+	Signal::FirKernels::SetInstructionSet(InstructionSet::SCALAR);
+	std::vector<double> output(20);
+	Signal::FirKernels::Filter(input.data(), kernel.data(), kernel.size(), output.data(), output.size());
+
+	for(std::size_t i{0}; i < output.size(); ++i)
+	{
+		double accumulator{0.0};
+		for(std::size_t j{0}; j < kernel.size(); ++j)
+		{
+			accumulator = accumulator + (input[i + j] * kernel[j]);
+		}
+
+		EXPECT_EQ(accumulator, output[i]);
+	}
+}
+
+TEST_F(FirKernelsTest, OutputIsClampedAndNaNPassesThrough)
+{
+	std::vector<double> kernel{2.0};
+	std::vector<double> input{0.75, -0.75, 0.25, std::numeric_limits<double>::quiet_NaN(), 1.0, -1.0, 0.0, -0.25};
+	for(auto instructionSet : GetSupportedInstructionSets())
+	{
+		Signal::FirKernels::SetInstructionSet(instructionSet);
+		std::vector<double> output(input.size());
+		Signal::FirKernels::Filter(input.data(), kernel.data(), kernel.size(), output.data(), output.size());
+
+		EXPECT_EQ(1.0, output[0]);
+		EXPECT_EQ(-1.0, output[1]);
+		EXPECT_EQ(0.5, output[2]);
+		EXPECT_TRUE(std::isnan(output[3]));
+		EXPECT_EQ(1.0, output[4]);
+		EXPECT_EQ(-1.0, output[5]);
+		EXPECT_EQ(0.0, output[6]);
+		EXPECT_EQ(-0.5, output[7]);
+	}
+}
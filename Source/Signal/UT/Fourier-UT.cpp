@@ -26,8 +26,12 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
+#include <math.h>
 #include <Signal/Fourier.h>
+#include <Signal/FftPlan.h>
 #include <Signal/SignalConversion.h>
+#include <Utilities/MemoryPool.h>
 
 // This is one second of a 100 Hz signal at 1024 Hz sampling frequency
 std::vector<double> testTimeDomain = {
@@ -387,3 +391,252 @@ TEST(FourierTransformTests, TestFFTRoundTrip)
 		EXPECT_NEAR(testTimeDomain[i], outputTimeDomain.GetData()[i], 0.0001);
 	}
 }
+
+TEST(FourierTransformTests, TestFftPlanIsShared)
+{
+	auto plan{Signal::Fourier::FftPlan::GetPlan(1024)};
+	EXPECT_EQ(1024, plan->GetSize());
+	EXPECT_EQ(plan, Signal::Fourier::FftPlan::GetPlan(1024));
+	EXPECT_NE(plan, Signal::Fourier::FftPlan::GetPlan(512));
+	EXPECT_ANY_THROW(Signal::Fourier::FftPlan::GetPlan(0));
+}
+
+TEST(FourierTransformTests, TestFftPlanIsFreedWhenUnused)
+{
+	const std::size_t size{131072};
+	std::weak_ptr<const Signal::Fourier::FftPlan> plan{Signal::Fourier::FftPlan::GetPlan(size)};
+	EXPECT_TRUE(plan.expired());
+
+	// The thread keeps the plans of its last few transforms, so alternating sizes keep both
+	AudioData timeDomain;
+	timeDomain.AddSilence(size);
+	Signal::Fourier::ApplyFFT(timeDomain);
+	AudioData otherTimeDomain;
+	otherTimeDomain.AddSilence(2 * size);
+	Signal::Fourier::ApplyFFT(otherTimeDomain);
+	plan = Signal::Fourier::FftPlan::GetPlan(size);
+	EXPECT_FALSE(plan.expired());
+}
+
+TEST(FourierTransformTests, TestFftPlanComplexRoundTrip)
+{
+	const std::size_t size{64};
+	std::vector<double> real(size);
+	std::vector<double> imaginary(size);
+	for(std::size_t i{0}; i < size; ++i)
+	{
+		real[i] = sin(0.3 * static_cast<double>(i));
+		imaginary[i] = cos(0.7 * static_cast<double>(i));
+	}
+
+	auto originalReal{real};
+	auto originalImaginary{imaginary};
+
+	auto plan{Signal::Fourier::FftPlan::GetPlan(size)};
+	plan->Forward(real.data(), imaginary.data());
+
+	// Bin 1 checked against the DFT sum directly
+	double expectedReal{0.0};
+	double expectedImaginary{0.0};
+	for(std::size_t i{0}; i < size; ++i)
+	{
+		double angle{2.0 * M_PI * static_cast<double>(i) / static_cast<double>(size)};
+		expectedReal += originalReal[i] * cos(angle) + originalImaginary[i] * sin(angle);
+		expectedImaginary += originalImaginary[i] * cos(angle) - originalReal[i] * sin(angle);
+	}
+	EXPECT_NEAR(expectedReal, real[1], 1e-12);
+	EXPECT_NEAR(expectedImaginary, imaginary[1], 1e-12);
+
+	plan->Inverse(real.data(), imaginary.data());
+	for(std::size_t i{0}; i < size; ++i)
+	{
+		EXPECT_NEAR(originalReal[i], real[i], 1e-12);
+		EXPECT_NEAR(originalImaginary[i], imaginary[i], 1e-12);
+	}
+}
+
+TEST(FourierTransformTests, TestFftPlanRealMatchesComplex)
+{
+	for(std::size_t size : {1, 2, 4, 8, 16, 1024})
+	{
+		std::vector<double> input(size);
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			input[i] = sin(0.37 * static_cast<double>(i)) + 0.25 * cos(1.9 * static_cast<double>(i));
+		}
+
+		auto plan{Signal::Fourier::FftPlan::GetPlan(size)};
+
+		std::vector<double> complexReal{input};
+		std::vector<double> complexImaginary(size, 0.0);
+		plan->Forward(complexReal.data(), complexImaginary.data());
+
+		std::vector<double> real(size / 2 + 1);
+		std::vector<double> imaginary(size / 2 + 1);
+		plan->ForwardReal(input.data(), real.data(), imaginary.data());
+
+		for(std::size_t k{0}; k < real.size(); ++k)
+		{
+			EXPECT_NEAR(complexReal[k], real[k], 1e-9);
+			EXPECT_NEAR(complexImaginary[k], imaginary[k], 1e-9);
+		}
+
+		std::vector<double> output(size);
+		plan->InverseReal(real.data(), imaginary.data(), output.data());
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			EXPECT_NEAR(input[i], output[i], 1e-12);
+		}
+	}
+}
+
+TEST(FourierTransformTests, TestFFTOfAnyLengthMatchesDFT)
+{
+	// Mixed radix lengths (including an odd one) and lengths needing Bluestein's algorithm
+	for(std::size_t size : {3, 6, 12, 45, 100, 210, 343, 1000, 7, 11, 97, 202, 1009})
+	{
+		std::vector<double> samples(size);
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			samples[i] = sin(0.37 * static_cast<double>(i)) + 0.25 * cos(1.9 * static_cast<double>(i));
+		}
+
+		auto expected{Signal::Fourier::ApplyDFT(AudioData{samples})};
+		auto frequencyDomain{Signal::Fourier::ApplyFFT(AudioData{samples})};
+
+		ASSERT_EQ(expected.GetSize(), frequencyDomain.GetSize());
+		for(std::size_t k{0}; k < expected.GetSize(); ++k)
+		{
+			EXPECT_NEAR(expected.GetBin(k).reX_, frequencyDomain.GetBin(k).reX_, 1e-9);
+			EXPECT_NEAR(expected.GetBin(k).imX_, frequencyDomain.GetBin(k).imX_, 1e-9);
+		}
+
+		if(size % 2 == 0)
+		{
+			auto timeDomain{Signal::Fourier::ApplyInverseFFT(frequencyDomain)};
+			ASSERT_EQ(size, timeDomain.GetSize());
+			for(std::size_t i{0}; i < size; ++i)
+			{
+				EXPECT_NEAR(samples[i], timeDomain.GetData()[i], 1e-12);
+			}
+		}
+	}
+}
+
+TEST(FourierTransformTests, TestFftPlanComplexOfAnyLength)
+{
+	for(std::size_t size : {15, 49, 13, 1021})
+	{
+		std::vector<double> real(size);
+		std::vector<double> imaginary(size);
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			real[i] = sin(0.3 * static_cast<double>(i));
+			imaginary[i] = cos(0.7 * static_cast<double>(i));
+		}
+
+		auto originalReal{real};
+		auto originalImaginary{imaginary};
+
+		auto plan{Signal::Fourier::FftPlan::GetPlan(size)};
+		plan->Forward(real.data(), imaginary.data());
+
+		// A few bins checked against the DFT sum directly
+		for(std::size_t k : {std::size_t{0}, std::size_t{1}, size / 2, size - 1})
+		{
+			double expectedReal{0.0};
+			double expectedImaginary{0.0};
+			for(std::size_t i{0}; i < size; ++i)
+			{
+				double angle{2.0 * M_PI * static_cast<double>((i * k) % size) / static_cast<double>(size)};
+				expectedReal += originalReal[i] * cos(angle) + originalImaginary[i] * sin(angle);
+				expectedImaginary += originalImaginary[i] * cos(angle) - originalReal[i] * sin(angle);
+			}
+			EXPECT_NEAR(expectedReal, real[k], 1e-9);
+			EXPECT_NEAR(expectedImaginary, imaginary[k], 1e-9);
+		}
+
+		plan->Inverse(real.data(), imaginary.data());
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			EXPECT_NEAR(originalReal[i], real[i], 1e-12);
+			EXPECT_NEAR(originalImaginary[i], imaginary[i], 1e-12);
+		}
+	}
+}
+
+TEST(FourierTransformTests, TestFftPlanRealOfOddLength)
+{
+	const std::size_t size{45};
+	std::vector<double> input(size);
+	for(std::size_t i{0}; i < size; ++i)
+	{
+		input[i] = sin(0.37 * static_cast<double>(i));
+	}
+
+	auto plan{Signal::Fourier::FftPlan::GetPlan(size)};
+	std::vector<double> real(size / 2 + 1);
+	std::vector<double> imaginary(size / 2 + 1);
+	plan->ForwardReal(input.data(), real.data(), imaginary.data());
+
+	std::vector<double> output(size);
+	plan->InverseReal(real.data(), imaginary.data(), output.data());
+	for(std::size_t i{0}; i < size; ++i)
+	{
+		EXPECT_NEAR(input[i], output[i], 1e-12);
+	}
+}
+
+TEST(FourierTransformTests, TestFFTIntoCallerBuffers)
+{
+	std::vector<double> real(testTimeDomain.size() / 2 + 1);
+	std::vector<double> imaginary(testTimeDomain.size() / 2 + 1);
+	Signal::Fourier::ApplyFFT(AudioDataView{testTimeDomain}, real.data(), imaginary.data());
+
+	auto expected{Signal::Fourier::ApplyFFT(AudioData{testTimeDomain})};
+	for(std::size_t k{0}; k < real.size(); ++k)
+	{
+		EXPECT_EQ(expected.GetBin(k).reX_, real[k]);
+		EXPECT_EQ(expected.GetBin(k).imX_, imaginary[k]);
+	}
+
+	std::vector<float> samples(testTimeDomain.size());
+	Signal::Fourier::ApplyInverseFFT(real.data(), imaginary.data(), real.size(), samples.data());
+	for(std::size_t i{0}; i < samples.size(); ++i)
+	{
+		EXPECT_NEAR(testTimeDomain[i], samples[i], 1e-6);
+	}
+}
+
+TEST(FourierTransformTests, TestFFTReusesStorage)
+{
+	// Both a power of two and a mixed radix size, for each the first frame warms up the scratch space
+	for(std::size_t size : {1024, 960})
+	{
+		std::vector<double> samples(testTimeDomain.begin(), testTimeDomain.begin() + size);
+		std::vector<double> output(size);
+		Signal::FrequencyDomain frequencyDomain;
+
+		Signal::Fourier::ApplyFFT(AudioDataView{samples}, frequencyDomain);
+		Signal::Fourier::ApplyInverseFFT(frequencyDomain, output.data());
+		frequencyDomain.GetMagnitudes();
+		const Signal::FrequencyBin* bins{&frequencyDomain.GetBin(0)};
+		const double* magnitudes{frequencyDomain.GetMagnitudes().data()};
+
+		auto countersBefore{Utilities::GetAllocationCounters()};
+		for(int frame{0}; frame < 10; ++frame)
+		{
+			Signal::Fourier::ApplyFFT(AudioDataView{samples}, frequencyDomain);
+			Signal::Fourier::ApplyInverseFFT(frequencyDomain, output.data());
+			EXPECT_EQ(bins, &frequencyDomain.GetBin(0));
+			EXPECT_EQ(magnitudes, frequencyDomain.GetMagnitudes().data());
+		}
+		auto countersAfter{Utilities::GetAllocationCounters()};
+
+		EXPECT_EQ(countersBefore.heapAllocations_, countersAfter.heapAllocations_);
+		for(std::size_t i{0}; i < size; ++i)
+		{
+			EXPECT_NEAR(samples[i], output[i], 1e-12);
+		}
+	}
+}
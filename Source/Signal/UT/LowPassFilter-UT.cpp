@@ -88,4 +88,74 @@ TEST(LowPassFilterTests, LowPassAt8000Hz)
 	DoLowPassFiltering("222HzSineAnd19000HzSine.wav", "222HzSineAnd19000HzSineLowPassFilteredAt8000HzCurrentResults.wav", 8000);
  	EXPECT_TRUE(Utilities::File::CheckIfFilesMatch("222HzSineAnd19000HzSineLowPassFilteredAt8000Hz.wav", 
 															"222HzSineAnd19000HzSineLowPassFilteredAt8000HzCurrentResults.wav"));
-}
\ No newline at end of file
+}
+
+TEST(LowPassFilterTests, FloatMatchesDouble)
+{
+	WaveFile::WaveFileReader inputWaveFile{"400HzSineAnd2121HzSine.wav"};
+	auto input{inputWaveFile.GetAudioData()[WaveFile::MONO_CHANNEL]};
+	double cutoffRatio{1000.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	std::vector<float> inputFloat(input.GetData().begin(), input.GetData().end());
+
+	Signal::LowPassFilter lowPassFilter{cutoffRatio};
+	Signal::LowPassFilterFloat lowPassFilterFloat{cutoffRatio};
+	lowPassFilter.SubmitAudioData(input);
+	lowPassFilterFloat.SubmitAudioData(AudioDataFloat{inputFloat});
+
+	auto output{lowPassFilter.FlushAudioData()};
+	auto outputFloat{lowPassFilterFloat.FlushAudioData()};
+
+	ASSERT_EQ(output.GetSize(), outputFloat.GetSize());
+	for(std::size_t i{0}; i < output.GetSize(); ++i)
+	{
+		EXPECT_NEAR(output.GetData()[i], outputFloat.GetData()[i], 1e-5);
+	}
+}
+
+TEST(LowPassFilterTests, TestConvolutionMethodSelection)
+{
+	EXPECT_EQ(Signal::LowPassFilter::ConvolutionMethod::DIRECT, Signal::LowPassFilter(0.25).GetConvolutionMethod());
+	EXPECT_EQ(Signal::LowPassFilter::ConvolutionMethod::FFT, Signal::LowPassFilter(0.25, 512).GetConvolutionMethod());
+	EXPECT_EQ(Signal::LowPassFilter::ConvolutionMethod::FFT, 
+			  Signal::LowPassFilter(0.25, 100, Utilities::Synchronization::THREAD_SAFE, Signal::LowPassFilter::ConvolutionMethod::FFT).GetConvolutionMethod());
+}
+
+TEST(LowPassFilterTests, FftConvolutionMatchesDirect)
+{
+	WaveFile::WaveFileReader inputWaveFile{"5000HzSineAnd9797HzSine.wav"};
+	auto input{inputWaveFile.GetAudioData()[WaveFile::MONO_CHANNEL]};
+	double cutoffRatio{6000.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	for(std::size_t filterLength : {std::size_t{100}, std::size_t{301}, std::size_t{1024}})
+	{
+		Signal::LowPassFilter directFilter{cutoffRatio, filterLength, Utilities::Synchronization::SINGLE_THREADED, Signal::LowPassFilter::ConvolutionMethod::DIRECT};
+		Signal::LowPassFilter fftFilter{cutoffRatio, filterLength, Utilities::Synchronization::SINGLE_THREADED, Signal::LowPassFilter::ConvolutionMethod::FFT};
+
+		// Submit in uneven pieces so blocks are cut short, and check the same output is available each time
+		std::size_t position{0};
+		std::size_t pieceSize{37};
+		while(position < input.GetSize())
+		{
+			std::size_t samples{std::min(pieceSize, input.GetSize() - position)};
+			AudioData piece{input.GetDataPointer() + position, samples};
+			directFilter.SubmitAudioData(piece);
+			fftFilter.SubmitAudioData(piece);
+			ASSERT_EQ(directFilter.OutputSamplesAvailable(), fftFilter.OutputSamplesAvailable());
+
+			position += samples;
+			pieceSize = pieceSize * 3 % 5000 + 1;
+		}
+
+		auto directOutput{directFilter.GetAudioData(directFilter.OutputSamplesAvailable())};
+		directOutput.Append(directFilter.FlushAudioData());
+		auto fftOutput{fftFilter.GetAudioData(fftFilter.OutputSamplesAvailable())};
+		fftOutput.Append(fftFilter.FlushAudioData());
+
+		ASSERT_EQ(directOutput.GetSize(), fftOutput.GetSize());
+		for(std::size_t i{0}; i < directOutput.GetSize(); ++i)
+		{
+			ASSERT_NEAR(directOutput.GetData()[i], fftOutput.GetData()[i], 1e-12) << "filterLength " << filterLength << " sample " << i;
+		}
+	}
+}
@@ -0,0 +1,146 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Signal/MultichannelResampler.h>
+#include <Signal/Resampler.h>
+#include <AudioData/AudioBuffer.h>
+#include <WaveFile/WaveFileReader.h>
+#include <Utilities/Exception.h>
+#include <algorithm>
+
+namespace
+{
+	// Two different channels of the same length: the piano key and the piano key backwards
+	std::vector<AudioData> GetStereoInput()
+	{
+		WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+		auto left{inputWaveFile.GetAudioData()[0]};
+		std::vector<double> reversed{left.GetData().rbegin(), left.GetData().rend()};
+		AudioData right;
+		right.PushBuffer(reversed);
+
+		return std::vector<AudioData>{left, right};
+	}
+
+	AudioDataFloat ConvertToFloat(const AudioData& audioData)
+	{
+		AudioDataFloat audioDataFloat;
+		audioDataFloat.PushBuffer(std::vector<float>(audioData.GetData().begin(), audioData.GetData().end()));
+		return audioDataFloat;
+	}
+}
+
+TEST(MultichannelResamplerTests, ChannelsMatchResampler)
+{
+	auto input{GetStereoInput()};
+	const std::size_t inputSampleRate{44100};
+	const std::size_t blockSize{1000};
+
+	// Interpolated and polyphase ratios, upsampling, downsampling and downsampling far enough that only the samples 
+	// the sinc filter reads are low pass filtered
+	for(double outputSampleRate : {24123.0, 48000.0, 11025.0, 1000.0, 96017.0})
+	{
+		double resampleRatio{outputSampleRate / static_cast<double>(inputSampleRate)};
+
+		Signal::MultichannelResampler multichannelResampler{inputSampleRate, resampleRatio, 2};
+		std::vector<AudioData> output(2);
+		for(std::size_t i{0}; i < input[0].GetSize(); i += blockSize)
+		{
+			std::size_t samples{std::min(blockSize, input[0].GetSize() - i)};
+			multichannelResampler.SubmitAudioData(std::vector<AudioData>{input[0].Retrieve(i, samples), input[1].Retrieve(i, samples)});
+			auto outputBlock{multichannelResampler.GetAudioData(multichannelResampler.OutputSamplesAvailable())};
+			output[0].Append(outputBlock[0]);
+			output[1].Append(outputBlock[1]);
+		}
+
+		auto remainingOutput{multichannelResampler.FlushAudioData()};
+		ASSERT_EQ(2, remainingOutput.size());
+
+		for(std::size_t channel{0}; channel < 2; ++channel)
+		{
+			output[channel].Append(remainingOutput[channel]);
+
+			// The same blocks of the channel through a Resampler of its own
+			Signal::Resampler resampler{inputSampleRate, resampleRatio};
+			AudioData expected;
+			for(std::size_t i{0}; i < input[channel].GetSize(); i += blockSize)
+			{
+				resampler.SubmitAudioData(input[channel].Retrieve(i, std::min(blockSize, input[channel].GetSize() - i)));
+				expected.Append(resampler.GetAudioData(resampler.OutputSamplesAvailable()));
+			}
+			expected.Append(resampler.FlushAudioData());
+
+			EXPECT_EQ(expected.GetData(), output[channel].GetData()) << outputSampleRate << " channel " << channel;
+		}
+	}
+}
+
+TEST(MultichannelResamplerTests, InterleavedChannelViews)
+{
+	auto input{GetStereoInput()};
+	AudioBuffer interleaved{input, AudioBuffer::Layout::INTERLEAVED};
+
+	Signal::MultichannelResampler planarResampler{44100, 0.5, 2};
+	planarResampler.SubmitAudioData(input);
+	auto expected{planarResampler.FlushAudioData()};
+
+	Signal::MultichannelResampler resampler{44100, 0.5, 2};
+	resampler.SubmitAudioData(std::vector<AudioDataView>{interleaved.GetChannelView(0), interleaved.GetChannelView(1)});
+	auto output{resampler.FlushAudioData()};
+
+	EXPECT_EQ(expected[0].GetData(), output[0].GetData());
+	EXPECT_EQ(expected[1].GetData(), output[1].GetData());
+}
+
+TEST(MultichannelResamplerTests, NoSampleRateChange)
+{
+	auto input{GetStereoInput()};
+
+	Signal::MultichannelResamplerFloat resampler{44100, 1.0, 2, Utilities::Synchronization::SINGLE_THREADED};
+	resampler.SubmitAudioData(std::vector<AudioDataFloat>{ConvertToFloat(input[0]), ConvertToFloat(input[1])});
+	EXPECT_EQ(input[0].GetSize(), resampler.OutputSamplesAvailable());
+
+	auto output{resampler.GetAudioData(input[0].GetSize())};
+	EXPECT_EQ(ConvertToFloat(input[0]).GetData(), output[0].GetData());
+	EXPECT_EQ(ConvertToFloat(input[1]).GetData(), output[1].GetData());
+}
+
+TEST(MultichannelResamplerTests, InvalidChannels)
+{
+	EXPECT_THROW(Signal::MultichannelResampler(44100, 0.5, 0), Utilities::Exception);
+
+	Signal::MultichannelResampler resampler{44100, 0.5, 2};
+	AudioData audioData;
+	audioData.AddSilence(100);
+	AudioData shorterAudioData;
+	shorterAudioData.AddSilence(99);
+
+	EXPECT_THROW(resampler.SubmitAudioData(std::vector<AudioData>{audioData}), Utilities::Exception);
+	EXPECT_THROW(resampler.SubmitAudioData(std::vector<AudioData>{audioData, audioData, audioData}), Utilities::Exception);
+	EXPECT_THROW(resampler.SubmitAudioData(std::vector<AudioData>{audioData, shorterAudioData}), Utilities::Exception);
+	EXPECT_EQ(2, resampler.GetChannels());
+}
@@ -29,7 +29,14 @@
 #include <Signal/SignalConversion.h>
 #include <WaveFile/WaveFileReader.h>
 #include <WaveFile/WaveFileWriter.h>
+#include <Utilities/Exception.h>
 #include <Utilities/File.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
 
 void DoResampling(const std::string& inputFilename, const std::string& outputFilename, std::size_t newSampleRate)
 {
@@ -74,3 +81,450 @@ TEST(ResamplerTests, TestLowPassFilterAt15000Hz)
 	DoResampling("5000HzSineAnd9797HzSine.wav", "5000HzSineAnd9797HzSineResampledCurrentResult.wav", 15000);
  	EXPECT_TRUE(Utilities::File::CheckIfFilesMatch("5000HzSineAnd9797HzSineResampled.wav", "5000HzSineAnd9797HzSineResampledCurrentResult.wav"));
 }
+
+TEST(ResamplerTests, FloatMatchesDouble)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+	double resampleRatio{24123.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	std::vector<float> inputFloat(input.GetData().begin(), input.GetData().end());
+
+	Signal::Resampler resampler{inputWaveFile.GetSampleRate(), resampleRatio};
+	Signal::ResamplerFloat resamplerFloat{inputWaveFile.GetSampleRate(), resampleRatio};
+	resampler.SubmitAudioData(input);
+	resamplerFloat.SubmitAudioData(AudioDataFloat{inputFloat});
+
+	auto output{resampler.FlushAudioData()};
+	auto outputFloat{resamplerFloat.FlushAudioData()};
+
+	ASSERT_EQ(output.GetSize(), outputFloat.GetSize());
+	for(std::size_t i{0}; i < output.GetSize(); ++i)
+	{
+		EXPECT_NEAR(output.GetData()[i], outputFloat.GetData()[i], 1e-5);
+	}
+}
+
+TEST(ResamplerTests, OutputRetrievedOnAnotherThread)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+	double resampleRatio{24123.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	Signal::Resampler expectedResampler{inputWaveFile.GetSampleRate(), resampleRatio, Utilities::Synchronization::SINGLE_THREADED};
+	expectedResampler.SubmitAudioData(input);
+	auto expected{expectedResampler.FlushAudioData()};
+
+	// Submit in small pieces on one thread while another thread collects whatever output is ready
+	Signal::Resampler resampler{inputWaveFile.GetSampleRate(), resampleRatio};
+	AudioData output;
+	std::atomic<bool> submitting{true};
+	std::thread consumer([&]()
+	{
+		while(true)
+		{
+			bool finished{!submitting};
+			output.Append(resampler.GetAudioData(resampler.OutputSamplesAvailable()));
+			if(finished)
+			{
+				break;
+			}
+		}
+	});
+
+	const std::size_t blockSize{1000};
+	for(std::size_t position{0}; position < input.GetSize(); position += blockSize)
+	{
+		resampler.SubmitAudioData(input.Retrieve(position, std::min(blockSize, input.GetSize() - position)));
+	}
+	submitting = false;
+	consumer.join();
+
+	output.Append(resampler.FlushAudioData());
+	EXPECT_EQ(expected.GetData(), output.GetData());
+}
+
+TEST(ResamplerTests, ResetRestartsDownsampling)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+
+	// At the lowest ratio the sinc filter steps over many input samples for each output sample
+	for(std::size_t outputSampleRate : {24123, 1000})
+	{
+		double resampleRatio{static_cast<double>(outputSampleRate) / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+		Signal::Resampler expectedResampler{inputWaveFile.GetSampleRate(), resampleRatio};
+		expectedResampler.SubmitAudioData(input);
+		auto expected{expectedResampler.FlushAudioData()};
+
+		Signal::Resampler resampler{inputWaveFile.GetSampleRate(), resampleRatio};
+		resampler.SubmitAudioData(input.Retrieve(0, input.GetSize() / 3));
+		resampler.Reset();
+		resampler.SubmitAudioData(input);
+		auto output{resampler.FlushAudioData()};
+
+		EXPECT_EQ(expected.GetData(), output.GetData());
+	}
+}
+
+TEST(ResamplerTests, CoefficientBanksMatchInterpolatedSincValues)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+	double inputSampleRate{static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	// These ratios use coefficient banks.  Adding a hundred thousandth of a Hz gives a ratio that doesn't, yet stays 
+	// within a small fraction of a sample of the same positions over the whole input.
+	for(double outputSampleRate : {48000.0, 22050.0, 88200.0, 11025.0})
+	{
+		Signal::Resampler resampler{inputWaveFile.GetSampleRate(), outputSampleRate / inputSampleRate};
+		resampler.SubmitAudioData(input);
+		auto output{resampler.FlushAudioData()};
+
+		Signal::Resampler interpolatingResampler{inputWaveFile.GetSampleRate(), (outputSampleRate + 0.00001) / inputSampleRate};
+		interpolatingResampler.SubmitAudioData(input);
+		auto expected{interpolatingResampler.FlushAudioData()};
+
+		ASSERT_EQ(expected.GetSize(), output.GetSize());
+		for(std::size_t i{0}; i < output.GetSize(); ++i)
+		{
+			ASSERT_NEAR(expected.GetData()[i], output.GetData()[i], 1e-5) << outputSampleRate << " sample " << i;
+		}
+	}
+}
+
+TEST(ResamplerTests, SmallBlocksMatchOneSubmission)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+
+	for(std::size_t outputSampleRate : {24123, 48000, 88200})
+	{
+		double resampleRatio{static_cast<double>(outputSampleRate) / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+		Signal::Resampler expectedResampler{inputWaveFile.GetSampleRate(), resampleRatio};
+		expectedResampler.SubmitAudioData(input);
+		auto expected{expectedResampler.FlushAudioData()};
+
+		for(std::size_t blockSize : {1, 256})
+		{
+			Signal::Resampler resampler{inputWaveFile.GetSampleRate(), resampleRatio};
+			AudioData output;
+			for(std::size_t i{0}; i < input.GetSize(); i += blockSize)
+			{
+				resampler.SubmitAudioData(input.Retrieve(i, std::min(blockSize, input.GetSize() - i)));
+				output.Append(resampler.GetAudioData(resampler.OutputSamplesAvailable()));
+			}
+			output.Append(resampler.FlushAudioData());
+
+			EXPECT_EQ(expected.GetData(), output.GetData()) << outputSampleRate << " in blocks of " << blockSize;
+		}
+	}
+}
+
+namespace
+{
+	AudioData GenerateSineWave(double frequency, std::size_t sampleRate, std::size_t samples)
+	{
+		const double pi{3.14159265358979323846};
+		AudioData sineWave;
+		for(std::size_t i{0}; i < samples; ++i)
+		{
+			sineWave.PushSample(0.5 * std::sin(2.0 * pi * frequency * static_cast<double>(i) / static_cast<double>(sampleRate)));
+		}
+
+		return sineWave;
+	}
+
+	// The level of the output relative to a full scale sine wave of the input's amplitude, in dB, leaving out the 
+	// start and end where the filters run into silence
+	double OutputLevelInDecibels(const AudioData& output)
+	{
+		std::size_t skip{output.GetSize() / 10};
+		double sumOfSquares{0.0};
+		for(std::size_t i{skip}; i < output.GetSize() - skip; ++i)
+		{
+			sumOfSquares += output.GetData()[i] * output.GetData()[i];
+		}
+
+		double rms{std::sqrt(sumOfSquares / static_cast<double>(output.GetSize() - 2 * skip))};
+		return 20.0 * std::log10(rms / (0.5 / std::sqrt(2.0)));
+	}
+}
+
+TEST(ResamplerTests, DefaultQualityIsLegacy)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+	double resampleRatio{24123.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	Signal::Resampler defaultResampler{inputWaveFile.GetSampleRate(), resampleRatio};
+	defaultResampler.SubmitAudioData(input);
+
+	Signal::Resampler legacyResampler{inputWaveFile.GetSampleRate(), resampleRatio, Utilities::Synchronization::THREAD_SAFE, Signal::ResamplerQuality::LEGACY};
+	legacyResampler.SubmitAudioData(input);
+
+	EXPECT_EQ(Signal::ResamplerQuality::LEGACY, defaultResampler.GetQuality());
+	EXPECT_EQ(defaultResampler.FlushAudioData().GetData(), legacyResampler.FlushAudioData().GetData());
+}
+
+namespace
+{
+	const Signal::ResamplerQuality QUALITIES[]{Signal::ResamplerQuality::LEGACY, Signal::ResamplerQuality::DRAFT, Signal::ResamplerQuality::NORMAL, 
+											   Signal::ResamplerQuality::HIGH, Signal::ResamplerQuality::MASTERING};
+	const char* QUALITY_NAMES[]{"Legacy", "Draft", "Normal", "High", "Mastering"};
+	const std::size_t QUALITY_COUNT{5};
+}
+
+// Downsampling 2:1, a tone well above the Nyquist frequency of the output should be filtered out and one well below it 
+// should pass unchanged
+TEST(ResamplerTests, QualityLevelsAttenuateStopbandInOrder)
+{
+	const std::size_t inputSampleRate{48000};
+	const std::size_t samples{inputSampleRate / 2};
+	AudioData stopbandTone{GenerateSineWave(20000.0, inputSampleRate, samples)};
+	AudioData passbandTone{GenerateSineWave(1000.0, inputSampleRate, samples)};
+
+	double attenuations[QUALITY_COUNT];
+	for(std::size_t quality{0}; quality < QUALITY_COUNT; ++quality)
+	{
+		Signal::Resampler downsampler{inputSampleRate, 0.5, Utilities::Synchronization::SINGLE_THREADED, QUALITIES[quality]};
+		downsampler.SubmitAudioData(stopbandTone);
+		attenuations[quality] = -OutputLevelInDecibels(downsampler.FlushAudioData());
+
+		Signal::Resampler passbandDownsampler{inputSampleRate, 0.5, Utilities::Synchronization::SINGLE_THREADED, QUALITIES[quality]};
+		passbandDownsampler.SubmitAudioData(passbandTone);
+		EXPECT_NEAR(0.0, OutputLevelInDecibels(passbandDownsampler.FlushAudioData()), 0.1) << QUALITY_NAMES[quality];
+	}
+
+	// Legacy keeps the resampler's original low pass filter, with its two center taps
+	EXPECT_NEAR(16.0, attenuations[0], 2.0);
+	EXPECT_GT(attenuations[1], 80.0);
+	EXPECT_GT(attenuations[2], attenuations[1]);
+	EXPECT_GT(attenuations[3], attenuations[2]);
+	EXPECT_GT(attenuations[4], attenuations[3]);
+}
+
+// Reports the throughput of each quality level.  Timings aren't checked, so this is disabled in the unit tests, run it 
+// with --gtest_also_run_disabled_tests --gtest_filter=*QualityLevelThroughput in a release build.
+TEST(ResamplerTests, DISABLED_QualityLevelThroughput)
+{
+	const std::size_t inputSampleRate{48000};
+	const std::size_t samples{inputSampleRate * 4};
+	AudioData tone{GenerateSineWave(1000.0, inputSampleRate, samples)};
+
+	for(std::size_t quality{0}; quality < QUALITY_COUNT; ++quality)
+	{
+		// 48000Hz to 44100Hz is the usual case of a ratio with a large numerator, submitted a block at a time
+		const std::size_t blockSize{4096};
+		auto start{std::chrono::steady_clock::now()};
+		Signal::Resampler resampler{inputSampleRate, 44100.0 / 48000.0, Utilities::Synchronization::SINGLE_THREADED, QUALITIES[quality]};
+		for(std::size_t i{0}; i < samples; i += blockSize)
+		{
+			resampler.SubmitAudioData(tone.Retrieve(i, std::min(blockSize, samples - i)));
+			resampler.GetAudioData(resampler.OutputSamplesAvailable());
+		}
+		resampler.FlushAudioData();
+		std::chrono::duration<double> seconds{std::chrono::steady_clock::now() - start};
+
+		std::cout << QUALITY_NAMES[quality] << ": " << static_cast<double>(samples) / seconds.count() / 1e6 << " million samples per second" << std::endl;
+	}
+}
+
+TEST(ResamplerTests, SetResampleRatioMatchesInstantiatedRatio)
+{
+	WaveFile::WaveFileReader inputWaveFile{"SinglePianoKey.wav"};
+	auto input{inputWaveFile.GetAudioData()[0]};
+	double resampleRatio{96017.0 / static_cast<double>(inputWaveFile.GetSampleRate())};
+
+	Signal::Resampler expectedResampler{inputWaveFile.GetSampleRate(), resampleRatio};
+	expectedResampler.SubmitAudioData(input);
+	auto expected{expectedResampler.FlushAudioData()};
+
+	// From a ratio with polyphase banks and from no sample rate change
+	for(double initialResampleRatio : {48000.0 / 44100.0, 1.0})
+	{
+		Signal::Resampler resampler{inputWaveFile.GetSampleRate(), initialResampleRatio};
+		resampler.SetResampleRatio(resampleRatio);
+		EXPECT_EQ(resampleRatio, resampler.GetResampleRatio());
+
+		resampler.SubmitAudioData(input);
+		EXPECT_EQ(expected.GetData(), resampler.FlushAudioData().GetData()) << initialResampleRatio;
+	}
+}
+
+// Each output sample is compared with the sine wave at the time the ratios so far put it, through ramps, sudden 
+// changes and changes between upsampling and downsampling
+TEST(ResamplerTests, ChangingRatioFollowsSineWave)
+{
+	const std::size_t sampleRate{44100};
+	const double frequency{440.0};
+	const std::size_t blockSize{512};
+	auto input{GenerateSineWave(frequency, sampleRate, 200 * blockSize)};
+
+	// The ratio to set, and the output samples to ramp over, before the given block
+	struct RatioChange
+	{
+		std::size_t block;
+		double resampleRatio;
+		std::size_t rampOutputSamples;
+	};
+
+	std::vector<RatioChange> ratioChanges{{10, 1.002, 3000}, {30, 0.9985, 0}, {50, 1.25, 20000}, {100, 0.75, 10000}, 
+										  {101, 0.8, 0}, {150, 1.0, 500}};
+
+	for(double initialResampleRatio : {1.0, 48000.0 / 44100.0})
+	{
+		Signal::Resampler resampler{sampleRate, initialResampleRatio, Utilities::Synchronization::SINGLE_THREADED};
+
+		const double pi{3.14159265358979323846};
+		double inputTime{0.0};
+		double inputStep{1.0 / initialResampleRatio};
+		double targetInputStep{inputStep};
+		double inputStepChange{0.0};
+		std::size_t rampOutputSamplesRemaining{0};
+		double maximumError{0.0};
+		auto nextChange{ratioChanges.begin()};
+		for(std::size_t block{0}; block < input.GetSize() / blockSize; ++block)
+		{
+			if(nextChange != ratioChanges.end() && nextChange->block == block)
+			{
+				resampler.SetResampleRatio(nextChange->resampleRatio, nextChange->rampOutputSamples);
+				targetInputStep = 1.0 / nextChange->resampleRatio;
+				rampOutputSamplesRemaining = nextChange->rampOutputSamples;
+				if(rampOutputSamplesRemaining == 0)
+				{
+					inputStep = targetInputStep;
+				}
+				else
+				{
+					inputStepChange = (targetInputStep - inputStep) / static_cast<double>(rampOutputSamplesRemaining);
+				}
+
+				++nextChange;
+			}
+
+			resampler.SubmitAudioData(input.Retrieve(block * blockSize, blockSize));
+			auto output{resampler.GetAudioData(resampler.OutputSamplesAvailable())};
+			for(double sample : output.GetData())
+			{
+				double expectedSample{0.5 * std::sin(2.0 * pi * frequency * inputTime / static_cast<double>(sampleRate))};
+				maximumError = std::max(maximumError, std::abs(sample - expectedSample));
+
+				inputTime += inputStep;
+				if(rampOutputSamplesRemaining > 0)
+				{
+					--rampOutputSamplesRemaining;
+					inputStep = (rampOutputSamplesRemaining == 0) ? targetInputStep : inputStep + inputStepChange;
+				}
+			}
+		}
+
+		// The input time of the next output sample is about where the input ends, less the sinc filter's samples per side 
+		// and the half of the low pass filter started by the first downsampling ratio
+		EXPECT_NEAR(static_cast<double>(input.GetSize() - 20 - 50), inputTime, 2.0) << initialResampleRatio;
+		// About the interpolation error at a fixed ratio, a sample out of place would be off by over 0.02
+		EXPECT_LT(maximumError, 0.002) << initialResampleRatio;
+		EXPECT_EQ(1.0, resampler.GetResampleRatio());
+	}
+}
+
+// Changing to a 2:1 downsample part way through, suddenly or with a ramp, filters like a resampler instantiated to do it
+TEST(ResamplerTests, ChangingRatioFollowsLowPassFilter)
+{
+	const std::size_t inputSampleRate{48000};
+	const std::size_t samples{inputSampleRate / 2};
+	AudioData stopbandTone{GenerateSineWave(20000.0, inputSampleRate, samples)};
+	AudioData passbandTone{GenerateSineWave(1000.0, inputSampleRate, samples)};
+
+	for(double initialResampleRatio : {1.0, 1.5, 0.9})
+	{
+		for(std::size_t rampOutputSamples : {0, 2000})
+		{
+			auto resampleAfterChange{[&](const AudioData& tone)
+			{
+				Signal::Resampler resampler{inputSampleRate, initialResampleRatio, Utilities::Synchronization::SINGLE_THREADED, 
+											Signal::ResamplerQuality::NORMAL};
+				resampler.SubmitAudioData(tone.Retrieve(0, samples / 2));
+				resampler.GetAudioData(resampler.OutputSamplesAvailable());
+
+				resampler.SetResampleRatio(0.5, rampOutputSamples);
+				resampler.SubmitAudioData(tone.Retrieve(samples / 2, samples / 2));
+				return resampler.FlushAudioData();
+			}};
+
+			EXPECT_GT(-OutputLevelInDecibels(resampleAfterChange(stopbandTone)), 80.0) << initialResampleRatio << " " << rampOutputSamples;
+			EXPECT_NEAR(0.0, OutputLevelInDecibels(resampleAfterChange(passbandTone)), 0.1) << initialResampleRatio << " " << rampOutputSamples;
+		}
+	}
+}
+
+// Changes of direction in the middle of the input, from a ratio with polyphase banks and without, with the sinc 
+// filter's position and the low pass filter both having to carry over
+TEST(ResamplerTests, ChangingDirectionKeepsSineWaveSmooth)
+{
+	const std::size_t sampleRate{44100};
+	const std::size_t blockSize{512};
+	auto input{GenerateSineWave(440.0, sampleRate, 6 * blockSize)};
+
+	for(const auto& resampleRatios : std::vector<std::pair<double, double>>{{1.1, 0.9}, {0.5, 1.5}, {0.9, 1.1}, {1.5, 0.5}, 
+																			 {1.0, 0.9}, {48000.0 / 44100.0, 22050.0 / 44100.0}})
+	{
+		Signal::Resampler resampler{sampleRate, resampleRatios.first, Utilities::Synchronization::SINGLE_THREADED};
+		resampler.SubmitAudioData(input.Retrieve(0, blockSize));
+		resampler.SetResampleRatio(resampleRatios.second);
+		resampler.SubmitAudioData(input.Retrieve(blockSize, input.GetSize() - blockSize));
+		auto output{resampler.FlushAudioData()};
+
+		// Away from the silence at each end the output is a sine wave of the same amplitude, which at the lowest ratio 
+		// changes by at most about 0.0627 per output sample
+		const std::size_t edgeSamples{100};
+		ASSERT_GT(output.GetSize(), 2 * edgeSamples);
+		for(std::size_t i{edgeSamples}; i < output.GetSize() - edgeSamples; ++i)
+		{
+			ASSERT_LT(std::abs(output.GetData()[i]), 0.51) << resampleRatios.first << " to " << resampleRatios.second << " sample " << i;
+			ASSERT_LT(std::abs(output.GetData()[i] - output.GetData()[i - 1]), 0.065) << resampleRatios.first << " to " << resampleRatios.second << " sample " << i;
+		}
+	}
+}
+
+// After a flush the resampler carries on as if it had just been instantiated, whatever it was doing before
+TEST(ResamplerTests, FlushRestartsLikeNewResampler)
+{
+	const std::size_t sampleRate{44100};
+	auto input{GenerateSineWave(440.0, sampleRate, 512)};
+
+	// Input shorter than the history kept while not resampling, and changing the ratio once flushed
+	struct Restart
+	{
+		double resampleRatio;
+		double resampleRatioAfterFlush;
+		std::size_t samplesAfterFlush;
+	};
+
+	for(const auto& restart : {Restart{1.0, 1.0, 30}, Restart{1.0, 1.1, 512}, Restart{0.5, 0.5, 512}, Restart{1.1, 1.1, 30}})
+	{
+		auto inputAfterFlush{input.Retrieve(0, restart.samplesAfterFlush)};
+
+		Signal::Resampler expectedResampler{sampleRate, restart.resampleRatioAfterFlush};
+		expectedResampler.SubmitAudioData(inputAfterFlush);
+		auto expected{expectedResampler.FlushAudioData()};
+
+		Signal::Resampler resampler{sampleRate, restart.resampleRatio};
+		resampler.SubmitAudioData(input);
+		resampler.FlushAudioData();
+		resampler.SetResampleRatio(restart.resampleRatioAfterFlush);
+		resampler.SubmitAudioData(inputAfterFlush);
+
+		EXPECT_EQ(expected.GetData(), resampler.FlushAudioData().GetData()) << restart.resampleRatio << " to " << restart.resampleRatioAfterFlush;
+	}
+}
+
+TEST(ResamplerTests, SetResampleRatioOutOfRange)
+{
+	Signal::Resampler resampler{44100, 1.0};
+	EXPECT_THROW(resampler.SetResampleRatio(10.0), Utilities::Exception);
+	EXPECT_THROW(resampler.SetResampleRatio(0.01), Utilities::Exception);
+	EXPECT_EQ(1.0, resampler.GetResampleRatio());
+}
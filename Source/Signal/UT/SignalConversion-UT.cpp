@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <Signal/SignalConversion.h>
+#include <Utilities/Exception.h>
 #include <vector>
 
 // Note that we test clipping here too (note, the value over 1.0 or under -1.0
@@ -192,3 +193,27 @@ TEST(SignalConversionTests, ConvertInterleavedSigned16ToAudioData)
 	EXPECT_NEAR(-1.0, audioData[0].GetData()[10], 0.0001);
 	EXPECT_NEAR(1.0, audioData[1].GetData()[10], 0.0001);
 }
+
+TEST(SignalConversionTests, ConvertBetweenInterleaved16BitAndAudioBuffer)
+{
+	std::vector<int16_t> interleaved{0, 8192, 16384, -8192, 32767, -32768};
+
+	for(auto layout : {AudioBuffer::Layout::INTERLEAVED, AudioBuffer::Layout::PLANAR})
+	{
+		auto audioBuffer{Signal::ConvertInterleavedSigned16ToAudioBuffer(interleaved, 2, layout)};
+		EXPECT_EQ(layout, audioBuffer.GetLayout());
+		EXPECT_EQ(2, audioBuffer.GetChannels());
+		EXPECT_EQ(3, audioBuffer.GetFrames());
+
+		EXPECT_NEAR(0.0, audioBuffer.GetSample(0, 0), 0.0001);
+		EXPECT_NEAR(0.25, audioBuffer.GetSample(1, 0), 0.0001);
+		EXPECT_NEAR(0.5, audioBuffer.GetSample(0, 1), 0.0001);
+		EXPECT_NEAR(-0.25, audioBuffer.GetSample(1, 1), 0.0001);
+		EXPECT_NEAR(1.0, audioBuffer.GetSample(0, 2), 0.0001);
+		EXPECT_NEAR(-1.0, audioBuffer.GetSample(1, 2), 0.0001);
+
+		EXPECT_EQ(interleaved, Signal::ConvertAudioBufferToInterleavedSigned16(audioBuffer));
+	}
+
+	EXPECT_THROW(Signal::ConvertInterleavedSigned16ToAudioBuffer(interleaved, 4), Utilities::Exception);
+}
@@ -0,0 +1,161 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#define _USE_MATH_DEFINES  // Seems some compilers need this so M_PI will be defined
+#include <math.h>
+#include <Signal/Stft.h>
+#include <Signal/Fourier.h>
+#include <Signal/Windowing.h>
+#include <Utilities/Exception.h>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+	std::vector<double> CreateTestSignal(std::size_t length)
+	{
+		std::vector<double> signal(length);
+		for(std::size_t i{0}; i < length; ++i)
+		{
+			signal[i] = 0.6 * sin(2.0 * M_PI * 440.0 * i / 44100.0) + 0.3 * cos(2.0 * M_PI * 3000.0 * i / 44100.0);
+		}
+
+		return signal;
+	}
+
+	std::vector<double> CreateBlackmanWindow(std::size_t length)
+	{
+		std::vector<double> window(length, 1.0);
+		Signal::BlackmanWindow(window);
+		return window;
+	}
+}
+
+TEST(SignalStft, TestFramesMatchSingleFFT)
+{
+	std::vector<double> signal{CreateTestSignal(5000)};
+	std::vector<double> window{CreateBlackmanWindow(1024)};
+	Utilities::ThreadPool pool{3};
+	Signal::StftFrames frames{Signal::Stft(AudioDataView{signal}, window, 256, 2048, pool)};
+
+	// Enough frames to reach the end of the signal
+	EXPECT_EQ(17, frames.GetFrameCount());
+	EXPECT_EQ(1025, frames.GetBinCount());
+	EXPECT_EQ(2048, frames.GetFftSize());
+	EXPECT_EQ(256, frames.GetHopSize());
+	EXPECT_EQ(5000, frames.GetSignalLength());
+
+	for(std::size_t frame : {std::size_t{0}, std::size_t{7}, std::size_t{16}})
+	{
+		std::vector<double> windowed(2048, 0.0);
+		for(std::size_t i{0}; i < window.size() && frame * 256 + i < signal.size(); ++i)
+		{
+			windowed[i] = signal[frame * 256 + i] * window[i];
+		}
+
+		Signal::FrequencyDomain expected{Signal::Fourier::ApplyFFT(AudioDataView{windowed})};
+		Signal::FrequencyDomain actual{frames.GetFrequencyDomain(frame)};
+		ASSERT_EQ(expected.GetSize(), actual.GetSize());
+		for(std::size_t bin{0}; bin < expected.GetSize(); ++bin)
+		{
+			EXPECT_NEAR(expected.GetRealComponent()[bin], actual.GetRealComponent()[bin], 1e-9);
+			EXPECT_NEAR(expected.GetImaginaryComponent()[bin], actual.GetImaginaryComponent()[bin], 1e-9);
+		}
+	}
+
+	EXPECT_THROW(frames.GetFrequencyDomain(17), Utilities::Exception);
+}
+
+TEST(SignalStft, TestRoundTrip)
+{
+	std::vector<double> signal{CreateTestSignal(10000)};
+
+	// Any FFT size works, with or without zero padding
+	for(std::size_t fftSize : {std::size_t{1024}, std::size_t{1000}, std::size_t{1500}})
+	{
+		std::vector<double> window{CreateBlackmanWindow(1000)};
+		Signal::StftFrames frames{Signal::Stft(AudioDataView{signal}, window, 250, fftSize)};
+		AudioData output{Signal::Istft(frames, window)};
+		ASSERT_EQ(signal.size(), output.GetSize());
+
+		// The Blackman window is zero at its ends, so the very first sample can't be recovered
+		for(std::size_t i{1}; i < signal.size(); ++i)
+		{
+			ASSERT_NEAR(signal[i], output.GetDataPointer()[i], 1e-9) << "fftSize " << fftSize << " sample " << i;
+		}
+	}
+}
+
+TEST(SignalStft, TestFloatRoundTrip)
+{
+	std::vector<double> signal{CreateTestSignal(3000)};
+	std::vector<float> floatSignal(signal.begin(), signal.end());
+	std::vector<double> window{CreateBlackmanWindow(512)};
+	Signal::StftFrames frames{Signal::Stft(AudioDataViewFloat{floatSignal}, window, 128, 512)};
+	AudioDataFloat output{Signal::Istft<float>(frames, window)};
+	ASSERT_EQ(floatSignal.size(), output.GetSize());
+	for(std::size_t i{1}; i < floatSignal.size(); ++i)
+	{
+		ASSERT_NEAR(floatSignal[i], output.GetDataPointer()[i], 1e-5);
+	}
+}
+
+TEST(SignalStft, TestThreadCountDoesNotChangeResult)
+{
+	std::vector<double> signal{CreateTestSignal(20000)};
+	std::vector<double> window{CreateBlackmanWindow(512)};
+	Utilities::ThreadPool singleThread{0};
+	Utilities::ThreadPool manyThreads{7};
+
+	Signal::StftFrames singleFrames{Signal::Stft(AudioDataView{signal}, window, 100, 512, singleThread)};
+	Signal::StftFrames manyFrames{Signal::Stft(AudioDataView{signal}, window, 100, 512, manyThreads)};
+	ASSERT_EQ(singleFrames.GetFrameCount(), manyFrames.GetFrameCount());
+	for(std::size_t frame{0}; frame < singleFrames.GetFrameCount(); ++frame)
+	{
+		EXPECT_TRUE(std::equal(singleFrames.GetReal(frame), singleFrames.GetReal(frame) + singleFrames.GetBinCount() * 2, manyFrames.GetReal(frame)));
+	}
+
+	AudioData singleOutput{Signal::Istft(singleFrames, window, singleThread)};
+	AudioData manyOutput{Signal::Istft(manyFrames, window, manyThreads)};
+	ASSERT_EQ(singleOutput.GetSize(), manyOutput.GetSize());
+	for(std::size_t i{0}; i < singleOutput.GetSize(); ++i)
+	{
+		ASSERT_EQ(singleOutput.GetDataPointer()[i], manyOutput.GetDataPointer()[i]);
+	}
+}
+
+TEST(SignalStft, TestInvalidParameters)
+{
+	std::vector<double> signal{CreateTestSignal(100)};
+	EXPECT_THROW(Signal::Stft(AudioDataView{signal}, std::vector<double>(64, 1.0), 0, 64), Utilities::Exception);
+	EXPECT_THROW(Signal::Stft(AudioDataView{signal}, std::vector<double>(65, 1.0), 16, 64), Utilities::Exception);
+	EXPECT_THROW(Signal::Stft(AudioDataView{signal}, std::vector<double>{}, 16, 64), Utilities::Exception);
+
+	Signal::StftFrames frames{Signal::Stft(AudioDataView{}, std::vector<double>(64, 1.0), 16, 64)};
+	EXPECT_EQ(0, frames.GetFrameCount());
+	EXPECT_EQ(0, Signal::Istft(frames, std::vector<double>(64, 1.0)).GetSize());
+}
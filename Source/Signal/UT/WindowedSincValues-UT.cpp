@@ -0,0 +1,133 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Signal/Source/WindowedSincValues.h>
+#include <Utilities/Exception.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST(WindowedSincTableTests, GetValuesMatchesGetSincValue)
+{
+	auto table{Signal::WindowedSincTable::GetTable(224, Signal::SINC_ZERO_CROSSINGS_PER_SIDE)};
+	EXPECT_EQ(Signal::SINC_SAMPLES_PER_X_INTEGER, table->GetSamplesPerXInteger());
+	EXPECT_EQ(224.0 * 22.0, table->GetMaxXPosition());
+
+	std::mt19937 generator{1};
+	std::uniform_real_distribution<double> distribution{-table->GetMaxXPosition() + 1.0, table->GetMaxXPosition() - 1.0};
+	std::vector<double> xPositions{0.0, 1.0, -1.0, 224.0, -224.0, 0.5, -0.5};
+	for(std::size_t i{0}; i < 10000; ++i)
+	{
+		xPositions.push_back(distribution(generator));
+	}
+
+	std::vector<double> values(xPositions.size());
+	table->GetValues(xPositions.data(), xPositions.size(), values.data());
+
+	for(std::size_t i{0}; i < xPositions.size(); ++i)
+	{
+		ASSERT_EQ(Signal::GetSincValue(xPositions[i]), table->GetValue(xPositions[i])) << xPositions[i];
+		ASSERT_EQ(Signal::GetSincValue(xPositions[i]), values[i]) << xPositions[i];
+	}
+}
+
+TEST(WindowedSincTableTests, TablesAreShared)
+{
+	auto table{Signal::WindowedSincTable::GetTable(64, 11)};
+	EXPECT_EQ(table, Signal::WindowedSincTable::GetTable(64, 11));
+	EXPECT_NE(table, Signal::WindowedSincTable::GetTable(64, 12));
+	EXPECT_NE(table, Signal::WindowedSincTable::GetTable(64, 11, Signal::SincWindow::BLACKMAN));
+	EXPECT_EQ(Signal::SincWindow::BLACKMAN, Signal::WindowedSincTable::GetTable(64, 11, Signal::SincWindow::BLACKMAN)->GetWindow());
+
+	EXPECT_THROW(Signal::WindowedSincTable(0, 11), Utilities::Exception);
+	EXPECT_THROW(Signal::WindowedSincTable(64, 0), Utilities::Exception);
+}
+
+TEST(WindowedSincTableTests, UnusedTablesAreFreed)
+{
+	std::weak_ptr<const Signal::WindowedSincTable> table{Signal::WindowedSincTable::GetTable(32, 5)};
+	EXPECT_TRUE(table.expired());
+
+	// And calculated the same when needed again
+	auto recalculatedTable{Signal::WindowedSincTable::GetTable(32, 5)};
+	EXPECT_EQ(recalculatedTable->GetValue(40.5), Signal::WindowedSincTable(32, 5).GetValue(40.5));
+}
+
+TEST(WindowedSincTableTests, FloatTable)
+{
+	Signal::WindowedSincTable table{64, 11};
+	Signal::WindowedSincTableFloat floatTable{64, 11};
+
+	for(double xPosition{-700.0}; xPosition < 700.0; xPosition += 3.7)
+	{
+		EXPECT_NEAR(table.GetValue(xPosition), floatTable.GetValue(xPosition), 1e-6);
+	}
+}
+
+TEST(WindowedSincTableTests, ValuesPastTheTableAreZero)
+{
+	Signal::WindowedSincTable table{64, 11};
+	EXPECT_EQ(64.0, table.GetSamplesPerXInteger());
+	EXPECT_EQ(64.0 * 11.0, table.GetMaxXPosition());
+
+	EXPECT_EQ(0.0, table.GetValue(64.0 * 11.0 + 0.5));
+	EXPECT_EQ(0.0, table.GetValue(-64.0 * 11.0 - 0.5));
+	EXPECT_EQ(0.0, table.GetValue(1e9));
+}
+
+TEST(WindowedSincTableTests, CalculatedTable)
+{
+	Signal::WindowedSincTable table{64, 11};
+
+	// One at the center, zero at every zero crossing and symmetric
+	EXPECT_EQ(1.0, table.GetValue(0.0));
+	for(double zeroCrossing{64.0}; zeroCrossing < table.GetMaxXPosition(); zeroCrossing += 64.0)
+	{
+		EXPECT_NEAR(0.0, table.GetValue(zeroCrossing), 1e-15);
+	}
+
+	for(double xPosition{0.25}; xPosition < table.GetMaxXPosition(); xPosition += 7.3)
+	{
+		EXPECT_EQ(table.GetValue(xPosition), table.GetValue(-xPosition));
+	}
+
+	// The same windowed sinc at a lower resolution only differs by the error of interpolating between fewer values
+	auto defaultTable{Signal::WindowedSincTable::GetTable(224, 22)};
+	Signal::WindowedSincTable lowResolutionTable{64, 22};
+	for(double xPosition{0.0}; xPosition < 20.0; xPosition += 0.37)
+	{
+		EXPECT_NEAR(defaultTable->GetValue(xPosition * 224.0), lowResolutionTable.GetValue(xPosition * 64.0), 1e-3);
+	}
+
+	// Both windows are one at the center and zero at the ends, the blackman window falls faster
+	Signal::WindowedSincTable blackmanTable{64, 11, Signal::SincWindow::BLACKMAN};
+	EXPECT_EQ(1.0, blackmanTable.GetValue(0.0));
+	for(double xPosition{32.0}; xPosition < table.GetMaxXPosition(); xPosition += 64.0)
+	{
+		EXPECT_LT(std::fabs(blackmanTable.GetValue(xPosition)), std::fabs(table.GetValue(xPosition)));
+	}
+}
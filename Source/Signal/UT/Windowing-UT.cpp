@@ -79,6 +79,24 @@ TEST(WindowingTests, BlackmanWindowTest75To100)
 	}
 }
 
+TEST(WindowingTests, BlackmanWindowViewMatchesInPlace)
+{
+	std::vector<double> input(512, 0.5);
+	std::vector<double> inPlace{input};
+	Signal::BlackmanWindow(inPlace, 25.0, 75.0);	
+
+	std::vector<double> output;
+	Signal::BlackmanWindow(AudioDataView{input}, output, 25.0, 75.0);	
+
+	EXPECT_EQ(inPlace, output);
+
+	// The input viewed must be left untouched
+	for(auto sample : input)
+	{
+		EXPECT_EQ(0.5, sample);
+	}
+}
+
 TEST(WindowingTests, LinearFadeInOutEvenTest)
 {
 	std::vector<double> signal(1024, 1.0);
@@ -26,23 +26,52 @@
 
 #pragma once
 
+#include <AudioData/AudioDataView.h>
 #include <vector>
 
 //! @file Windowing.h
 //! @brief Functions for applying various windowing to audio signals.
+//!
+//! The functions are templated on the sample type and are available for both 
+//! double and float samples.  Window coefficients are always calculated in double.
 
 namespace Signal {
 
 //! Apply a Blackman window.
-void BlackmanWindow(std::vector<double>& inputSignal, double startPercent=0.0, double endPercent=100.0);
+template<typename T>
+void BlackmanWindow(std::vector<T>& inputSignal, double startPercent=0.0, double endPercent=100.0);
 
 //! Apply an inverse Blackman window.
-void InverseBlackmanWindow(std::vector<double>& inputSignal, double startPercent=0.0, double endPercent=100.0);
+template<typename T>
+void InverseBlackmanWindow(std::vector<T>& inputSignal, double startPercent=0.0, double endPercent=100.0);
 
 //! Apply an reverse Blackman window.
-void ReverseBlackmanWindow(std::vector<double>& inputSignal, double startPercent=0.0, double endPercent=100.0);
+template<typename T>
+void ReverseBlackmanWindow(std::vector<T>& inputSignal, double startPercent=0.0, double endPercent=100.0);
+
+//! Apply a Blackman window to the samples of the given view, writing the windowed samples to the output.
+//
+//! The output is resized to the size of the view.  This avoids copying samples that are only read.
+template<typename T>
+void BlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent=0.0, double endPercent=100.0);
+
+//! Apply a Blackman window to the samples of the given view, writing the windowed samples to the output.
+//
+//! The output must have room for the number of samples in the view.  This allows windowing into 
+//! scratch buffers that aren't a std::vector<T> with the default allocator.
+template<typename T>
+void BlackmanWindow(const BasicAudioDataView<T>& inputSignal, T* outputSignal, double startPercent=0.0, double endPercent=100.0);
+
+//! Apply an inverse Blackman window to the samples of the given view, writing the windowed samples to the output.
+template<typename T>
+void InverseBlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent=0.0, double endPercent=100.0);
+
+//! Apply an reverse Blackman window to the samples of the given view, writing the windowed samples to the output.
+template<typename T>
+void ReverseBlackmanWindow(const BasicAudioDataView<T>& inputSignal, std::vector<T>& outputSignal, double startPercent=0.0, double endPercent=100.0);
 
 //! Apply linear window.
-void LinearFadeInOut(std::vector<double>& inputSignal);
+template<typename T>
+void LinearFadeInOut(std::vector<T>& inputSignal);
 
 }
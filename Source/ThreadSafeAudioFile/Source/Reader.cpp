@@ -69,7 +69,8 @@ AudioData ThreadSafeAudioFile::Reader::ReadAudioStream(std::size_t streamID, std
 	// There is a lot of opportunity for making this more efficient, especially for stereo wave files.  Stereo wave files have their 
 	// channels interleaved - left sample, right sample, repeat.  So when the waveFileReader does a read on a stereo file, right now 
 	// we're just throwing away the entire other channel that it reads, when likely we're reading that other channeling in a different 
-	// thread.  A buffering scheme could really improve this.
+	// thread.  A buffering scheme could really improve this.  At least reading into a single interleaved AudioBuffer means only the 
+	// requested channel is ever copied into an AudioData.
 
-	return waveFileReader_.GetAudioData(sampleStartPosition, samplesToRead)[streamID];
+	return waveFileReader_.GetAudioBuffer(sampleStartPosition, samplesToRead).GetChannelAudioData(streamID);
 }
@@ -27,6 +27,7 @@
 #include <ThreadSafeAudioFile/Writer.h>
 #include <Utilities/Exception.h>
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioBuffer.h>
 #include <algorithm>
 
 ThreadSafeAudioFile::Writer::Writer(const std::string& filename, std::size_t channels, std::size_t sampleRate, std::size_t bitsPerSample) :
@@ -74,15 +75,17 @@ void ThreadSafeAudioFile::Writer::WriteAudioStream(std::size_t streamID, const A
 		{
 			auto samplesToWrite{std::min(audioData.GetSize(), audioDataBuffers_[oppositeStreamID].GetSize())};
 
-			std::vector<AudioData> dataToWrite(waveFileWriter_.GetChannels());
-			dataToWrite[streamID].Append(audioData.Retrieve(samplesToWrite));
-			dataToWrite[oppositeStreamID].Append(audioDataBuffers_[oppositeStreamID].RetrieveRemove(samplesToWrite));
+			// Both channels are interleaved straight into the buffer that gets written to the wave file
+			AudioBuffer dataToWrite{waveFileWriter_.GetChannels(), samplesToWrite, AudioBuffer::Layout::INTERLEAVED};
+			dataToWrite.SetChannelSamples(streamID, audioData.View(0, samplesToWrite));
+			dataToWrite.SetChannelSamples(oppositeStreamID, audioDataBuffers_[oppositeStreamID].View(0, samplesToWrite));
+			audioDataBuffers_[oppositeStreamID].RemoveFrontSamples(samplesToWrite);
 
-			waveFileWriter_.AppendAudioData(dataToWrite);
+			waveFileWriter_.AppendAudioBuffer(dataToWrite);
 
 			if(samplesToWrite < audioData.GetSize())  // Buffer whatever might remain of audioData
 			{
-				audioDataBuffers_[streamID].Append(audioData.Retrieve(samplesToWrite, audioData.GetSize() - samplesToWrite));
+				audioDataBuffers_[streamID].Append(audioData.View(samplesToWrite, audioData.GetSize() - samplesToWrite));
 			}
 		}
 
@@ -29,11 +29,11 @@
 #include <string>
 #include <mutex>
 #include <WaveFile/WaveFileWriter.h>
+#include <AudioData/AudioData.h>
 
 //! @file Writer.h
 //! @brief A threadsafe audio file writer.
 
-class AudioData;
 
 namespace ThreadSafeAudioFile {
 
@@ -0,0 +1,112 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+//! @file AlignedAllocator.h
+//! @brief A standard library compatible allocator returning aligned memory.
+
+namespace Utilities {
+
+//! Allocates the given number of bytes with the start of the memory at the given alignment.
+//
+//! The alignment must be a power of two.  Memory allocated must be freed with AlignedFree().
+inline void* AlignedAllocate(std::size_t bytes, std::size_t alignment)
+{
+	// Over allocate so there's room to align the block and to store the original pointer just in front of it
+	void* original{::operator new(bytes + alignment + sizeof(void*))};
+
+	std::uintptr_t start{reinterpret_cast<std::uintptr_t>(original) + sizeof(void*)};
+	std::uintptr_t aligned{(start + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)};
+	reinterpret_cast<void**>(aligned)[-1] = original;
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+//! Frees memory allocated with AlignedAllocate().
+inline void AlignedFree(void* memory)
+{
+	if(memory)
+	{
+		::operator delete(reinterpret_cast<void**>(memory)[-1]);
+	}
+}
+
+//! A standard library compatible allocator returning memory aligned to the given number of bytes.
+//
+//! The default alignment of 64 bytes is a cache line on common hardware and is suitable for 
+//! any SIMD instruction set.
+
+template<typename T, std::size_t Alignment=64>
+class AlignedAllocator
+{
+	static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "AlignedAllocator alignment must be a power of two");
+
+	public:
+		using value_type = T;
+
+		//! Allows containers to allocate their internal types with the same alignment.
+		template<typename U>
+		struct rebind
+		{
+			using other = AlignedAllocator<U, Alignment>;
+		};
+
+		AlignedAllocator() noexcept { }
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept { }
+
+		//! Allocates memory for the given number of objects.
+		T* allocate(std::size_t count)
+		{
+			return static_cast<T*>(AlignedAllocate(count * sizeof(T), Alignment));
+		}
+
+		//! Frees memory obtained from allocate().
+		void deallocate(T* memory, std::size_t)
+		{
+			AlignedFree(memory);
+		}
+};
+
+template<typename T, typename U, std::size_t Alignment>
+bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&)
+{
+	return true;
+}
+
+template<typename T, typename U, std::size_t Alignment>
+bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&)
+{
+	return false;
+}
+
+} // End of namespace
@@ -0,0 +1,210 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+//! @file MemoryPool.h
+//! @brief A pool of aligned memory blocks and a standard library compatible allocator using it.
+
+namespace Utilities {
+
+//! Process wide counts of the memory requested through MemoryPool objects.
+struct AllocationCounters
+{
+	//! The number of blocks handed out by any pool.
+	uint64_t allocations_{0};
+
+	//! The number of those blocks that couldn't be reused and had to come from the heap.
+	uint64_t heapAllocations_{0};
+
+	//! The total bytes requested.
+	uint64_t bytesAllocated_{0};
+};
+
+//! Returns the current process wide allocation counters.
+AllocationCounters GetAllocationCounters();
+
+//! Measures pool allocations relative to the amount of audio processed.
+//
+//! Create the meter before processing, then give it the number of samples processed and their 
+//! sample rate to get the allocations made per second of processed audio.  The counters are 
+//! process wide, so allocations made by other threads while measuring are included.
+
+class AllocationRateMeter
+{
+	public:
+		//! Instantiate the meter, starting the measurement from the current counters.
+		AllocationRateMeter();
+
+		//! Restarts the measurement from the current counters.
+		void Restart();
+
+		//! Returns the allocations made since the measurement started per second of processed audio.
+		double GetAllocationsPerSecond(std::size_t samplesProcessed, std::size_t sampleRate) const;
+
+		//! Returns the heap allocations made since the measurement started per second of processed audio.
+		double GetHeapAllocationsPerSecond(std::size_t samplesProcessed, std::size_t sampleRate) const;
+
+	private:
+		AllocationCounters start_;
+};
+
+//! A pool of 64 byte aligned memory blocks.
+//
+//! Blocks are grouped into power of two size classes from 64 bytes to 1MB.  Freed blocks are kept 
+//! on a free list for their size class and handed out again rather than going back to the heap, 
+//! so repeatedly allocating same sized scratch buffers only touches the heap the first time.  
+//! Larger requests go straight to the heap.
+//!
+//! A pool is safe to use from multiple threads, but each thread normally uses its own pool (see 
+//! GetThreadPool()) so the pool's lock is uncontended.
+
+class MemoryPool
+{
+	public:
+		//! The alignment of every block handed out.
+		static const std::size_t ALIGNMENT{64};
+
+		//! The size of the largest block kept by the pool.
+		static const std::size_t MAXIMUM_POOLED_BYTES{1024 * 1024};
+
+		//! Instantiate an empty pool.
+		MemoryPool();
+
+		//! Frees all blocks held by the pool.
+		~MemoryPool();
+
+		MemoryPool(const MemoryPool&) = delete;
+		MemoryPool& operator=(const MemoryPool&) = delete;
+
+		//! Allocates a block of at least the given number of bytes.
+		void* Allocate(std::size_t bytes);
+
+		//! Returns a block to the pool.  The bytes must match those given to Allocate().
+		void Deallocate(void* memory, std::size_t bytes);
+
+		//! Frees the blocks currently held on the free lists.
+		void Release();
+
+		//! Returns the pool belonging to the calling thread.
+		//
+		//! Blocks from a thread's pool may be freed from any thread.  The pool lives as long as 
+		//! any allocator using it, even past the end of its thread.
+		static std::shared_ptr<MemoryPool> GetThreadPool();
+
+	private:
+		// Returns the size class index for the given bytes, or SIZE_CLASSES if they're too large to pool.
+		static std::size_t GetSizeClass(std::size_t bytes);
+
+		static const std::size_t MINIMUM_BLOCK_BYTES{64};
+		static const std::size_t SIZE_CLASSES{15};  // 64 bytes through 1MB
+
+		// Freed blocks are linked through their first bytes
+		struct FreeBlock
+		{
+			FreeBlock* next_;
+		};
+
+		std::array<FreeBlock*, SIZE_CLASSES> freeLists_;
+		std::mutex mutex_;
+};
+
+//! A standard library compatible allocator drawing memory from a MemoryPool.
+//
+//! A default constructed allocator uses the calling thread's pool.  Since the allocator keeps its 
+//! pool, containers carry their pool along when they're moved, copied or swapped.
+
+template<typename T>
+class PoolAllocator
+{
+	public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = PoolAllocator<U>;
+		};
+
+		//! Instantiate an allocator using the calling thread's pool.
+		PoolAllocator() : pool_{MemoryPool::GetThreadPool()} { }
+
+		//! Instantiate an allocator using the given pool.
+		explicit PoolAllocator(std::shared_ptr<MemoryPool> pool) : pool_{std::move(pool)} { }
+
+		template<typename U>
+		PoolAllocator(const PoolAllocator<U>& other) : pool_{other.GetPool()} { }
+
+		//! Allocates memory for the given number of objects.
+		T* allocate(std::size_t count)
+		{
+			return static_cast<T*>(pool_->Allocate(count * sizeof(T)));
+		}
+
+		//! Returns memory obtained from allocate() to the pool.
+		void deallocate(T* memory, std::size_t count)
+		{
+			pool_->Deallocate(memory, count * sizeof(T));
+		}
+
+		//! Returns the pool the allocator draws from.
+		const std::shared_ptr<MemoryPool>& GetPool() const
+		{
+			return pool_;
+		}
+
+	private:
+		std::shared_ptr<MemoryPool> pool_;
+};
+
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+{
+	return left.GetPool() == right.GetPool();
+}
+
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+{
+	return !(left == right);
+}
+
+//! A std::vector drawing its memory from the calling thread's pool.  Intended for scratch buffers.
+template<typename T>
+using PoolVector = std::vector<T, PoolAllocator<T>>;
+
+} // End of namespace
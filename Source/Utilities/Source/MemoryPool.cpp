@@ -0,0 +1,163 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Utilities/MemoryPool.h>
+#include <Utilities/AlignedAllocator.h>
+#include <atomic>
+
+namespace
+{
+	std::atomic<uint64_t> allocations{0};
+	std::atomic<uint64_t> heapAllocations{0};
+	std::atomic<uint64_t> bytesAllocated{0};
+
+	double CalculatePerSecond(uint64_t count, std::size_t samplesProcessed, std::size_t sampleRate)
+	{
+		if(samplesProcessed == 0 || sampleRate == 0)
+		{
+			return 0.0;
+		}
+
+		return static_cast<double>(count) / (static_cast<double>(samplesProcessed) / static_cast<double>(sampleRate));
+	}
+}
+
+Utilities::AllocationCounters Utilities::GetAllocationCounters()
+{
+	AllocationCounters counters;
+	counters.allocations_ = allocations.load(std::memory_order_relaxed);
+	counters.heapAllocations_ = heapAllocations.load(std::memory_order_relaxed);
+	counters.bytesAllocated_ = bytesAllocated.load(std::memory_order_relaxed);
+	return counters;
+}
+
+Utilities::AllocationRateMeter::AllocationRateMeter() : start_{GetAllocationCounters()} { }
+
+void Utilities::AllocationRateMeter::Restart()
+{
+	start_ = GetAllocationCounters();
+}
+
+double Utilities::AllocationRateMeter::GetAllocationsPerSecond(std::size_t samplesProcessed, std::size_t sampleRate) const
+{
+	return CalculatePerSecond(GetAllocationCounters().allocations_ - start_.allocations_, samplesProcessed, sampleRate);
+}
+
+double Utilities::AllocationRateMeter::GetHeapAllocationsPerSecond(std::size_t samplesProcessed, std::size_t sampleRate) const
+{
+	return CalculatePerSecond(GetAllocationCounters().heapAllocations_ - start_.heapAllocations_, samplesProcessed, sampleRate);
+}
+
+Utilities::MemoryPool::MemoryPool()
+{
+	freeLists_.fill(nullptr);
+}
+
+Utilities::MemoryPool::~MemoryPool()
+{
+	Release();
+}
+
+void* Utilities::MemoryPool::Allocate(std::size_t bytes)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+	std::size_t sizeClass{GetSizeClass(bytes)};
+	if(sizeClass < SIZE_CLASSES)
+	{
+		std::lock_guard<std::mutex> guard(mutex_);
+		FreeBlock* block{freeLists_[sizeClass]};
+		if(block)
+		{
+			freeLists_[sizeClass] = block->next_;
+			return block;
+		}
+
+		bytes = MINIMUM_BLOCK_BYTES << sizeClass;
+	}
+
+	heapAllocations.fetch_add(1, std::memory_order_relaxed);
+	return AlignedAllocate(bytes, ALIGNMENT);
+}
+
+void Utilities::MemoryPool::Deallocate(void* memory, std::size_t bytes)
+{
+	if(!memory)
+	{
+		return;
+	}
+
+	std::size_t sizeClass{GetSizeClass(bytes)};
+	if(sizeClass < SIZE_CLASSES)
+	{
+		std::lock_guard<std::mutex> guard(mutex_);
+		FreeBlock* block{static_cast<FreeBlock*>(memory)};
+		block->next_ = freeLists_[sizeClass];
+		freeLists_[sizeClass] = block;
+		return;
+	}
+
+	AlignedFree(memory);
+}
+
+void Utilities::MemoryPool::Release()
+{
+	std::lock_guard<std::mutex> guard(mutex_);
+	for(auto& freeList : freeLists_)
+	{
+		while(freeList)
+		{
+			FreeBlock* next{freeList->next_};
+			AlignedFree(freeList);
+			freeList = next;
+		}
+	}
+}
+
+std::shared_ptr<Utilities::MemoryPool> Utilities::MemoryPool::GetThreadPool()
+{
+	thread_local std::shared_ptr<MemoryPool> threadPool{std::make_shared<MemoryPool>()};
+	return threadPool;
+}
+
+std::size_t Utilities::MemoryPool::GetSizeClass(std::size_t bytes)
+{
+	if(bytes > MAXIMUM_POOLED_BYTES)
+	{
+		return SIZE_CLASSES;
+	}
+
+	std::size_t sizeClass{0};
+	std::size_t blockBytes{MINIMUM_BLOCK_BYTES};
+	while(blockBytes < bytes)
+	{
+		blockBytes <<= 1;
+		++sizeClass;
+	}
+
+	return sizeClass;
+}
@@ -0,0 +1,166 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <Utilities/ThreadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+Utilities::ThreadPool::ThreadPool(std::size_t threads)
+{
+	for(std::size_t i{0}; i < threads; ++i)
+	{
+		threads_.emplace_back([this]() { RunWorker(); });
+	}
+}
+
+Utilities::ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(mutex_);
+		stopping_ = true;
+	}
+
+	taskAvailable_.notify_all();
+	for(auto& thread : threads_)
+	{
+		thread.join();
+	}
+}
+
+std::size_t Utilities::ThreadPool::GetThreadCount() const
+{
+	return threads_.size();
+}
+
+Utilities::ThreadPool& Utilities::ThreadPool::GetSharedPool()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+// The range is split into a few chunks per thread so uneven chunks still balance out.  Chunks are claimed 
+// through an atomic counter by the queued tasks and by the calling thread alike, so if the workers are busy 
+// (for example when called from work already running on the pool) the calling thread simply does all of it.
+void Utilities::ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t, std::size_t)>& work, std::size_t minimumChunk)
+{
+	if(count == 0)
+	{
+		return;
+	}
+
+	const std::size_t CHUNKS_PER_THREAD{4};
+	std::size_t chunkSize{std::max<std::size_t>(std::max<std::size_t>(minimumChunk, 1), count / ((threads_.size() + 1) * CHUNKS_PER_THREAD))};
+	std::size_t chunks{(count + chunkSize - 1) / chunkSize};
+
+	struct SharedState
+	{
+		std::atomic<std::size_t> nextChunk_{0};
+		std::size_t chunksFinished_{0};
+		std::exception_ptr exception_;
+		std::mutex mutex_;
+		std::condition_variable finished_;
+	};
+
+	auto state{std::make_shared<SharedState>()};
+
+	auto runChunks{[state, &work, count, chunkSize, chunks]()
+	{
+		std::size_t chunk;
+		while((chunk = state->nextChunk_.fetch_add(1)) < chunks)
+		{
+			std::exception_ptr exception;
+			try
+			{
+				std::size_t begin{chunk * chunkSize};
+				work(begin, std::min(begin + chunkSize, count));
+			}
+			catch(...)
+			{
+				exception = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> guard(state->mutex_);
+			if(exception && !state->exception_)
+			{
+				state->exception_ = exception;
+			}
+
+			if(++state->chunksFinished_ == chunks)
+			{
+				state->finished_.notify_all();
+			}
+		}
+	}};
+
+	std::size_t helpers{std::min(threads_.size(), chunks - 1)};
+	if(helpers > 0)
+	{
+		{
+			std::lock_guard<std::mutex> guard(mutex_);
+			for(std::size_t i{0}; i < helpers; ++i)
+			{
+				tasks_.emplace_back(runChunks);
+			}
+		}
+
+		taskAvailable_.notify_all();
+	}
+
+	runChunks();
+
+	// The work function lives on our stack, so every chunk must be done before returning.  Tasks that start 
+	// after that find no chunks left and never touch it.
+	std::unique_lock<std::mutex> lock(state->mutex_);
+	state->finished_.wait(lock, [&state, chunks]() { return state->chunksFinished_ == chunks; });
+
+	if(state->exception_)
+	{
+		std::rethrow_exception(state->exception_);
+	}
+}
+
+// Workers keep taking tasks until the pool is being destroyed and no tasks remain
+void Utilities::ThreadPool::RunWorker()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(true)
+	{
+		taskAvailable_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+		if(tasks_.empty())
+		{
+			return;
+		}
+
+		auto task{std::move(tasks_.front())};
+		tasks_.pop_front();
+
+		lock.unlock();
+		task();
+		lock.lock();
+	}
+}
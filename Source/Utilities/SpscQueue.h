@@ -0,0 +1,232 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+//! @file SpscQueue.h
+//! @brief A lock-free single-producer/single-consumer queue.
+
+namespace Utilities {
+
+//! How an object is going to be used with respect to threads.
+enum class Synchronization
+{
+	//! One thread may produce while another consumes.
+	THREAD_SAFE,
+
+	//! The object is only used by a single thread, so all synchronization is skipped.
+	SINGLE_THREADED
+};
+
+//! A lock-free single-producer/single-consumer queue of values.
+//
+//! One thread pushes values while another pops them, neither ever waiting on the other.  The 
+//! queue is unbounded: values are stored in fixed size segments and the producer links in a 
+//! new segment when the current one fills.  The consumer hands emptied segments back to the 
+//! producer for reuse, so a queue in steady state doesn't allocate.
+//!
+//! Push() may only be called by the producer and Pop() only by the consumer.  GetSize() may be 
+//! called by either.  Clear() must not be called while the other side is using the queue.
+//!
+//! With Synchronization::SINGLE_THREADED the same thread both pushes and pops and the atomic 
+//! operations use relaxed ordering, which costs the same as plain loads and stores.
+
+template<typename T>
+class SpscQueue
+{
+	public:
+		//! Instantiate an empty queue holding the given number of values per segment.
+		explicit SpscQueue(Synchronization synchronization=Synchronization::THREAD_SAFE, std::size_t segmentSize=4096) : 
+			segmentSize_{segmentSize},
+			synchronized_{synchronization == Synchronization::THREAD_SAFE}
+		{
+			head_ = tail_ = new Segment{segmentSize_};
+		}
+
+		~SpscQueue()
+		{
+			while(head_)
+			{
+				Segment* next{head_->next_.load(std::memory_order_relaxed)};
+				delete head_;
+				head_ = next;
+			}
+
+			delete spare_.load(std::memory_order_relaxed);
+		}
+
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue& operator=(const SpscQueue&) = delete;
+
+		//! Pushes the given values onto the back of the queue.  Producer only.
+		void Push(const T* values, std::size_t count)
+		{
+			std::size_t remaining{count};
+			while(remaining > 0)
+			{
+				if(tailIndex_ == segmentSize_)
+				{
+					// The segment is linked before any of its values are published below, so the 
+					// consumer always finds the next segment by the time it needs it.
+					Segment* segment{spare_.exchange(nullptr, std::memory_order_acquire)};
+					if(!segment)
+					{
+						segment = new Segment{segmentSize_};
+					}
+
+					segment->next_.store(nullptr, std::memory_order_relaxed);
+					tail_->next_.store(segment, std::memory_order_relaxed);
+					tail_ = segment;
+					tailIndex_ = 0;
+				}
+
+				std::size_t toCopy{std::min(remaining, segmentSize_ - tailIndex_)};
+				std::copy(values, values + toCopy, tail_->values_.get() + tailIndex_);
+				values += toCopy;
+				tailIndex_ += toCopy;
+				remaining -= toCopy;
+			}
+
+			Publish(pushed_, pushed_.load(std::memory_order_relaxed) + count);
+		}
+
+		//! Pops up to the given number of values from the front of the queue.  Consumer only.
+		//
+		//! Returns the number of values popped, which is less than requested if the queue holds 
+		//! fewer values.
+		std::size_t Pop(T* values, std::size_t count)
+		{
+			uint64_t popped{popped_.load(std::memory_order_relaxed)};
+			std::size_t available{static_cast<std::size_t>(Observe(pushed_) - popped)};
+			std::size_t toPop{std::min(count, available)};
+
+			std::size_t remaining{toPop};
+			while(remaining > 0)
+			{
+				if(headIndex_ == segmentSize_)
+				{
+					Segment* finished{head_};
+					head_ = head_->next_.load(std::memory_order_relaxed);
+					headIndex_ = 0;
+
+					// Hand the segment back to the producer for reuse, unless it already has one
+					Segment* expected{nullptr};
+					if(!spare_.compare_exchange_strong(expected, finished, std::memory_order_release, std::memory_order_relaxed))
+					{
+						delete finished;
+					}
+				}
+
+				std::size_t toCopy{std::min(remaining, segmentSize_ - headIndex_)};
+				std::copy(head_->values_.get() + headIndex_, head_->values_.get() + headIndex_ + toCopy, values);
+				values += toCopy;
+				headIndex_ += toCopy;
+				remaining -= toCopy;
+			}
+
+			Publish(popped_, popped + toPop);
+			return toPop;
+		}
+
+		//! Returns the number of values in the queue.
+		//
+		//! When called while the other side is active the size may have changed by the time it's used.
+		std::size_t GetSize() const
+		{
+			// Reading popped first means we can never see more popped than pushed
+			uint64_t popped{Observe(popped_)};
+			return static_cast<std::size_t>(Observe(pushed_) - popped);
+		}
+
+		//! Removes all values.  Neither side may be using the queue at the same time.
+		void Clear()
+		{
+			while(head_ != tail_)
+			{
+				Segment* next{head_->next_.load(std::memory_order_relaxed)};
+				delete head_;
+				head_ = next;
+			}
+
+			headIndex_ = tailIndex_ = 0;
+			popped_.store(0, std::memory_order_relaxed);
+			pushed_.store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		struct Segment
+		{
+			explicit Segment(std::size_t size) : values_{new T[size]} { }
+
+			std::unique_ptr<T[]> values_;
+			std::atomic<Segment*> next_{nullptr};
+		};
+
+		// The memory order is given as a constant on each path since compilers treat a memory 
+		// order only known at runtime as sequentially consistent.
+		void Publish(std::atomic<uint64_t>& counter, uint64_t value)
+		{
+			if(synchronized_)
+			{
+				counter.store(value, std::memory_order_release);
+			}
+			else
+			{
+				counter.store(value, std::memory_order_relaxed);
+			}
+		}
+
+		uint64_t Observe(const std::atomic<uint64_t>& counter) const
+		{
+			return synchronized_ ? counter.load(std::memory_order_acquire) : counter.load(std::memory_order_relaxed);
+		}
+
+		const std::size_t segmentSize_;
+		const bool synchronized_;
+
+		// Consumer side.  The padding keeps the consumer and producer sides on separate cache lines.
+		Segment* head_{nullptr};
+		std::size_t headIndex_{0};
+		std::atomic<uint64_t> popped_{0};
+		char consumerPadding_[64];
+
+		// Producer side
+		Segment* tail_{nullptr};
+		std::size_t tailIndex_{0};
+		std::atomic<uint64_t> pushed_{0};
+		char producerPadding_[64];
+
+		// A segment emptied by the consumer waiting to be reused by the producer
+		std::atomic<Segment*> spare_{nullptr};
+};
+
+} // End of namespace
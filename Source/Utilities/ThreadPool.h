@@ -0,0 +1,83 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! @file ThreadPool.h
+//! @brief A fixed set of worker threads for splitting work across cores.
+
+namespace Utilities {
+
+//! A fixed set of worker threads that run submitted work.
+//
+//! The intended use is ParallelFor(), which splits a range of indices into chunks, runs the chunks 
+//! on the workers and the calling thread, and returns once they're all done.  ParallelFor() may be 
+//! called from several threads at once and from within work running on the pool.
+class ThreadPool
+{
+	public:
+		//! Instantiate a pool with the given number of worker threads.
+		//
+		//! With zero threads all work is done on the thread calling ParallelFor().
+		explicit ThreadPool(std::size_t threads=std::thread::hardware_concurrency());
+
+		//! Finishes any queued work and joins the worker threads.
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		//! Returns the number of worker threads.
+		std::size_t GetThreadCount() const;
+
+		//! Calls work(begin, end) for consecutive ranges covering [0, count), in parallel.
+		//
+		//! Each range holds at least minimumChunk indices (except perhaps the last).  If any call 
+		//! throws, the first exception is rethrown here once all the ranges have finished.
+		void ParallelFor(std::size_t count, const std::function<void(std::size_t, std::size_t)>& work, std::size_t minimumChunk=1);
+
+		//! Returns a pool shared by the whole process with one worker per core.
+		static ThreadPool& GetSharedPool();
+
+	private:
+		void RunWorker();
+
+		std::vector<std::thread> threads_;
+		std::deque<std::function<void()>> tasks_;
+		std::mutex mutex_;
+		std::condition_variable taskAvailable_;
+		bool stopping_{false};
+};
+
+}
@@ -0,0 +1,106 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Utilities/MemoryPool.h>
+#include <cstdint>
+#include <thread>
+
+TEST(UtilitiesMemoryPool, TestAlignment)
+{
+	Utilities::MemoryPool pool;
+	for(std::size_t bytes : {1, 63, 64, 65, 1000, 4096 * 8, 2 * 1024 * 1024})
+	{
+		void* memory{pool.Allocate(bytes)};
+		EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(memory) % Utilities::MemoryPool::ALIGNMENT);
+		pool.Deallocate(memory, bytes);
+	}
+}
+
+TEST(UtilitiesMemoryPool, TestBlocksAreReused)
+{
+	Utilities::MemoryPool pool;
+	void* first{pool.Allocate(1000)};
+	pool.Deallocate(first, 1000);
+
+	// Any request in the same size class gets the freed block back without touching the heap
+	auto countersBefore{Utilities::GetAllocationCounters()};
+	void* second{pool.Allocate(900)};
+	auto countersAfter{Utilities::GetAllocationCounters()};
+
+	EXPECT_EQ(first, second);
+	EXPECT_GE(countersAfter.allocations_ - countersBefore.allocations_, 1);
+	EXPECT_GE(countersAfter.bytesAllocated_ - countersBefore.bytesAllocated_, 900);
+	pool.Deallocate(second, 900);
+}
+
+TEST(UtilitiesMemoryPool, TestLargeBlocksAreNotPooled)
+{
+	Utilities::MemoryPool pool;
+	std::size_t bytes{Utilities::MemoryPool::MAXIMUM_POOLED_BYTES + 1};
+
+	auto countersBefore{Utilities::GetAllocationCounters()};
+	pool.Deallocate(pool.Allocate(bytes), bytes);
+	pool.Deallocate(pool.Allocate(bytes), bytes);
+	auto countersAfter{Utilities::GetAllocationCounters()};
+
+	EXPECT_GE(countersAfter.heapAllocations_ - countersBefore.heapAllocations_, 2);
+}
+
+TEST(UtilitiesMemoryPool, TestPoolAllocator)
+{
+	Utilities::PoolVector<double> first(512, 1.0);
+	EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(first.data()) % Utilities::MemoryPool::ALIGNMENT);
+	EXPECT_EQ(Utilities::MemoryPool::GetThreadPool(), first.get_allocator().GetPool());
+
+	// A copy uses the same pool
+	Utilities::PoolVector<double> second{first};
+	EXPECT_TRUE(first.get_allocator() == second.get_allocator());
+	EXPECT_EQ(1.0, second[511]);
+
+	// Each thread gets its own pool
+	std::shared_ptr<Utilities::MemoryPool> otherThreadPool;
+	std::thread thread{[&]() { otherThreadPool = Utilities::MemoryPool::GetThreadPool(); }};
+	thread.join();
+	EXPECT_NE(Utilities::MemoryPool::GetThreadPool(), otherThreadPool);
+}
+
+TEST(UtilitiesMemoryPool, TestAllocationRateMeter)
+{
+	Utilities::AllocationRateMeter meter;
+	EXPECT_EQ(0.0, meter.GetAllocationsPerSecond(0, 44100));
+
+	for(int i = 0; i < 10; ++i)
+	{
+		Utilities::PoolVector<double> scratch(1024);
+	}
+
+	// Ten allocations while "processing" half a second of audio
+	EXPECT_GE(meter.GetAllocationsPerSecond(22050, 44100), 20.0);
+
+	meter.Restart();
+	EXPECT_EQ(0.0, meter.GetAllocationsPerSecond(22050, 44100));
+}
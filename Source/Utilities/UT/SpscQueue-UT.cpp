@@ -0,0 +1,142 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Utilities/SpscQueue.h>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(UtilitiesSpscQueue, TestPushPopAcrossSegments)
+{
+	Utilities::SpscQueue<int> queue{Utilities::Synchronization::THREAD_SAFE, 16};
+	std::vector<int> input(100);
+	std::iota(input.begin(), input.end(), 0);
+
+	queue.Push(input.data(), 37);
+	queue.Push(input.data() + 37, 63);
+	EXPECT_EQ(100, queue.GetSize());
+
+	std::vector<int> output(100);
+	EXPECT_EQ(50, queue.Pop(output.data(), 50));
+	EXPECT_EQ(50, queue.GetSize());
+	EXPECT_EQ(50, queue.Pop(output.data() + 50, 80));
+	EXPECT_EQ(0, queue.GetSize());
+	EXPECT_EQ(input, output);
+}
+
+TEST(UtilitiesSpscQueue, TestPopFromEmptyQueue)
+{
+	Utilities::SpscQueue<double> queue;
+	double value{0.0};
+	EXPECT_EQ(0, queue.Pop(&value, 1));
+
+	double pushed{1.5};
+	queue.Push(&pushed, 1);
+	EXPECT_EQ(1, queue.Pop(&value, 10));
+	EXPECT_EQ(1.5, value);
+}
+
+TEST(UtilitiesSpscQueue, TestClear)
+{
+	Utilities::SpscQueue<int> queue{Utilities::Synchronization::SINGLE_THREADED, 8};
+	std::vector<int> input(30, 7);
+	queue.Push(input.data(), input.size());
+	queue.Clear();
+	EXPECT_EQ(0, queue.GetSize());
+
+	// The queue is fully usable after being cleared
+	int value{1};
+	queue.Push(&value, 1);
+	int output{0};
+	EXPECT_EQ(1, queue.Pop(&output, 1));
+	EXPECT_EQ(1, output);
+}
+
+TEST(UtilitiesSpscQueue, TestSingleThreadedInterleaved)
+{
+	Utilities::SpscQueue<int> queue{Utilities::Synchronization::SINGLE_THREADED, 4};
+	int next{0};
+	int expected{0};
+	for(int round = 0; round < 100; ++round)
+	{
+		std::vector<int> input(round % 9);
+		for(auto& value : input)
+		{
+			value = next++;
+		}
+		queue.Push(input.data(), input.size());
+
+		std::vector<int> output(round % 5);
+		auto popped{queue.Pop(output.data(), output.size())};
+		for(std::size_t i = 0; i < popped; ++i)
+		{
+			EXPECT_EQ(expected++, output[i]);
+		}
+	}
+
+	EXPECT_EQ(static_cast<std::size_t>(next - expected), queue.GetSize());
+}
+
+TEST(UtilitiesSpscQueue, TestProducerConsumerThreads)
+{
+	const uint32_t totalValues{1000000};
+	Utilities::SpscQueue<uint32_t> queue{Utilities::Synchronization::THREAD_SAFE, 256};
+
+	std::thread producer([&queue, totalValues]()
+	{
+		std::vector<uint32_t> block(97);
+		uint32_t next{0};
+		while(next < totalValues)
+		{
+			std::size_t count{std::min<std::size_t>(block.size(), totalValues - next)};
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				block[i] = next++;
+			}
+			queue.Push(block.data(), count);
+		}
+	});
+
+	// Every value must come out exactly once and in order
+	std::vector<uint32_t> block(61);
+	uint32_t expected{0};
+	bool inOrder{true};
+	while(expected < totalValues)
+	{
+		auto popped{queue.Pop(block.data(), block.size())};
+		for(std::size_t i = 0; i < popped; ++i)
+		{
+			inOrder = inOrder && (block[i] == expected);
+			++expected;
+		}
+	}
+
+	producer.join();
+	EXPECT_TRUE(inOrder);
+	EXPECT_EQ(0, queue.GetSize());
+}
@@ -0,0 +1,121 @@
+/*
+ * AudioLib
+ *
+ * Copyright (c) 2017 - Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Utilities/ThreadPool.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(UtilitiesThreadPool, TestEveryIndexRunsOnce)
+{
+	Utilities::ThreadPool pool{4};
+	EXPECT_EQ(4, pool.GetThreadCount());
+
+	std::vector<std::atomic<int>> counts(1000);
+	for(auto& count : counts)
+	{
+		count = 0;
+	}
+
+	pool.ParallelFor(counts.size(), [&](std::size_t begin, std::size_t end)
+	{
+		for(std::size_t i{begin}; i < end; ++i)
+		{
+			++counts[i];
+		}
+	});
+
+	for(const auto& count : counts)
+	{
+		EXPECT_EQ(1, count);
+	}
+}
+
+TEST(UtilitiesThreadPool, TestMinimumChunk)
+{
+	Utilities::ThreadPool pool{2};
+	std::atomic<int> shortChunks{0};
+	pool.ParallelFor(100, [&](std::size_t begin, std::size_t end)
+	{
+		if(end - begin < 30 && end != 100)
+		{
+			++shortChunks;
+		}
+	}, 30);
+
+	EXPECT_EQ(0, shortChunks);
+}
+
+TEST(UtilitiesThreadPool, TestWithoutThreads)
+{
+	Utilities::ThreadPool pool{0};
+	int sum{0};
+	pool.ParallelFor(10, [&](std::size_t begin, std::size_t end)
+	{
+		for(std::size_t i{begin}; i < end; ++i)
+		{
+			sum += static_cast<int>(i);
+		}
+	});
+
+	EXPECT_EQ(45, sum);
+}
+
+TEST(UtilitiesThreadPool, TestExceptionIsRethrown)
+{
+	Utilities::ThreadPool pool{3};
+	std::atomic<int> indices{0};
+	EXPECT_THROW(pool.ParallelFor(100, [&](std::size_t begin, std::size_t end)
+	{
+		indices += static_cast<int>(end - begin);
+		if(begin == 0)
+		{
+			throw std::runtime_error("Failed");
+		}
+	}), std::runtime_error);
+
+	// All the other ranges still ran, and the pool is still usable
+	EXPECT_EQ(100, indices);
+	std::atomic<int> count{0};
+	pool.ParallelFor(10, [&](std::size_t begin, std::size_t end) { count += static_cast<int>(end - begin); });
+	EXPECT_EQ(10, count);
+}
+
+TEST(UtilitiesThreadPool, TestNestedParallelFor)
+{
+	Utilities::ThreadPool pool{2};
+	std::atomic<int> count{0};
+	pool.ParallelFor(8, [&](std::size_t begin, std::size_t end)
+	{
+		for(std::size_t i{begin}; i < end; ++i)
+		{
+			pool.ParallelFor(8, [&](std::size_t innerBegin, std::size_t innerEnd) { count += static_cast<int>(innerEnd - innerBegin); });
+		}
+	});
+
+	EXPECT_EQ(64, count);
+}
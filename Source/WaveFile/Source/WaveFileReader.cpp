@@ -223,6 +223,40 @@ std::vector<AudioData> WaveFile::WaveFileReader::GetAudioData()
 }
 
 std::vector<AudioData> WaveFile::WaveFileReader::GetAudioData(std::size_t samplesToRead)
+{
+	auto data{ReadSigned16Samples(samplesToRead)};
+
+	if(GetChannels() == 1)
+	{
+		return std::vector<AudioData>{Signal::ConvertSigned16ToAudioData(data)};	
+	}
+
+	return Signal::ConvertInterleavedSigned16ToAudioData(data);	
+}
+
+std::vector<AudioData> WaveFile::WaveFileReader::GetAudioData(std::size_t samplesStartPosition, std::size_t samplesToRead)
+{
+	FilePointerSeekToSamplePosition(samplesStartPosition);
+	return GetAudioData(samplesToRead);
+}
+
+AudioBuffer WaveFile::WaveFileReader::GetAudioBuffer(AudioBuffer::Layout layout)
+{
+	return GetAudioBuffer(0, GetSampleCount(), layout);
+}
+
+AudioBuffer WaveFile::WaveFileReader::GetAudioBuffer(std::size_t samplesToRead, AudioBuffer::Layout layout)
+{
+	return Signal::ConvertInterleavedSigned16ToAudioBuffer(ReadSigned16Samples(samplesToRead), GetChannels(), layout);
+}
+
+AudioBuffer WaveFile::WaveFileReader::GetAudioBuffer(std::size_t samplesStartPosition, std::size_t samplesToRead, AudioBuffer::Layout layout)
+{
+	FilePointerSeekToSamplePosition(samplesStartPosition);
+	return GetAudioBuffer(samplesToRead, layout);
+}
+
+std::vector<int16_t> WaveFile::WaveFileReader::ReadSigned16Samples(std::size_t samplesToRead)
 {
 	// First see if we're near the EOF and make sure we don't try and read beyong it as there may be 
 	// metadata and etc there and we don't want to return that as if it were audio data.
@@ -247,21 +281,10 @@ std::vector<AudioData> WaveFile::WaveFileReader::GetAudioData(std::size_t sample
 	inputFileStream_.read(reinterpret_cast<char*>(data.data()), shortsToRead * 2);
 	if(!inputFileStream_.good())
 	{
-		Utilities::Exception(Utilities::Stringify("WaveFileReader::GetAudioData(std::size_t) failed to read audio data from wave file " + filename_));
+		Utilities::Exception(Utilities::Stringify("WaveFileReader::ReadSigned16Samples(std::size_t) failed to read audio data from wave file " + filename_));
 	}
 
-	if(GetChannels() == 1)
-	{
-		return std::vector<AudioData>{Signal::ConvertSigned16ToAudioData(data)};	
-	}
-
-	return Signal::ConvertInterleavedSigned16ToAudioData(data);	
-}
-
-std::vector<AudioData> WaveFile::WaveFileReader::GetAudioData(std::size_t samplesStartPosition, std::size_t samplesToRead)
-{
-	FilePointerSeekToSamplePosition(samplesStartPosition);
-	return GetAudioData(samplesToRead);
+	return data;
 }
 
 const WaveFile::WaveFileHeader& WaveFile::WaveFileReader::GetHeader()
@@ -28,6 +28,7 @@
 #include <WaveFile/WaveFileDefines.h>
 #include <WaveFile/WaveFileHeader.h>
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioBuffer.h>
 #include <Utilities/Exception.h>
 #include <Signal/SignalConversion.h>
 #include <Utilities/Stringify.h>
@@ -125,6 +126,26 @@ void WaveFile::WaveFileWriter::AppendAudioData(const std::vector<AudioData>& aud
 		shortOutput = Signal::ConvertAudioDataToInterleavedSigned16(audioData[WaveFile::LEFT_CHANNEL], audioData[WaveFile::RIGHT_CHANNEL]);	
 	}
 
+	WriteSigned16Samples(shortOutput);
+}
+
+void WaveFile::WaveFileWriter::AppendAudioBuffer(const AudioBuffer& audioBuffer)
+{
+	if(audioBuffer.GetFrames() == 0)
+	{
+		return;
+	}
+
+	if(audioBuffer.GetChannels() != channels_)
+	{
+		Utilities::ThrowException("Given audio buffer does not correspond to specified channels", filename_, audioBuffer.GetChannels(), channels_);
+	}
+
+	WriteSigned16Samples(Signal::ConvertAudioBufferToInterleavedSigned16(audioBuffer));
+}
+
+void WaveFile::WaveFileWriter::WriteSigned16Samples(const std::vector<int16_t>& shortOutput)
+{
  	fileStream_.write(reinterpret_cast<const char*>(&shortOutput[0]), sizeof(int16_t) * shortOutput.size());
 	if(!fileStream_.good())
 	{
@@ -28,6 +28,7 @@
 #include <WaveFile/WaveFileDefines.h>
 #include <WaveFile/WaveFileReader.h>
 #include <WaveFile/WaveFileWriter.h>
+#include <AudioData/AudioBuffer.h>
 #include <Utilities/Exception.h>
 #include <cmath>
 
@@ -152,3 +153,43 @@ TEST(WaveWriterTest, CreateStereoWaveFileAndVerify)
 		EXPECT_NEAR(rawAudioDataRight[i], readAudioDataRight[i], 0.0001);	
 	}
 }
+
+TEST(WaveWriterTest, CreateStereoWaveFileFromAudioBufferAndVerify)
+{
+	const std::vector<double> rawAudioDataLeft{0, 0.25, 0.5, 0.75, 1.0, 0.75, 0.5, 0.25, 0};
+	const std::vector<double> rawAudioDataRight{0, -0.25, -0.5, -0.75, -1.0, -0.75, -0.5, -0.25, 0};
+
+	// Write a planar buffer to make sure it's interleaved properly on the way to the file
+	AudioBuffer audioBuffer{std::vector<AudioData>{AudioData(rawAudioDataLeft), AudioData(rawAudioDataRight)}, AudioBuffer::Layout::PLANAR};
+
+	// I scope this so that it goes out of scope (closes the file) before trying to read it
+	{
+		WaveFile::WaveFileWriter waveWriter{"StereoBufferTestOutputFile.wav", 2, 44100, 16};
+		waveWriter.AppendAudioBuffer(audioBuffer);
+		EXPECT_EQ(rawAudioDataLeft.size(), waveWriter.GetSampleCount());
+		EXPECT_THROW(waveWriter.AppendAudioBuffer(AudioBuffer{1, 4}), Utilities::Exception);
+	}
+
+	WaveFile::WaveFileReader waveReader{"StereoBufferTestOutputFile.wav"};
+	EXPECT_EQ(rawAudioDataLeft.size(), waveReader.GetSampleCount());
+
+	auto readAudioBuffer{waveReader.GetAudioBuffer()};
+	EXPECT_EQ(AudioBuffer::Layout::INTERLEAVED, readAudioBuffer.GetLayout());
+	EXPECT_EQ(2, readAudioBuffer.GetChannels());
+	EXPECT_EQ(rawAudioDataLeft.size(), readAudioBuffer.GetFrames());
+
+	for(std::size_t i{0}; i < rawAudioDataLeft.size(); ++i)
+	{
+		EXPECT_NEAR(rawAudioDataLeft[i], readAudioBuffer.GetSample(WaveFile::LEFT_CHANNEL, i), 0.0001);	
+		EXPECT_NEAR(rawAudioDataRight[i], readAudioBuffer.GetSample(WaveFile::RIGHT_CHANNEL, i), 0.0001);	
+	}
+
+	// Reading part of the file into a planar buffer must match the full read
+	auto partialAudioBuffer{waveReader.GetAudioBuffer(2, 3, AudioBuffer::Layout::PLANAR)};
+	EXPECT_EQ(3, partialAudioBuffer.GetFrames());
+	for(std::size_t i{0}; i < 3; ++i)
+	{
+		EXPECT_EQ(readAudioBuffer.GetSample(WaveFile::LEFT_CHANNEL, i + 2), partialAudioBuffer.GetSample(WaveFile::LEFT_CHANNEL, i));
+		EXPECT_EQ(readAudioBuffer.GetSample(WaveFile::RIGHT_CHANNEL, i + 2), partialAudioBuffer.GetSample(WaveFile::RIGHT_CHANNEL, i));
+	}
+}
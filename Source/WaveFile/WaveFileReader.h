@@ -32,6 +32,7 @@
 #include <unordered_map>
 #include <WaveFile/WaveFileHeader.h>
 #include <AudioData/AudioData.h>
+#include <AudioData/AudioBuffer.h>
 
 //! @file WaveFileReader.h
 //! @brief Class facilitating reading a typical wave file.
@@ -94,6 +95,17 @@ class WaveFileReader
 		//! Read the "samplesToRead" in the wave file for a specific position.
 		std::vector<AudioData> GetAudioData(std::size_t samplesStartPosition, std::size_t samplesToRead);
 
+		//! Get the entire audio content of the wave file as a single multichannel buffer.
+		//
+		//! The buffer returned has the interleaved layout of the wave file unless otherwise requested.
+		AudioBuffer GetAudioBuffer(AudioBuffer::Layout layout=AudioBuffer::Layout::INTERLEAVED);
+
+		//! Read the next "samplesToRead" in the wave file into a single multichannel buffer.
+		AudioBuffer GetAudioBuffer(std::size_t samplesToRead, AudioBuffer::Layout layout=AudioBuffer::Layout::INTERLEAVED);
+
+		//! Read the "samplesToRead" in the wave file for a specific position into a single multichannel buffer.
+		AudioBuffer GetAudioBuffer(std::size_t samplesStartPosition, std::size_t samplesToRead, AudioBuffer::Layout layout=AudioBuffer::Layout::INTERLEAVED);
+
 	private:
 		void ReadHeader();
 		void ValidateHeader();
@@ -115,6 +127,9 @@ class WaveFileReader
 
 		std::vector<uint8_t> Read(std::size_t bytes, std::size_t filePosition=0);
 
+		// Reads the next "samplesToRead" samples for every channel from the current file position, returning them interleaved
+		std::vector<int16_t> ReadSigned16Samples(std::size_t samplesToRead);
+
 		std::string filename_;
 		WaveFile::WaveFileHeader header_;
 		static const unsigned int waveHeaderSize_{sizeof(WaveFile::WaveFileHeader)};
@@ -30,11 +30,12 @@
 #include <fstream>
 #include <vector>
 #include <unordered_map>
+#include <AudioData/AudioData.h>
 
 //! @file WaveFileWriter.h
 //! @brief Class facilitating writing a typical wave file.
 
-class AudioData;
+class AudioBuffer;
 
 namespace WaveFile {
 
@@ -59,6 +60,11 @@ class WaveFileWriter
 		//! convention of index zero being the left channel and index one being the right channel.
 		void AppendAudioData(const std::vector<AudioData>& audioData);
 
+		//! @brief Write a multichannel buffer of audio to the end of the wave file.
+		//! The buffer must have the same number of channels as the wave file.  Either layout may be given, although an 
+		//! interleaved buffer matches the wave file and is written in a single pass.
+		void AppendAudioBuffer(const AudioBuffer& audioBuffer);
+
 		//! Get the current size (in samples) of the wave file.
 		std::size_t GetSampleCount();
 
@@ -76,6 +82,7 @@ class WaveFileWriter
 
 	private:
 		void WriteWaveFileHeader();
+		void WriteSigned16Samples(const std::vector<int16_t>& interleavedSamples);
 
 		std::string filename_;
 		std::size_t channels_;